@@ -1,11 +1,12 @@
 #!/usr/bin/env python3
 """
-Generate test data for benchmarks (matrices and vectors in CSV format).
+Generate test data for benchmarks (matrices and vectors in CSV or NumPy format).
 
 Usage:
     python generate_data.py              # Default: 500x500 matrices
     python generate_data.py --n 1000     # 1000x1000 matrices
     python generate_data.py -n 100       # 100x100 matrices
+    python generate_data.py --format npy # .npy files ( memory mapped by vmafu )
 """
 
 import argparse
@@ -16,13 +17,21 @@ import os
 def generate_matrix(filepath: str, rows: int, cols: int, seed: int = 42):
     np.random.seed(seed)
     matrix = np.random.rand(rows, cols)
-    np.savetxt(filepath, matrix, delimiter=',', fmt='%.6f')
+
+    if filepath.endswith('.npy'):
+        np.save(filepath, matrix)
+    else:
+        np.savetxt(filepath, matrix, delimiter=',', fmt='%.6f')
 
 
 def generate_vector(filepath: str, size: int, seed: int = 42):
     np.random.seed(seed + 1)
     vector = np.random.rand(1, size)
-    np.savetxt(filepath, vector, delimiter=',', fmt='%.6f')
+
+    if filepath.endswith('.npy'):
+        np.save(filepath, vector.ravel())
+    else:
+        np.savetxt(filepath, vector, delimiter=',', fmt='%.6f')
 
 
 def main():
@@ -48,18 +57,26 @@ def main():
         default='data',
         help='Output directory for data files (default: data)'
     )
+    parser.add_argument(
+        '--format',
+        type=str,
+        choices=['csv', 'npy'],
+        default='csv',
+        help='Output file format (default: csv)'
+    )
     
     args = parser.parse_args()
 
     os.makedirs(args.output_dir, exist_ok=True)
 
     n = args.size
+    ext = args.format
     
-    generate_matrix(f'{args.output_dir}/matrix1.csv', n, n, seed=args.seed)
-    generate_matrix(f'{args.output_dir}/matrix2.csv', n, n, seed=args.seed + 100)
-    generate_vector(f'{args.output_dir}/vector1.csv', n, seed=args.seed + 200)
+    generate_matrix(f'{args.output_dir}/matrix1.{ext}', n, n, seed=args.seed)
+    generate_matrix(f'{args.output_dir}/matrix2.{ext}', n, n, seed=args.seed + 100)
+    generate_vector(f'{args.output_dir}/vector1.{ext}', n, seed=args.seed + 200)
     
-    print(f"\nTest data generated in '{args.output_dir}/' directory:\n  - matrix1.csv: {n}x{n}\n  - matrix2.csv: {n}x{n}\n  - vector1.csv: {n} elements\n")
+    print(f"\nTest data generated in '{args.output_dir}/' directory:\n  - matrix1.{ext}: {n}x{n}\n  - matrix2.{ext}: {n}x{n}\n  - vector1.{ext}: {n} elements\n")
 
 
 if __name__ == '__main__':
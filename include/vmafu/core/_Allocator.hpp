@@ -0,0 +1,104 @@
+// core/_Allocator.hpp
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <new>
+#include <memory>
+#include <type_traits>
+
+#include "../utils/_compat.hpp"
+
+#if VMAFU_HAS_MMAP
+    #include <sys/mman.h>
+#endif
+
+
+namespace vmafu {
+    namespace core {
+        // Construction tags
+
+        struct uninitialized_t {
+            explicit constexpr uninitialized_t() = default;
+        };
+
+        VMAFU_INLINE constexpr uninitialized_t uninitialized{};
+
+        // Stateless allocator: Alignment-aligned blocks, and with HugePages
+        // set, blocks of at least HUGE_PAGE_SIZE are 2 MiB aligned and
+        // advised for transparent huge pages
+
+        template <typename T, size_t Alignment = 64, bool HugePages = false>
+        class AlignedAllocator {
+            static_assert(
+                Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                "AlignedAllocator: Alignment must be a power of two >= alignof(T)"
+            );
+
+            public:
+                // Constants
+
+                static constexpr size_t ALIGNMENT = Alignment;
+                static constexpr size_t HUGE_PAGE_SIZE = size_t(1) << 21;
+
+                // Types
+
+                using value_type = T;
+                using is_always_equal = std::true_type;
+
+                template <typename U>
+                struct rebind {
+                    using other = AlignedAllocator<U, Alignment, HugePages>;
+                };
+
+                // Constructors
+
+                AlignedAllocator() noexcept = default;
+
+                template <typename U>
+                AlignedAllocator(
+                    const AlignedAllocator<U, Alignment, HugePages>&
+                ) noexcept {}
+
+                // Allocation methods
+
+                T* allocate(size_t n);
+                void deallocate(T* pointer, size_t n) noexcept;
+
+                // Helper methods
+
+                static size_t alignment_for(size_t bytes) noexcept;
+                static size_t capacity_for(size_t bytes) noexcept;
+        };
+
+        template <typename T, typename U, size_t A, bool H>
+        bool operator==(
+            const AlignedAllocator<T, A, H>&,
+            const AlignedAllocator<U, A, H>&
+        ) noexcept;
+
+        template <typename T, typename U, size_t A, bool H>
+        bool operator!=(
+            const AlignedAllocator<T, A, H>&,
+            const AlignedAllocator<U, A, H>&
+        ) noexcept;
+
+        // Aliases
+
+        template <typename T>
+        using HugePageAllocator = AlignedAllocator<T, 64, true>;
+
+        // Storage helpers ( used by Vector / Matrix )
+
+        template <typename T, typename Allocator>
+        T* allocate_storage(size_t n, bool initialize);
+
+        template <typename T, typename Allocator>
+        void deallocate_storage(T* data, size_t n) noexcept;
+    }
+}
+
+
+#include "detail/_Allocator.ipp"
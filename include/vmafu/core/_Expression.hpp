@@ -0,0 +1,39 @@
+// core/_Expression.hpp
+
+
+#pragma once
+
+
+#include <type_traits>
+
+
+namespace vmafu {
+    namespace core {
+        // CRTP bases of the lazy linalg expressions ( see
+        // linalg/_expressions.hpp ); Vector and Matrix evaluate them in a
+        // single pass on construction / assignment
+
+        template <typename Derived>
+        struct VectorExpression {
+            const Derived& derived() const noexcept;
+        };
+
+        template <typename Derived>
+        struct MatrixExpression {
+            const Derived& derived() const noexcept;
+        };
+
+        // Traits
+
+        template <typename T>
+        struct is_vector_expression
+        : std::is_base_of<VectorExpression<std::decay_t<T>>, std::decay_t<T>> {};
+
+        template <typename T>
+        struct is_matrix_expression
+        : std::is_base_of<MatrixExpression<std::decay_t<T>>, std::decay_t<T>> {};
+    }
+}
+
+
+#include "detail/_Expression.ipp"
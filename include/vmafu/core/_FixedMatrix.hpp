@@ -0,0 +1,106 @@
+// core/_FixedMatrix.hpp
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <stdexcept>
+#include <initializer_list>
+#include <type_traits>
+
+#include "../utils/_compat.hpp"
+#include "../utils/_unroll.hpp"
+
+#include "_Matrix.hpp"
+#include "_MatrixView.hpp"
+#include "_FixedVector.hpp"
+
+
+namespace vmafu {
+    namespace core {
+        // Stack-allocated row-major R x C matrix; every element loop is
+        // unrolled and usable in constant expressions
+
+        template <typename T, size_t R, size_t C>
+        class FixedMatrix {
+            static_assert(R > 0 && C > 0, "FixedMatrix: dimensions must be positive");
+
+            private:
+                T _data[R * C];
+
+            public:
+                // Types
+
+                using value_type = T;
+
+                // Constructors
+
+                constexpr FixedMatrix();
+                constexpr FixedMatrix(
+                    std::initializer_list<std::initializer_list<T>> init_list
+                );
+
+                template <typename Allocator, typename Layout>
+                explicit FixedMatrix(const Matrix<T, Allocator, Layout>& matrix);
+
+                template <typename U>
+                explicit FixedMatrix(const MatrixView<U>& view);
+
+                // Getters
+
+                constexpr T* data() noexcept;
+                constexpr const T* data() const noexcept;
+
+                static constexpr size_t rows() noexcept;
+                static constexpr size_t cols() noexcept;
+                static constexpr size_t size() noexcept;
+
+                // Access methods
+
+                constexpr T& operator()(size_t row, size_t col) noexcept;
+                constexpr const T& operator()(size_t row, size_t col) const noexcept;
+
+                constexpr T& operator[](size_t index) noexcept;
+                constexpr const T& operator[](size_t index) const noexcept;
+
+                constexpr T& at(size_t row, size_t col);
+                constexpr const T& at(size_t row, size_t col) const;
+
+                constexpr FixedVector<T, C> row(size_t row) const noexcept;
+                constexpr FixedVector<T, R> col(size_t col) const noexcept;
+
+                // Compound assignment
+
+                constexpr FixedMatrix& operator+=(const FixedMatrix& other_matrix) noexcept;
+                constexpr FixedMatrix& operator-=(const FixedMatrix& other_matrix) noexcept;
+                constexpr FixedMatrix& operator*=(const T& scalar) noexcept;
+                constexpr FixedMatrix& operator/=(const T& scalar);
+
+                // Conversion methods
+
+                MatrixView<T> view() noexcept;
+                ConstMatrixView<T> view() const noexcept;
+
+                Matrix<T> to_matrix() const;
+
+                // Iterators
+
+                constexpr T* begin() noexcept;
+                constexpr const T* begin() const noexcept;
+
+                constexpr T* end() noexcept;
+                constexpr const T* end() const noexcept;
+
+                // Static methods
+
+                static constexpr FixedMatrix zeros() noexcept;
+                static constexpr FixedMatrix ones() noexcept;
+                static constexpr FixedMatrix constant(const T& fill_value) noexcept;
+                static constexpr FixedMatrix identity() noexcept;
+        };
+    }
+}
+
+
+#include "detail/_FixedMatrix.ipp"
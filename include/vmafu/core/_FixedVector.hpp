@@ -0,0 +1,102 @@
+// core/_FixedVector.hpp
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../utils/_compat.hpp"
+#include "../utils/_unroll.hpp"
+
+#include "_Vector.hpp"
+#include "_VectorView.hpp"
+
+
+namespace vmafu {
+    namespace core {
+        // Stack-allocated vector of compile-time size N; every element loop
+        // is unrolled and usable in constant expressions
+
+        template <typename T, size_t N>
+        class FixedVector {
+            static_assert(N > 0, "FixedVector: N must be positive");
+
+            private:
+                T _data[N];
+
+            public:
+                // Types
+
+                using value_type = T;
+
+                // Constructors
+
+                constexpr FixedVector();
+
+                template <
+                    typename... Args,
+                    typename = VMAFU_ENABLE_IF_T((
+                        sizeof...(Args) == N && \
+                        (std::is_convertible<Args, T>::value && ...)
+                    ))
+                >
+                constexpr FixedVector(const Args&... values);
+
+                template <typename Allocator>
+                explicit FixedVector(const Vector<T, Allocator>& vector);
+
+                template <typename U>
+                explicit FixedVector(const VectorView<U>& view);
+
+                // Getters
+
+                constexpr T* data() noexcept;
+                constexpr const T* data() const noexcept;
+
+                static constexpr size_t size() noexcept;
+
+                // Access methods
+
+                constexpr T& operator[](size_t index) noexcept;
+                constexpr const T& operator[](size_t index) const noexcept;
+
+                constexpr T& at(size_t index);
+                constexpr const T& at(size_t index) const;
+
+                // Compound assignment
+
+                constexpr FixedVector& operator+=(const FixedVector& other_vector) noexcept;
+                constexpr FixedVector& operator-=(const FixedVector& other_vector) noexcept;
+                constexpr FixedVector& operator*=(const T& scalar) noexcept;
+                constexpr FixedVector& operator/=(const T& scalar);
+
+                // Conversion methods
+
+                VectorView<T> view() noexcept;
+                ConstVectorView<T> view() const noexcept;
+
+                Vector<T> to_vector() const;
+
+                // Iterators
+
+                constexpr T* begin() noexcept;
+                constexpr const T* begin() const noexcept;
+
+                constexpr T* end() noexcept;
+                constexpr const T* end() const noexcept;
+
+                // Static methods
+
+                static constexpr FixedVector zeros() noexcept;
+                static constexpr FixedVector ones() noexcept;
+                static constexpr FixedVector constant(const T& fill_value) noexcept;
+                static constexpr FixedVector unit(size_t index) noexcept;
+        };
+    }
+}
+
+
+#include "detail/_FixedVector.ipp"
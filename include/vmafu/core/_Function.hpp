@@ -7,6 +7,14 @@
 #include <functional>
 #include <type_traits>
 #include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include "../utils/_parallel_for.hpp"
+
+#include "_Allocator.hpp"
+#include "_Vector.hpp"
+#include "_Matrix.hpp"
 
 
 namespace vmafu {
@@ -49,6 +57,14 @@ namespace vmafu {
 
                 ResultT at(ArgT x) const;
 
+                // Batch methods ( threads == 0 uses every hardware thread;
+                // pass 1 when each MPI rank already owns a core )
+
+                Vector<ResultT> apply(
+                    const Vector<ArgT>& xs,
+                    size_t threads = 0
+                ) const;
+
                 // Static methods
 
                 static Function constant(ResultT value);
@@ -89,6 +105,15 @@ namespace vmafu {
 
                 ResultT at(ArgT1 x, ArgT2 y) const;
 
+                // Batch methods ( result(i, j) = f(xs[i], ys[j]); threads
+                // == 0 uses every hardware thread )
+
+                Matrix<ResultT> apply(
+                    const Vector<ArgT1>& xs,
+                    const Vector<ArgT2>& ys,
+                    size_t threads = 0
+                ) const;
+
                 // Static methods
 
                 static Function constant(ResultT value);
@@ -137,6 +162,57 @@ namespace vmafu {
                     ResultT (*func)(ArgT1, ArgT2, ArgT3)
                 );
         };
+
+        // Function with the callable as a template parameter: calls are
+        // direct and inlinable, with no type erasure and no per-call
+        // initialization check
+
+        template <typename Callable, typename ResultT, typename... ArgTs>
+        class InlineFunction {
+            private:
+                Callable _func;
+
+            public:
+                // Constructor
+
+                explicit InlineFunction(Callable func);
+
+                // Getter
+
+                const Callable& callable() const noexcept;
+
+                // Access methods
+
+                ResultT operator()(ArgTs... args) const;
+
+                ResultT at(ArgTs... args) const;
+
+                // Batch methods ( threads == 0 uses every hardware thread;
+                // pass 1 when each MPI rank already owns a core )
+
+                template <typename ArgT>
+                Vector<ResultT> apply(
+                    const Vector<ArgT>& xs,
+                    size_t threads = 0
+                ) const;
+
+                template <typename ArgT1, typename ArgT2>
+                Matrix<ResultT> apply(
+                    const Vector<ArgT1>& xs,
+                    const Vector<ArgT2>& ys,
+                    size_t threads = 0
+                ) const;
+
+                // Conversion
+
+                Function<ResultT, ArgTs...> to_function() const;
+        };
+
+        // Factory: make_function<double, double, double>([](double x, double y) { ... })
+
+        template <typename ResultT, typename... ArgTs, typename Callable>
+        InlineFunction<typename std::decay<Callable>::type, ResultT, ArgTs...>
+        make_function(Callable&& func);
     }
 }
 
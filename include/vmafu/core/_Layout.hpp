@@ -0,0 +1,78 @@
+// core/_Layout.hpp
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <type_traits>
+
+
+namespace vmafu {
+    namespace core {
+        // Storage layout policies: where element (row, col) of a
+        // rows x cols matrix lives in its flat buffer
+
+        struct RowMajor {
+            static size_t storage_size(size_t rows, size_t cols) noexcept;
+
+            static size_t index(
+                size_t row,
+                size_t col,
+                size_t rows,
+                size_t cols
+            ) noexcept;
+        };
+
+        struct ColumnMajor {
+            static size_t storage_size(size_t rows, size_t cols) noexcept;
+
+            static size_t index(
+                size_t row,
+                size_t col,
+                size_t rows,
+                size_t cols
+            ) noexcept;
+        };
+
+        // TileSize x TileSize tiles, each contiguous and row-major inside,
+        // stored tile-row by tile-row; edge tiles are zero padded to full
+        // size
+
+        template <size_t TileSize = 32>
+        struct TileMajor {
+            static_assert(TileSize > 0, "TileMajor: TileSize must be positive");
+
+            static constexpr size_t TILE = TileSize;
+            static constexpr size_t TILE_ELEMENTS = TileSize * TileSize;
+
+            static size_t tile_count(size_t extent) noexcept;
+
+            static size_t storage_size(size_t rows, size_t cols) noexcept;
+
+            static size_t index(
+                size_t row,
+                size_t col,
+                size_t rows,
+                size_t cols
+            ) noexcept;
+
+            static size_t tile_offset(
+                size_t tile_row,
+                size_t tile_col,
+                size_t cols
+            ) noexcept;
+        };
+
+        // Traits
+
+        template <typename Layout>
+        struct is_tiled : std::false_type {};
+
+        template <size_t TileSize>
+        struct is_tiled<TileMajor<TileSize>> : std::true_type {};
+    }
+}
+
+
+#include "detail/_Layout.ipp"
@@ -9,11 +9,23 @@
 #include <stdexcept>
 #include <initializer_list>
 #include <type_traits>
+#include <cmath>
+
+#include "../utils/_compat.hpp"
+
+#include "_Allocator.hpp"
+#include "_Expression.hpp"
+#include "_Layout.hpp"
+#include "_MatrixView.hpp"
 
 
 namespace vmafu {
     namespace core {
-        template <typename T>
+        template <
+            typename T,
+            typename Allocator = AlignedAllocator<T>,
+            typename Layout = RowMajor
+        >
         class Matrix {
             private:
                 T* _data = nullptr;
@@ -23,19 +35,52 @@ namespace vmafu {
 
                 // Helper methods ( memory managment )
 
-                void _allocate(size_t n);
+                void _allocate(size_t n, bool initialize = true);
                 void _deallocate() noexcept;
 
+                template <typename Expression>
+                void _evaluate(const Expression& expression);
+
+                template <typename OtherAllocator, typename OtherLayout>
+                void block_copy(
+                    const Matrix<T, OtherAllocator, OtherLayout>& source,
+                    size_t rows,
+                    size_t cols
+                );
+
+                // Friend classes
+
+                template <typename U, typename OtherAllocator, typename OtherLayout>
+                friend class Matrix;
+
             public:
+                // Types
+
+                using value_type = T;
+                using allocator_type = Allocator;
+                using layout_type = Layout;
+
                 // Constructors / Destructor
 
                 Matrix();
                 explicit Matrix(size_t rows, size_t cols);
+                Matrix(size_t rows, size_t cols, uninitialized_t);
                 Matrix(size_t rows, size_t cols, const T& init_value);
                 Matrix(
                     std::initializer_list<std::initializer_list<T>> init_list
                 );
 
+                template <typename U>
+                explicit Matrix(const MatrixView<U>& view);
+
+                template <typename OtherAllocator, typename OtherLayout>
+                explicit Matrix(
+                    const Matrix<T, OtherAllocator, OtherLayout>& other_matrix
+                );
+
+                template <typename Expression>
+                Matrix(const MatrixExpression<Expression>& expression);
+
                 ~Matrix();
 
                 // Getters
@@ -47,6 +92,7 @@ namespace vmafu {
                 size_t cols() const noexcept;
 
                 size_t size() const noexcept;
+                size_t storage_size() const noexcept;
 
                 // Setters ( memory managment )
 
@@ -67,6 +113,23 @@ namespace vmafu {
                 Matrix& operator=(const Matrix& other_matrix);
                 Matrix& operator=(Matrix&& other_matrix) noexcept;
 
+                template <typename Expression>
+                Matrix& operator=(const MatrixExpression<Expression>& expression);
+
+                // Compound assignment ( in place, no allocation )
+
+                Matrix& operator+=(const Matrix& other_matrix);
+                Matrix& operator-=(const Matrix& other_matrix);
+
+                template <typename Expression>
+                Matrix& operator+=(const MatrixExpression<Expression>& expression);
+
+                template <typename Expression>
+                Matrix& operator-=(const MatrixExpression<Expression>& expression);
+
+                Matrix& operator*=(const T& scalar);
+                Matrix& operator/=(const T& scalar);
+
                 // Access methods
 
                 T& operator()(size_t row, size_t col) noexcept;
@@ -78,6 +141,30 @@ namespace vmafu {
                 T& at(size_t row, size_t col);
                 const T& at(size_t row, size_t col) const;
 
+                // View methods
+
+                MatrixView<T> view() noexcept;
+                ConstMatrixView<T> view() const noexcept;
+
+                MatrixView<T> block(
+                    size_t row,
+                    size_t col,
+                    size_t rows,
+                    size_t cols
+                );
+                ConstMatrixView<T> block(
+                    size_t row,
+                    size_t col,
+                    size_t rows,
+                    size_t cols
+                ) const;
+
+                VectorView<T> row(size_t row);
+                ConstVectorView<T> row(size_t row) const;
+
+                VectorView<T> col(size_t col);
+                ConstVectorView<T> col(size_t col) const;
+
                 // Iterators
 
                 T* begin() noexcept;
@@ -101,6 +188,15 @@ namespace vmafu {
                     size_t cols,
                     T (*func)(T, T)
                 );
+
+                // Any T(T, T) callable: Function, InlineFunction or a lambda
+
+                template <typename Func>
+                static Matrix from_function(
+                    size_t rows,
+                    size_t cols,
+                    const Func& func
+                );
         };
     }
 }
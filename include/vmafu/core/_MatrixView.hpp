@@ -0,0 +1,100 @@
+// core/_MatrixView.hpp
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../utils/_compat.hpp"
+
+#include "_VectorView.hpp"
+
+
+namespace vmafu {
+    namespace core {
+        // Non-owning row-major view: element (i, j) lives at
+        // data[i * leading_dimension + j]; the viewed storage must outlive
+        // the view
+
+        template <typename T>
+        class MatrixView {
+            private:
+                T* _data = nullptr;
+
+                size_t _rows = 0;
+                size_t _cols = 0;
+                size_t _ld = 0;
+
+            public:
+                // Types
+
+                using value_type = std::remove_const_t<T>;
+
+                // Constructors
+
+                MatrixView() = default;
+                MatrixView(T* data, size_t rows, size_t cols) noexcept;
+                MatrixView(
+                    T* data,
+                    size_t rows,
+                    size_t cols,
+                    size_t leading_dimension
+                ) noexcept;
+
+                template <
+                    typename U,
+                    typename = VMAFU_ENABLE_IF_T((std::is_convertible<U*, T*>::value))
+                >
+                MatrixView(const MatrixView<U>& other_view) noexcept;
+
+                // Getters
+
+                T* data() const noexcept;
+
+                size_t rows() const noexcept;
+                size_t cols() const noexcept;
+                size_t leading_dimension() const noexcept;
+
+                size_t size() const noexcept;
+
+                bool is_contiguous() const noexcept;
+
+                // Access methods
+
+                T& operator()(size_t row, size_t col) const noexcept;
+
+                T& at(size_t row, size_t col) const;
+
+                // Slicing methods
+
+                MatrixView block(
+                    size_t row,
+                    size_t col,
+                    size_t rows,
+                    size_t cols
+                ) const;
+
+                VectorView<T> row(size_t row) const;
+                VectorView<T> col(size_t col) const;
+
+                // Assignment methods
+
+                void fill(const value_type& value) const;
+
+                template <typename U>
+                void copy_from(const MatrixView<U>& source) const;
+        };
+
+        // Aliases
+
+        template <typename T>
+        using ConstMatrixView = MatrixView<const T>;
+    }
+}
+
+
+#include "detail/_MatrixView.ipp"
@@ -0,0 +1,123 @@
+// core/_SparseMatrix.hpp
+
+
+#pragma once
+
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+#include "_Matrix.hpp"
+
+
+namespace vmafu {
+    namespace core {
+        // Coordinate ( triplet ) storage, in any order
+
+        template <typename T>
+        struct CooMatrix {
+            size_t rows = 0;
+            size_t cols = 0;
+
+            std::vector<size_t> row_indices;
+            std::vector<size_t> col_indices;
+            std::vector<T> values;
+        };
+
+        // Compressed sparse column storage: column j owns the entries
+        // [col_ptr[j], col_ptr[j + 1]) of row_indices / values, sorted by row
+
+        template <typename T>
+        struct CscMatrix {
+            size_t rows = 0;
+            size_t cols = 0;
+
+            std::vector<size_t> col_ptr;
+            std::vector<size_t> row_indices;
+            std::vector<T> values;
+        };
+
+        // Compressed sparse row matrix: row i owns the entries
+        // [row_ptr[i], row_ptr[i + 1]) of col_indices / values,
+        // sorted by column
+
+        template <typename T>
+        class SparseMatrix {
+            private:
+                size_t _rows = 0;
+                size_t _cols = 0;
+
+                std::vector<size_t> _row_ptr;
+                std::vector<size_t> _col_indices;
+                std::vector<T> _values;
+
+            public:
+                // Types
+
+                using value_type = T;
+
+                // Constructors
+
+                SparseMatrix();
+                explicit SparseMatrix(size_t rows, size_t cols);
+                SparseMatrix(
+                    size_t rows,
+                    size_t cols,
+                    std::vector<size_t> row_ptr,
+                    std::vector<size_t> col_indices,
+                    std::vector<T> values
+                );
+
+                // Getters
+
+                size_t rows() const noexcept;
+                size_t cols() const noexcept;
+
+                size_t nnz() const noexcept;
+
+                const std::vector<size_t>& row_ptr() const noexcept;
+                const std::vector<size_t>& col_indices() const noexcept;
+
+                std::vector<T>& values() noexcept;
+                const std::vector<T>& values() const noexcept;
+
+                // Access methods
+
+                T at(size_t row, size_t col) const;
+
+                // In-place operations
+
+                SparseMatrix& operator*=(const T& scalar);
+
+                // Conversion methods
+
+                Matrix<T> to_dense() const;
+
+                CooMatrix<T> to_coo() const;
+                CscMatrix<T> to_csc() const;
+
+                SparseMatrix transpose() const;
+
+                // Static methods
+
+                static SparseMatrix from_triplets(
+                    size_t rows,
+                    size_t cols,
+                    const std::vector<size_t>& row_indices,
+                    const std::vector<size_t>& col_indices,
+                    const std::vector<T>& values
+                );
+
+                static SparseMatrix from_coo(const CooMatrix<T>& matrix);
+                static SparseMatrix from_csc(const CscMatrix<T>& matrix);
+
+                static SparseMatrix from_dense(const Matrix<T>& matrix);
+        };
+    }
+}
+
+
+#include "detail/_SparseMatrix.ipp"
@@ -9,11 +9,18 @@
 #include <stdexcept>
 #include <initializer_list>
 #include <type_traits>
+#include <cmath>
+
+#include "../utils/_compat.hpp"
+
+#include "_Allocator.hpp"
+#include "_Expression.hpp"
+#include "_VectorView.hpp"
 
 
 namespace vmafu {
     namespace core {
-        template <typename T>
+        template <typename T, typename Allocator = AlignedAllocator<T>>
         class Vector {
             private:
                 T* _data = nullptr;
@@ -21,17 +28,32 @@ namespace vmafu {
 
                 // Helper methods ( memory managment )
 
-                void _allocate(size_t n);
+                void _allocate(size_t n, bool initialize = true);
                 void _deallocate() noexcept;
 
+                template <typename Expression>
+                void _evaluate(const Expression& expression);
+
             public:
+                // Types
+
+                using value_type = T;
+                using allocator_type = Allocator;
+
                 // Constructors / Destructor
 
                 Vector();
                 explicit Vector(size_t size);
+                Vector(size_t size, uninitialized_t);
                 Vector(size_t size, const T& init_value);
                 Vector(std::initializer_list<T> init_list);
 
+                template <typename U>
+                explicit Vector(const VectorView<U>& view);
+
+                template <typename Expression>
+                Vector(const VectorExpression<Expression>& expression);
+
                 ~Vector();
 
                 // Getters
@@ -56,6 +78,23 @@ namespace vmafu {
                 Vector& operator=(const Vector& other_vector);
                 Vector& operator=(Vector&& other_vector) noexcept;
 
+                template <typename Expression>
+                Vector& operator=(const VectorExpression<Expression>& expression);
+
+                // Compound assignment ( in place, no allocation )
+
+                Vector& operator+=(const Vector& other_vector);
+                Vector& operator-=(const Vector& other_vector);
+
+                template <typename Expression>
+                Vector& operator+=(const VectorExpression<Expression>& expression);
+
+                template <typename Expression>
+                Vector& operator-=(const VectorExpression<Expression>& expression);
+
+                Vector& operator*=(const T& scalar);
+                Vector& operator/=(const T& scalar);
+
                 // Access methods
 
                 T& operator[](size_t index) noexcept;
@@ -70,6 +109,14 @@ namespace vmafu {
                 T& back() noexcept;
                 const T& back() const noexcept;
 
+                // View methods
+
+                VectorView<T> view() noexcept;
+                ConstVectorView<T> view() const noexcept;
+
+                VectorView<T> segment(size_t start, size_t count);
+                ConstVectorView<T> segment(size_t start, size_t count) const;
+
                 // Iterators
 
                 T* begin() noexcept;
@@ -85,6 +132,11 @@ namespace vmafu {
                 static Vector ones(size_t size);
                 static Vector constant(size_t size, const T& fill_avalue);
                 static Vector from_function(size_t size, T (*func)(T));
+
+                // Any T(T) callable: Function, InlineFunction or a lambda
+
+                template <typename Func>
+                static Vector from_function(size_t size, const Func& func);
         };
     }
 }
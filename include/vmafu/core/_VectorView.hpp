@@ -0,0 +1,79 @@
+// core/_VectorView.hpp
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../utils/_compat.hpp"
+
+
+namespace vmafu {
+    namespace core {
+        // Non-owning view of size elements spaced stride apart; the
+        // viewed storage must outlive the view
+
+        template <typename T>
+        class VectorView {
+            private:
+                T* _data = nullptr;
+
+                size_t _size = 0;
+                size_t _stride = 1;
+
+            public:
+                // Types
+
+                using value_type = std::remove_const_t<T>;
+
+                // Constructors
+
+                VectorView() = default;
+                VectorView(T* data, size_t size, size_t stride = 1) noexcept;
+
+                template <
+                    typename U,
+                    typename = VMAFU_ENABLE_IF_T((std::is_convertible<U*, T*>::value))
+                >
+                VectorView(const VectorView<U>& other_view) noexcept;
+
+                // Getters
+
+                T* data() const noexcept;
+
+                size_t size() const noexcept;
+                size_t stride() const noexcept;
+
+                bool is_contiguous() const noexcept;
+
+                // Access methods
+
+                T& operator[](size_t index) const noexcept;
+
+                T& at(size_t index) const;
+
+                // Slicing methods
+
+                VectorView segment(size_t start, size_t count) const;
+
+                // Assignment methods
+
+                void fill(const value_type& value) const;
+
+                template <typename U>
+                void copy_from(const VectorView<U>& source) const;
+        };
+
+        // Aliases
+
+        template <typename T>
+        using ConstVectorView = VectorView<const T>;
+    }
+}
+
+
+#include "detail/_VectorView.ipp"
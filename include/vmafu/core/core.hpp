@@ -4,8 +4,16 @@
 #pragma once
 
 
+#include "_Allocator.hpp"
+#include "_Layout.hpp"
+#include "_Expression.hpp"
+#include "_VectorView.hpp"
+#include "_MatrixView.hpp"
 #include "_Vector.hpp"
 #include "_Matrix.hpp"
+#include "_FixedVector.hpp"
+#include "_FixedMatrix.hpp"
+#include "_SparseMatrix.hpp"
 #include "_Function.hpp"
 
 #include "_core.hpp"
@@ -14,9 +22,28 @@
 namespace vmafu {
     // Core
 
+    using core::AlignedAllocator;
+    using core::HugePageAllocator;
+    using core::uninitialized;
+
+    using core::RowMajor;
+    using core::ColumnMajor;
+    using core::TileMajor;
+
     using core::Vector;
     using core::Matrix;
+    using core::FixedVector;
+    using core::FixedMatrix;
+    using core::VectorView;
+    using core::ConstVectorView;
+    using core::MatrixView;
+    using core::ConstMatrixView;
+    using core::SparseMatrix;
+    using core::CooMatrix;
+    using core::CscMatrix;
     using core::Function;
+    using core::InlineFunction;
+    using core::make_function;
 
     // Aliases
 
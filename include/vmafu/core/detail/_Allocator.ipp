@@ -0,0 +1,127 @@
+// core/detail/_Allocator.ipp
+
+
+namespace vmafu {
+    namespace core {
+        // Allocation methods
+
+        template <typename T, size_t Alignment, bool HugePages>
+        T* AlignedAllocator<T, Alignment, HugePages>::allocate(size_t n) {
+            if (n > static_cast<size_t>(-1) / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+
+            size_t bytes = capacity_for(n * sizeof(T));
+
+            void* pointer = ::operator new(
+                bytes, std::align_val_t(alignment_for(bytes))
+            );
+
+#if VMAFU_HAS_MMAP && defined(MADV_HUGEPAGE)
+            VMAFU_IF_CONSTEXPR (HugePages) {
+                if (bytes >= HUGE_PAGE_SIZE) {
+                    // Advisory only: failure just leaves regular pages
+
+                    ::madvise(pointer, bytes, MADV_HUGEPAGE);
+                }
+            }
+#endif
+
+            return static_cast<T*>(pointer);
+        }
+
+        template <typename T, size_t Alignment, bool HugePages>
+        void AlignedAllocator<T, Alignment, HugePages>::deallocate(
+            T* pointer,
+            size_t n
+        ) noexcept {
+            ::operator delete(
+                pointer, std::align_val_t(alignment_for(capacity_for(n * sizeof(T))))
+            );
+        }
+
+        // Helper methods
+
+        template <typename T, size_t Alignment, bool HugePages>
+        size_t AlignedAllocator<T, Alignment, HugePages>::alignment_for(
+            size_t bytes
+        ) noexcept {
+            if (HugePages && bytes >= HUGE_PAGE_SIZE) {
+                return HUGE_PAGE_SIZE > Alignment ? HUGE_PAGE_SIZE : Alignment;
+            }
+
+            return Alignment;
+        }
+
+        template <typename T, size_t Alignment, bool HugePages>
+        size_t AlignedAllocator<T, Alignment, HugePages>::capacity_for(
+            size_t bytes
+        ) noexcept {
+            // Whole huge pages, so madvise never touches a neighbour block
+
+            if (HugePages && bytes >= HUGE_PAGE_SIZE) {
+                return (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+            }
+
+            return bytes;
+        }
+
+        template <typename T, typename U, size_t A, bool H>
+        bool operator==(
+            const AlignedAllocator<T, A, H>&,
+            const AlignedAllocator<U, A, H>&
+        ) noexcept {
+            return true;
+        }
+
+        template <typename T, typename U, size_t A, bool H>
+        bool operator!=(
+            const AlignedAllocator<T, A, H>&,
+            const AlignedAllocator<U, A, H>&
+        ) noexcept {
+            return false;
+        }
+
+        // Storage helpers ( used by Vector / Matrix )
+
+        template <typename T, typename Allocator>
+        T* allocate_storage(size_t n, bool initialize) {
+            if (n == 0) {
+                return nullptr;
+            }
+
+            Allocator allocator;
+
+            T* data = std::allocator_traits<Allocator>::allocate(allocator, n);
+
+            try {
+                if (initialize) {
+                    std::uninitialized_value_construct_n(data, n);
+                } else {
+                    // No-op for trivial types: the buffer keeps whatever
+                    // bytes it came with
+
+                    std::uninitialized_default_construct_n(data, n);
+                }
+            } catch (...) {
+                std::allocator_traits<Allocator>::deallocate(allocator, data, n);
+
+                throw;
+            }
+
+            return data;
+        }
+
+        template <typename T, typename Allocator>
+        void deallocate_storage(T* data, size_t n) noexcept {
+            if (data == nullptr) {
+                return;
+            }
+
+            Allocator allocator;
+
+            std::destroy_n(data, n);
+            std::allocator_traits<Allocator>::deallocate(allocator, data, n);
+        }
+    }
+}
@@ -0,0 +1,16 @@
+// core/detail/_Expression.ipp
+
+
+namespace vmafu {
+    namespace core {
+        template <typename Derived>
+        const Derived& VectorExpression<Derived>::derived() const noexcept {
+            return static_cast<const Derived&>(*this);
+        }
+
+        template <typename Derived>
+        const Derived& MatrixExpression<Derived>::derived() const noexcept {
+            return static_cast<const Derived&>(*this);
+        }
+    }
+}
@@ -0,0 +1,281 @@
+// core/detail/_FixedMatrix.ipp
+
+
+namespace vmafu {
+    namespace core {
+        // Constructors
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C>::FixedMatrix() : _data{} {}
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C>::FixedMatrix(
+            std::initializer_list<std::initializer_list<T>> init_list
+        ) : _data{} {
+            if (init_list.size() != R) {
+                throw std::invalid_argument(
+                    "FixedMatrix::FixedMatrix(): wrong number of rows"
+                );
+            }
+
+            size_t i = 0;
+
+            for (const auto& row : init_list) {
+                if (row.size() != C) {
+                    throw std::invalid_argument(
+                        "FixedMatrix::FixedMatrix(): wrong number of columns"
+                    );
+                }
+
+                size_t j = 0;
+
+                for (const auto& value : row) {
+                    _data[i * C + j++] = value;
+                }
+
+                i++;
+            }
+        }
+
+        template <typename T, size_t R, size_t C>
+        template <typename Allocator, typename Layout>
+        FixedMatrix<T, R, C>::FixedMatrix(
+            const Matrix<T, Allocator, Layout>& matrix
+        ) : _data{} {
+            if (matrix.rows() != R || matrix.cols() != C) {
+                throw std::invalid_argument(
+                    "FixedMatrix::FixedMatrix(): dimension mismatch"
+                );
+            }
+
+            utils::unroll<R>([&](size_t i) {
+                utils::unroll<C>([&](size_t j) { _data[i * C + j] = matrix(i, j); });
+            });
+        }
+
+        template <typename T, size_t R, size_t C>
+        template <typename U>
+        FixedMatrix<T, R, C>::FixedMatrix(const MatrixView<U>& view) : _data{} {
+            if (view.rows() != R || view.cols() != C) {
+                throw std::invalid_argument(
+                    "FixedMatrix::FixedMatrix(): dimension mismatch"
+                );
+            }
+
+            utils::unroll<R>([&](size_t i) {
+                utils::unroll<C>([&](size_t j) { _data[i * C + j] = view(i, j); });
+            });
+        }
+
+        // Getters
+
+        template <typename T, size_t R, size_t C>
+        constexpr T* FixedMatrix<T, R, C>::data() noexcept {
+            return _data;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr const T* FixedMatrix<T, R, C>::data() const noexcept {
+            return _data;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr size_t FixedMatrix<T, R, C>::rows() noexcept {
+            return R;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr size_t FixedMatrix<T, R, C>::cols() noexcept {
+            return C;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr size_t FixedMatrix<T, R, C>::size() noexcept {
+            return R * C;
+        }
+
+        // Access methods
+
+        template <typename T, size_t R, size_t C>
+        constexpr T& FixedMatrix<T, R, C>::operator()(size_t row, size_t col) noexcept {
+            return _data[row * C + col];
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr const T& FixedMatrix<T, R, C>::operator()(
+            size_t row,
+            size_t col
+        ) const noexcept {
+            return _data[row * C + col];
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr T& FixedMatrix<T, R, C>::operator[](size_t index) noexcept {
+            return _data[index];
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr const T& FixedMatrix<T, R, C>::operator[](size_t index) const noexcept {
+            return _data[index];
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr T& FixedMatrix<T, R, C>::at(size_t row, size_t col) {
+            if (row >= R || col >= C) {
+                throw std::out_of_range("FixedMatrix::at(): index out of range");
+            }
+
+            return _data[row * C + col];
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr const T& FixedMatrix<T, R, C>::at(size_t row, size_t col) const {
+            if (row >= R || col >= C) {
+                throw std::out_of_range("FixedMatrix::at(): index out of range");
+            }
+
+            return _data[row * C + col];
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedVector<T, C> FixedMatrix<T, R, C>::row(size_t row) const noexcept {
+            FixedVector<T, C> result;
+
+            utils::unroll<C>([&](size_t j) { result[j] = _data[row * C + j]; });
+
+            return result;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedVector<T, R> FixedMatrix<T, R, C>::col(size_t col) const noexcept {
+            FixedVector<T, R> result;
+
+            utils::unroll<R>([&](size_t i) { result[i] = _data[i * C + col]; });
+
+            return result;
+        }
+
+        // Compound assignment
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C>& FixedMatrix<T, R, C>::operator+=(
+            const FixedMatrix& other_matrix
+        ) noexcept {
+            utils::unroll<R * C>([&](size_t i) { _data[i] += other_matrix._data[i]; });
+
+            return *this;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C>& FixedMatrix<T, R, C>::operator-=(
+            const FixedMatrix& other_matrix
+        ) noexcept {
+            utils::unroll<R * C>([&](size_t i) { _data[i] -= other_matrix._data[i]; });
+
+            return *this;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C>& FixedMatrix<T, R, C>::operator*=(
+            const T& scalar
+        ) noexcept {
+            utils::unroll<R * C>([&](size_t i) { _data[i] *= scalar; });
+
+            return *this;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C>& FixedMatrix<T, R, C>::operator/=(
+            const T& scalar
+        ) {
+            VMAFU_IF_CONSTEXPR (VMAFU_IS_FLOATING_POINT_V(T)) {
+                if ((scalar < T{0} ? -scalar : scalar) < T(1e-10)) {
+                    throw std::invalid_argument(
+                        "FixedMatrix::operator/=(): Division by zero"
+                    );
+                }
+            } else if (scalar == T{0}) {
+                throw std::invalid_argument(
+                    "FixedMatrix::operator/=(): Division by zero"
+                );
+            }
+
+            utils::unroll<R * C>([&](size_t i) { _data[i] /= scalar; });
+
+            return *this;
+        }
+
+        // Conversion methods
+
+        template <typename T, size_t R, size_t C>
+        MatrixView<T> FixedMatrix<T, R, C>::view() noexcept {
+            return MatrixView<T>(_data, R, C);
+        }
+
+        template <typename T, size_t R, size_t C>
+        ConstMatrixView<T> FixedMatrix<T, R, C>::view() const noexcept {
+            return ConstMatrixView<T>(_data, R, C);
+        }
+
+        template <typename T, size_t R, size_t C>
+        Matrix<T> FixedMatrix<T, R, C>::to_matrix() const {
+            return Matrix<T>(view());
+        }
+
+        // Iterators
+
+        template <typename T, size_t R, size_t C>
+        constexpr T* FixedMatrix<T, R, C>::begin() noexcept {
+            return _data;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr const T* FixedMatrix<T, R, C>::begin() const noexcept {
+            return _data;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr T* FixedMatrix<T, R, C>::end() noexcept {
+            return _data + R * C;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr const T* FixedMatrix<T, R, C>::end() const noexcept {
+            return _data + R * C;
+        }
+
+        // Static methods
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> FixedMatrix<T, R, C>::zeros() noexcept {
+            return FixedMatrix();
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> FixedMatrix<T, R, C>::ones() noexcept {
+            return constant(T{1});
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> FixedMatrix<T, R, C>::constant(
+            const T& fill_value
+        ) noexcept {
+            FixedMatrix result;
+
+            utils::unroll<R * C>([&](size_t i) { result._data[i] = fill_value; });
+
+            return result;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> FixedMatrix<T, R, C>::identity() noexcept {
+            static_assert(R == C, "FixedMatrix::identity(): matrix must be square");
+
+            FixedMatrix result;
+
+            utils::unroll<R>([&](size_t i) { result._data[i * C + i] = T{1}; });
+
+            return result;
+        }
+    }
+}
@@ -0,0 +1,199 @@
+// core/detail/_FixedVector.ipp
+
+
+namespace vmafu {
+    namespace core {
+        // Constructors
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N>::FixedVector() : _data{} {}
+
+        template <typename T, size_t N>
+        template <typename... Args, typename>
+        constexpr FixedVector<T, N>::FixedVector(const Args&... values)
+        : _data{static_cast<T>(values)...} {}
+
+        template <typename T, size_t N>
+        template <typename Allocator>
+        FixedVector<T, N>::FixedVector(const Vector<T, Allocator>& vector)
+        : FixedVector(vector.view()) {}
+
+        template <typename T, size_t N>
+        template <typename U>
+        FixedVector<T, N>::FixedVector(const VectorView<U>& view) : _data{} {
+            if (view.size() != N) {
+                throw std::invalid_argument(
+                    "FixedVector::FixedVector(): size mismatch"
+                );
+            }
+
+            utils::unroll<N>([&](size_t i) { _data[i] = view[i]; });
+        }
+
+        // Getters
+
+        template <typename T, size_t N>
+        constexpr T* FixedVector<T, N>::data() noexcept {
+            return _data;
+        }
+
+        template <typename T, size_t N>
+        constexpr const T* FixedVector<T, N>::data() const noexcept {
+            return _data;
+        }
+
+        template <typename T, size_t N>
+        constexpr size_t FixedVector<T, N>::size() noexcept {
+            return N;
+        }
+
+        // Access methods
+
+        template <typename T, size_t N>
+        constexpr T& FixedVector<T, N>::operator[](size_t index) noexcept {
+            return _data[index];
+        }
+
+        template <typename T, size_t N>
+        constexpr const T& FixedVector<T, N>::operator[](size_t index) const noexcept {
+            return _data[index];
+        }
+
+        template <typename T, size_t N>
+        constexpr T& FixedVector<T, N>::at(size_t index) {
+            if (index >= N) {
+                throw std::out_of_range("FixedVector::at(): index out of range");
+            }
+
+            return _data[index];
+        }
+
+        template <typename T, size_t N>
+        constexpr const T& FixedVector<T, N>::at(size_t index) const {
+            if (index >= N) {
+                throw std::out_of_range("FixedVector::at(): index out of range");
+            }
+
+            return _data[index];
+        }
+
+        // Compound assignment
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N>& FixedVector<T, N>::operator+=(
+            const FixedVector& other_vector
+        ) noexcept {
+            utils::unroll<N>([&](size_t i) { _data[i] += other_vector._data[i]; });
+
+            return *this;
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N>& FixedVector<T, N>::operator-=(
+            const FixedVector& other_vector
+        ) noexcept {
+            utils::unroll<N>([&](size_t i) { _data[i] -= other_vector._data[i]; });
+
+            return *this;
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N>& FixedVector<T, N>::operator*=(
+            const T& scalar
+        ) noexcept {
+            utils::unroll<N>([&](size_t i) { _data[i] *= scalar; });
+
+            return *this;
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N>& FixedVector<T, N>::operator/=(const T& scalar) {
+            VMAFU_IF_CONSTEXPR (VMAFU_IS_FLOATING_POINT_V(T)) {
+                if ((scalar < T{0} ? -scalar : scalar) < T(1e-10)) {
+                    throw std::invalid_argument(
+                        "FixedVector::operator/=(): Division by zero"
+                    );
+                }
+            } else if (scalar == T{0}) {
+                throw std::invalid_argument(
+                    "FixedVector::operator/=(): Division by zero"
+                );
+            }
+
+            utils::unroll<N>([&](size_t i) { _data[i] /= scalar; });
+
+            return *this;
+        }
+
+        // Conversion methods
+
+        template <typename T, size_t N>
+        VectorView<T> FixedVector<T, N>::view() noexcept {
+            return VectorView<T>(_data, N);
+        }
+
+        template <typename T, size_t N>
+        ConstVectorView<T> FixedVector<T, N>::view() const noexcept {
+            return ConstVectorView<T>(_data, N);
+        }
+
+        template <typename T, size_t N>
+        Vector<T> FixedVector<T, N>::to_vector() const {
+            return Vector<T>(view());
+        }
+
+        // Iterators
+
+        template <typename T, size_t N>
+        constexpr T* FixedVector<T, N>::begin() noexcept {
+            return _data;
+        }
+
+        template <typename T, size_t N>
+        constexpr const T* FixedVector<T, N>::begin() const noexcept {
+            return _data;
+        }
+
+        template <typename T, size_t N>
+        constexpr T* FixedVector<T, N>::end() noexcept {
+            return _data + N;
+        }
+
+        template <typename T, size_t N>
+        constexpr const T* FixedVector<T, N>::end() const noexcept {
+            return _data + N;
+        }
+
+        // Static methods
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> FixedVector<T, N>::zeros() noexcept {
+            return FixedVector();
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> FixedVector<T, N>::ones() noexcept {
+            return constant(T{1});
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> FixedVector<T, N>::constant(
+            const T& fill_value
+        ) noexcept {
+            FixedVector result;
+
+            utils::unroll<N>([&](size_t i) { result._data[i] = fill_value; });
+
+            return result;
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> FixedVector<T, N>::unit(size_t index) noexcept {
+            FixedVector result;
+
+            result._data[index] = T{1};
+
+            return result;
+        }
+    }
+}
@@ -13,6 +13,92 @@ namespace vmafu {
         #define FUNCTION_TYPE_2D Function<ResultT, ArgT1, ArgT2>  
         #define FUNCTION_TYPE_3D Function<ResultT, ArgT1, ArgT2, ArgT3>
 
+        #define INLINE_FUNCTION_TEMPLATE template <typename Callable, typename ResultT, typename... ArgTs>
+        #define INLINE_FUNCTION_TYPE InlineFunction<Callable, ResultT, ArgTs...>
+
+        // Helper methods
+
+        namespace internal {
+            // Minimum number of evaluations per thread, so small batches are
+            // not split across threads
+
+            constexpr size_t APPLY_GRAIN = 4096;
+
+            template <typename ResultT, typename Func, typename ArgT>
+            Vector<ResultT> apply(
+                const Func& func,
+                const Vector<ArgT>& xs,
+                size_t threads
+            ) {
+                Vector<ResultT> result(xs.size(), uninitialized);
+
+                const ArgT* input = xs.data();
+                ResultT* output = result.data();
+
+                utils::parallel_for(
+                    0, xs.size(),
+                    [&func, input, output](size_t first, size_t last) {
+                        for (size_t i = first; i < last; i++) {
+                            output[i] = func(input[i]);
+                        }
+                    },
+                    threads, APPLY_GRAIN
+                );
+
+                return result;
+            }
+
+            template <
+                typename ResultT,
+                typename Func,
+                typename ArgT1,
+                typename ArgT2
+            >
+            Matrix<ResultT> apply(
+                const Func& func,
+                const Vector<ArgT1>& xs,
+                const Vector<ArgT2>& ys,
+                size_t threads
+            ) {
+                size_t rows = xs.size();
+                size_t cols = ys.size();
+
+                Matrix<ResultT> result(rows, cols, uninitialized);
+
+                if (cols == 0) {
+                    return result;
+                }
+
+                const ArgT1* x_data = xs.data();
+                const ArgT2* y_data = ys.data();
+                ResultT* output = result.data();
+
+                // Whole rows per thread; the inner loop is a contiguous
+                // sweep over ys, which the compiler can vectorize once the
+                // callable is inlined
+
+                utils::parallel_for(
+                    0, rows,
+                    [&func, x_data, y_data, output, cols](
+                        size_t first,
+                        size_t last
+                    ) {
+                        for (size_t i = first; i < last; i++) {
+                            const ArgT1 x = x_data[i];
+                            ResultT* row = output + i * cols;
+
+                            for (size_t j = 0; j < cols; j++) {
+                                row[j] = func(x, y_data[j]);
+                            }
+                        }
+                    },
+                    threads, std::max<size_t>(APPLY_GRAIN / cols, 1)
+                );
+
+                return result;
+            }
+        }
+
         // Function 1-d class
 
         // Constructors / Destructor
@@ -69,6 +155,22 @@ namespace vmafu {
             return (*this)(x);
         }
 
+        // Batch methods
+
+        FUNCTION_TEMPLATE_1D
+        Vector<ResultT> FUNCTION_TYPE_1D::apply(
+            const Vector<ArgT>& xs,
+            size_t threads
+        ) const {
+            if (!_func) {
+                throw std::runtime_error(
+                    "Function::apply(): Function not initialized"
+                );
+            }
+
+            return internal::apply<ResultT>(_func, xs, threads);
+        }
+
         // Static methods
 
         FUNCTION_TEMPLATE_1D
@@ -139,6 +241,23 @@ namespace vmafu {
             return (*this)(x, y);
         }
 
+        // Batch methods
+
+        FUNCTION_TEMPLATE_2D
+        Matrix<ResultT> FUNCTION_TYPE_2D::apply(
+            const Vector<ArgT1>& xs,
+            const Vector<ArgT2>& ys,
+            size_t threads
+        ) const {
+            if (!_func) {
+                throw std::runtime_error(
+                    "Function::apply(): Function not initialized"
+                );
+            }
+
+            return internal::apply<ResultT>(_func, xs, ys, threads);
+        }
+
         // Static methods
 
         FUNCTION_TEMPLATE_2D
@@ -225,6 +344,84 @@ namespace vmafu {
             return Function(std::function<ResultT(ArgT1, ArgT2, ArgT3)>(func));
         }
 
+        // Inline function class
+
+        // Constructor
+
+        INLINE_FUNCTION_TEMPLATE
+        INLINE_FUNCTION_TYPE::InlineFunction(
+            Callable func
+        ) : _func(std::move(func)) {}
+
+        // Getter
+
+        INLINE_FUNCTION_TEMPLATE
+        const Callable& INLINE_FUNCTION_TYPE::callable() const noexcept {
+            return _func;
+        }
+
+        // Access methods
+
+        INLINE_FUNCTION_TEMPLATE
+        ResultT INLINE_FUNCTION_TYPE::operator()(ArgTs... args) const {
+            return _func(args...);
+        }
+
+        INLINE_FUNCTION_TEMPLATE
+        ResultT INLINE_FUNCTION_TYPE::at(ArgTs... args) const {
+            return _func(args...);
+        }
+
+        // Batch methods
+
+        INLINE_FUNCTION_TEMPLATE
+        template <typename ArgT>
+        Vector<ResultT> INLINE_FUNCTION_TYPE::apply(
+            const Vector<ArgT>& xs,
+            size_t threads
+        ) const {
+            static_assert(
+                sizeof...(ArgTs) == 1,
+                "InlineFunction::apply(): Vector batch requires a 1-d function"
+            );
+
+            return internal::apply<ResultT>(*this, xs, threads);
+        }
+
+        INLINE_FUNCTION_TEMPLATE
+        template <typename ArgT1, typename ArgT2>
+        Matrix<ResultT> INLINE_FUNCTION_TYPE::apply(
+            const Vector<ArgT1>& xs,
+            const Vector<ArgT2>& ys,
+            size_t threads
+        ) const {
+            static_assert(
+                sizeof...(ArgTs) == 2,
+                "InlineFunction::apply(): Grid batch requires a 2-d function"
+            );
+
+            return internal::apply<ResultT>(*this, xs, ys, threads);
+        }
+
+        // Conversion
+
+        INLINE_FUNCTION_TEMPLATE
+        Function<ResultT, ArgTs...> INLINE_FUNCTION_TYPE::to_function() const {
+            return Function<ResultT, ArgTs...>(
+                std::function<ResultT(ArgTs...)>(_func)
+            );
+        }
+
+        // Factory
+
+        template <typename ResultT, typename... ArgTs, typename Callable>
+        InlineFunction<typename std::decay<Callable>::type, ResultT, ArgTs...>
+        make_function(Callable&& func) {
+            return InlineFunction<
+                typename std::decay<Callable>::type, ResultT, ArgTs...
+            >(std::forward<Callable>(func));
+        }
+
         // Undef for internal-use only
 
         #undef FUNCTION_TEMPLATE_1D
@@ -233,5 +430,7 @@ namespace vmafu {
         #undef FUNCTION_TYPE_1D
         #undef FUNCTION_TYPE_2D
         #undef FUNCTION_TYPE_3D
+        #undef INLINE_FUNCTION_TEMPLATE
+        #undef INLINE_FUNCTION_TYPE
     }
 }
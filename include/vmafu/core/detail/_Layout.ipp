@@ -0,0 +1,68 @@
+// core/detail/_Layout.ipp
+
+
+namespace vmafu {
+    namespace core {
+        // Row-major layout
+
+        inline size_t RowMajor::storage_size(size_t rows, size_t cols) noexcept {
+            return rows * cols;
+        }
+
+        inline size_t RowMajor::index(
+            size_t row,
+            size_t col,
+            size_t,
+            size_t cols
+        ) noexcept {
+            return row * cols + col;
+        }
+
+        // Column-major layout
+
+        inline size_t ColumnMajor::storage_size(size_t rows, size_t cols) noexcept {
+            return rows * cols;
+        }
+
+        inline size_t ColumnMajor::index(
+            size_t row,
+            size_t col,
+            size_t rows,
+            size_t
+        ) noexcept {
+            return col * rows + row;
+        }
+
+        // Tile-major layout
+
+        template <size_t TileSize>
+        size_t TileMajor<TileSize>::tile_count(size_t extent) noexcept {
+            return (extent + TileSize - 1) / TileSize;
+        }
+
+        template <size_t TileSize>
+        size_t TileMajor<TileSize>::storage_size(size_t rows, size_t cols) noexcept {
+            return tile_count(rows) * tile_count(cols) * TILE_ELEMENTS;
+        }
+
+        template <size_t TileSize>
+        size_t TileMajor<TileSize>::index(
+            size_t row,
+            size_t col,
+            size_t,
+            size_t cols
+        ) noexcept {
+            return tile_offset(row / TileSize, col / TileSize, cols) + \
+                (row % TileSize) * TileSize + col % TileSize;
+        }
+
+        template <size_t TileSize>
+        size_t TileMajor<TileSize>::tile_offset(
+            size_t tile_row,
+            size_t tile_col,
+            size_t cols
+        ) noexcept {
+            return (tile_row * tile_count(cols) + tile_col) * TILE_ELEMENTS;
+        }
+    }
+}
@@ -5,41 +5,123 @@ namespace vmafu {
     namespace core {
         // Helper methods ( memory managment )
 
-        template <typename T>
-        void Matrix<T>::_allocate(size_t n) {
-            if (n) {
-                _data = new T[n]();
-            }
+        template <typename T, typename Allocator, typename Layout>
+        void Matrix<T, Allocator, Layout>::_allocate(size_t n, bool initialize) {
+            _data = allocate_storage<T, Allocator>(n, initialize);
         }
 
-        template <typename T>
-        void Matrix<T>::_deallocate() noexcept {
-            delete[] _data;
+        template <typename T, typename Allocator, typename Layout>
+        void Matrix<T, Allocator, Layout>::_deallocate() noexcept {
+            deallocate_storage<T, Allocator>(
+                _data, Layout::storage_size(_rows, _cols)
+            );
             _data = nullptr;
         }
 
+        template <typename T, typename Allocator, typename Layout>
+        template <typename OtherAllocator, typename OtherLayout>
+        void Matrix<T, Allocator, Layout>::block_copy(
+            const Matrix<T, OtherAllocator, OtherLayout>& source,
+            size_t rows,
+            size_t cols
+        ) {
+            VMAFU_IF_CONSTEXPR (
+                VMAFU_IS_SAME_V(Layout, RowMajor) && \
+                VMAFU_IS_SAME_V(OtherLayout, RowMajor)
+            ) {
+                for (size_t i = 0; i < rows; i++) {
+                    const T* source_row = source._data + i * source._cols;
+
+                    std::copy(source_row, source_row + cols, _data + i * _cols);
+                }
+            } else {
+                // BLOCK x BLOCK blocks keep both sides cache resident when
+                // the layouts disagree ( e.g. a transposing copy )
+
+                constexpr size_t BLOCK = 32;
+
+                for (size_t ii = 0; ii < rows; ii += BLOCK) {
+                    size_t i_end = std::min(rows, ii + BLOCK);
+
+                    for (size_t jj = 0; jj < cols; jj += BLOCK) {
+                        size_t j_end = std::min(cols, jj + BLOCK);
+
+                        for (size_t i = ii; i < i_end; i++) {
+                            for (size_t j = jj; j < j_end; j++) {
+                                (*this)(i, j) = source(i, j);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        template <typename Expression>
+        void Matrix<T, Allocator, Layout>::_evaluate(const Expression& expression) {
+            // One fused pass, linear when the expression shares this layout;
+            // element (i, j) only reads element (i, j) of the operands, so
+            // evaluating into an operand is safe
+
+            VMAFU_IF_CONSTEXPR (
+                VMAFU_IS_SAME_V(typename Expression::layout_type, Layout) && \
+                !is_tiled<Layout>::value
+            ) {
+                for (size_t i = 0; i < _rows * _cols; i++) {
+                    _data[i] = expression[i];
+                }
+            } else {
+                for (size_t i = 0; i < _rows; i++) {
+                    for (size_t j = 0; j < _cols; j++) {
+                        (*this)(i, j) = expression(i, j);
+                    }
+                }
+            }
+        }
+
         // Constructors / Destructor
 
-        template <typename T>
-        Matrix<T>::Matrix() = default;
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>::Matrix() = default;
 
-        template <typename T>
-        Matrix<T>::Matrix(
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>::Matrix(
             size_t rows,
             size_t cols
         ) : _rows(rows), _cols(cols) {
-            _allocate(_rows * _cols);
+            _allocate(Layout::storage_size(_rows, _cols));
         }
 
-        template <typename T>
-        Matrix<T>::Matrix(size_t rows, size_t cols, const T& init_value) 
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>::Matrix(
+            size_t rows,
+            size_t cols,
+            uninitialized_t
+        ) : _rows(rows), _cols(cols) {
+            // Padding of tiled layouts stays zero, so only it is initialized
+
+            _allocate(Layout::storage_size(_rows, _cols), is_tiled<Layout>::value);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>::Matrix(size_t rows, size_t cols, const T& init_value) 
         : _rows(rows), _cols(cols) {
-            _allocate(_rows * _cols);
-            std::fill(_data, _data + _rows * _cols, init_value);
+            VMAFU_IF_CONSTEXPR (is_tiled<Layout>::value) {
+                _allocate(Layout::storage_size(_rows, _cols));
+
+                for (size_t i = 0; i < _rows; i++) {
+                    for (size_t j = 0; j < _cols; j++) {
+                        (*this)(i, j) = init_value;
+                    }
+                }
+            } else {
+                _allocate(Layout::storage_size(_rows, _cols), false);
+                std::fill(_data, _data + storage_size(), init_value);
+            }
         }
 
-        template <typename T>
-        Matrix<T>::Matrix(
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>::Matrix(
             std::initializer_list<std::initializer_list<T>> init_list
         ) {
             _rows = init_list.size();
@@ -47,7 +129,7 @@ namespace vmafu {
             if (_rows > 0) {
                 _cols = init_list.begin()->size();
 
-                _allocate(_rows * _cols);
+                _allocate(Layout::storage_size(_rows, _cols), is_tiled<Layout>::value);
 
                 size_t i = 0;
 
@@ -61,7 +143,11 @@ namespace vmafu {
                     }
 
                     try {
-                        std::copy(row.begin(), row.end(), _data + i * _cols);
+                        size_t j = 0;
+
+                        for (const auto& value : row) {
+                            (*this)(i, j++) = value;
+                        }
                     } catch (...) {
                         _deallocate();
 
@@ -73,77 +159,120 @@ namespace vmafu {
             }
         }
 
-        template <typename T>
-        Matrix<T>::~Matrix() {
+        template <typename T, typename Allocator, typename Layout>
+        template <typename U>
+        Matrix<T, Allocator, Layout>::Matrix(const MatrixView<U>& view)
+        : _rows(view.rows()), _cols(view.cols()) {
+            _allocate(Layout::storage_size(_rows, _cols), is_tiled<Layout>::value);
+
+            try {
+                VMAFU_IF_CONSTEXPR (VMAFU_IS_SAME_V(Layout, RowMajor)) {
+                    this->view().copy_from(view);
+                } else {
+                    for (size_t i = 0; i < _rows; i++) {
+                        for (size_t j = 0; j < _cols; j++) {
+                            (*this)(i, j) = view(i, j);
+                        }
+                    }
+                }
+            } catch (...) {
+                _deallocate();
+
+                throw;
+            }
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        template <typename OtherAllocator, typename OtherLayout>
+        Matrix<T, Allocator, Layout>::Matrix(
+            const Matrix<T, OtherAllocator, OtherLayout>& other_matrix
+        ) : _rows(other_matrix.rows()), _cols(other_matrix.cols()) {
+
+            _allocate(Layout::storage_size(_rows, _cols), is_tiled<Layout>::value);
+
+            block_copy(other_matrix, _rows, _cols);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        template <typename Expression>
+        Matrix<T, Allocator, Layout>::Matrix(
+            const MatrixExpression<Expression>& expression
+        ) : _rows(expression.derived().rows()), _cols(expression.derived().cols()) {
+            _allocate(Layout::storage_size(_rows, _cols), is_tiled<Layout>::value);
+
+            try {
+                _evaluate(expression.derived());
+            } catch (...) {
+                _deallocate();
+
+                throw;
+            }
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>::~Matrix() {
             _deallocate();
         }
 
         // Getters
 
-        template <typename T>
-        T* Matrix<T>::data() noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        T* Matrix<T, Allocator, Layout>::data() noexcept {
             return _data;
         }
 
-        template <typename T>
-        const T* Matrix<T>::data() const noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        const T* Matrix<T, Allocator, Layout>::data() const noexcept {
             return _data;
         }
 
-        template <typename T>
-        size_t Matrix<T>::rows() const noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        size_t Matrix<T, Allocator, Layout>::rows() const noexcept {
             return _rows;
         }
 
-        template <typename T>
-        size_t Matrix<T>::cols() const noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        size_t Matrix<T, Allocator, Layout>::cols() const noexcept {
             return _cols;
         }
 
-        template <typename T>
-        size_t Matrix<T>::size() const noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        size_t Matrix<T, Allocator, Layout>::size() const noexcept {
             return _rows * _cols;
         }
 
+        template <typename T, typename Allocator, typename Layout>
+        size_t Matrix<T, Allocator, Layout>::storage_size() const noexcept {
+            return Layout::storage_size(_rows, _cols);
+        }
+
         // Setters ( memory managment )
 
-        template <typename T>
-        void Matrix<T>::swap(Matrix& other_matrix) noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        void Matrix<T, Allocator, Layout>::swap(Matrix& other_matrix) noexcept {
             std::swap(_data, other_matrix._data);
             std::swap(_rows, other_matrix._rows);
             std::swap(_cols, other_matrix._cols);
         }
 
-        template <typename T>
-        void Matrix<T>::resize(size_t new_rows, size_t new_cols) {
+        template <typename T, typename Allocator, typename Layout>
+        void Matrix<T, Allocator, Layout>::resize(size_t new_rows, size_t new_cols) {
             if (new_rows == _rows && new_cols == _cols) {
                 return;
             }
 
-            T* new_data = nullptr;
-            
-            if (new_rows > 0 && new_cols > 0) {
-                new_data = new T[new_rows * new_cols]();
-
-                size_t min_rows = std::min(_rows, new_rows);
-                size_t min_cols = std::min(_cols, new_cols);
+            Matrix temp(new_rows, new_cols);
 
-                for (size_t i = 0; i < min_rows; i++) {
-                    for (size_t j = 0; j < min_cols; j++) {
-                        new_data[i * new_cols + j] = _data[i * _cols + j];
-                    }
-                }
-            }
+            size_t min_rows = std::min(_rows, new_rows);
+            size_t min_cols = std::min(_cols, new_cols);
 
-            _deallocate();
+            temp.block_copy(*this, min_rows, min_cols);
 
-            _data = new_data;
-            _rows = new_rows;
-            _cols = new_cols;
+            swap(temp);
         }
 
-        template <typename T>
-        void Matrix<T>::resize(
+        template <typename T, typename Allocator, typename Layout>
+        void Matrix<T, Allocator, Layout>::resize(
             size_t new_rows,
             size_t new_cols,
             const T& fill_value
@@ -152,49 +281,29 @@ namespace vmafu {
                 return;
             }
 
-            T* new_data = nullptr;
-
-            if (new_rows > 0 && new_cols > 0) {
-                new_data = new T[new_rows * new_cols];
-
-                size_t min_rows = std::min(_rows, new_rows);
-                size_t min_cols = std::min(_cols, new_cols);
-
-                for (size_t i = 0; i < min_rows; i++) {
-                    for (size_t j = 0; j < min_cols; j++) {
-                        new_data[i * new_cols + j] = _data[i * _cols + j];
-                    }
-                }
+            Matrix temp(new_rows, new_cols, fill_value);
 
-                for (size_t i = 0; i < new_rows; i++) {
-                    for (size_t j = 0; j < new_cols; j++) {
-                        if (i >= _rows || j >= _cols) {
-                            new_data[i * new_cols + j] = fill_value;
-                        }
-                    }
-                }
-            }
+            size_t min_rows = std::min(_rows, new_rows);
+            size_t min_cols = std::min(_cols, new_cols);
 
-            _deallocate();
+            temp.block_copy(*this, min_rows, min_cols);
 
-            _data = new_data;
-            _rows = new_rows;
-            _cols = new_cols;
+            swap(temp);
         }
 
         // Copy / Move operators
 
-        template <typename T>
-        Matrix<T>::Matrix(const Matrix& other_matrix)
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>::Matrix(const Matrix& other_matrix)
         : _rows(other_matrix._rows), _cols(other_matrix._cols) {
-            _allocate(_rows * _cols);
+            _allocate(other_matrix.storage_size(), false);
             std::copy(
-                other_matrix._data, other_matrix._data + _rows * _cols, _data
+                other_matrix._data, other_matrix._data + other_matrix.storage_size(), _data
             );
         }
 
-        template <typename T>
-        Matrix<T>::Matrix(Matrix&& other_matrix) noexcept
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>::Matrix(Matrix&& other_matrix) noexcept
         : _data(other_matrix._data), _rows(other_matrix._rows), \
           _cols(other_matrix._cols) {
             other_matrix._data = nullptr;
@@ -202,8 +311,8 @@ namespace vmafu {
             other_matrix._cols = 0;
         }
 
-        template <typename T>
-        Matrix<T>& Matrix<T>::operator=(const Matrix& other_matrix) {
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>& Matrix<T, Allocator, Layout>::operator=(const Matrix& other_matrix) {
             if (this != &other_matrix) {
                 Matrix temp(other_matrix);
                 swap(temp);
@@ -212,8 +321,8 @@ namespace vmafu {
             return *this;
         }
 
-        template <typename T>
-        Matrix<T>& Matrix<T>::operator=(Matrix&& other_matrix) noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>& Matrix<T, Allocator, Layout>::operator=(Matrix&& other_matrix) noexcept {
             if (this != &other_matrix) {
                 _deallocate();
 
@@ -229,72 +338,290 @@ namespace vmafu {
             return *this;
         }
 
+        template <typename T, typename Allocator, typename Layout>
+        template <typename Expression>
+        Matrix<T, Allocator, Layout>& Matrix<T, Allocator, Layout>::operator=(
+            const MatrixExpression<Expression>& expression
+        ) {
+            if (
+                expression.derived().rows() == _rows && \
+                expression.derived().cols() == _cols
+            ) {
+                _evaluate(expression.derived());
+            } else {
+                Matrix temp(expression);
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        // Compound assignment ( in place, no allocation )
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>& Matrix<T, Allocator, Layout>::operator+=(
+            const Matrix& other_matrix
+        ) {
+            if (other_matrix._rows != _rows || other_matrix._cols != _cols) {
+                throw std::invalid_argument(
+                    "Matrix::operator+=(): Matrix dimensions must match"
+                );
+            }
+
+            // Same layout, so the storage lines up ( zero padding included )
+
+            for (size_t i = 0; i < storage_size(); i++) {
+                _data[i] += other_matrix._data[i];
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>& Matrix<T, Allocator, Layout>::operator-=(
+            const Matrix& other_matrix
+        ) {
+            if (other_matrix._rows != _rows || other_matrix._cols != _cols) {
+                throw std::invalid_argument(
+                    "Matrix::operator-=(): Matrix dimensions must match"
+                );
+            }
+
+            // Same layout, so the storage lines up ( zero padding included )
+
+            for (size_t i = 0; i < storage_size(); i++) {
+                _data[i] -= other_matrix._data[i];
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        template <typename Expression>
+        Matrix<T, Allocator, Layout>& Matrix<T, Allocator, Layout>::operator+=(
+            const MatrixExpression<Expression>& expression
+        ) {
+            const Expression& source = expression.derived();
+
+            if (source.rows() != _rows || source.cols() != _cols) {
+                throw std::invalid_argument(
+                    "Matrix::operator+=(): Matrix dimensions must match"
+                );
+            }
+
+            VMAFU_IF_CONSTEXPR (
+                VMAFU_IS_SAME_V(typename Expression::layout_type, Layout) && \
+                !is_tiled<Layout>::value
+            ) {
+                for (size_t i = 0; i < _rows * _cols; i++) {
+                    _data[i] += source[i];
+                }
+            } else {
+                for (size_t i = 0; i < _rows; i++) {
+                    for (size_t j = 0; j < _cols; j++) {
+                        (*this)(i, j) += source(i, j);
+                    }
+                }
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        template <typename Expression>
+        Matrix<T, Allocator, Layout>& Matrix<T, Allocator, Layout>::operator-=(
+            const MatrixExpression<Expression>& expression
+        ) {
+            const Expression& source = expression.derived();
+
+            if (source.rows() != _rows || source.cols() != _cols) {
+                throw std::invalid_argument(
+                    "Matrix::operator-=(): Matrix dimensions must match"
+                );
+            }
+
+            VMAFU_IF_CONSTEXPR (
+                VMAFU_IS_SAME_V(typename Expression::layout_type, Layout) && \
+                !is_tiled<Layout>::value
+            ) {
+                for (size_t i = 0; i < _rows * _cols; i++) {
+                    _data[i] -= source[i];
+                }
+            } else {
+                for (size_t i = 0; i < _rows; i++) {
+                    for (size_t j = 0; j < _cols; j++) {
+                        (*this)(i, j) -= source(i, j);
+                    }
+                }
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>& Matrix<T, Allocator, Layout>::operator*=(
+            const T& scalar
+        ) {
+            for (size_t i = 0; i < storage_size(); i++) {
+                _data[i] *= scalar;
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout>& Matrix<T, Allocator, Layout>::operator/=(
+            const T& scalar
+        ) {
+            VMAFU_IF_CONSTEXPR (VMAFU_IS_FLOATING_POINT_V(T)) {
+                if (std::abs(scalar) < 1e-10) {
+                    throw std::invalid_argument(
+                        "Matrix::operator/=(): Division by zero"
+                    );
+                }
+            } else {
+                if (scalar == T{0}) {
+                    throw std::invalid_argument(
+                        "Matrix::operator/=(): Division by zero"
+                    );
+                }
+            }
+
+            for (size_t i = 0; i < storage_size(); i++) {
+                _data[i] /= scalar;
+            }
+
+            return *this;
+        }
+
         // Access methods
 
-        template <typename T>
-        T& Matrix<T>::operator()(size_t row, size_t col) noexcept {
-            return _data[row * _cols + col];
+        template <typename T, typename Allocator, typename Layout>
+        T& Matrix<T, Allocator, Layout>::operator()(size_t row, size_t col) noexcept {
+            return _data[Layout::index(row, col, _rows, _cols)];
         }
 
-        template <typename T>
-        const T& Matrix<T>::operator()(size_t row, size_t col) const noexcept {
-            return _data[row * _cols + col];
+        template <typename T, typename Allocator, typename Layout>
+        const T& Matrix<T, Allocator, Layout>::operator()(size_t row, size_t col) const noexcept {
+            return _data[Layout::index(row, col, _rows, _cols)];
         }
 
-        template <typename T>
-        T& Matrix<T>::operator[](size_t index) noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        T& Matrix<T, Allocator, Layout>::operator[](size_t index) noexcept {
             return _data[index];
         }
 
-        template <typename T>
-        const T& Matrix<T>::operator[](size_t index) const noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        const T& Matrix<T, Allocator, Layout>::operator[](size_t index) const noexcept {
             return _data[index];
         }
 
-        template <typename T>
-        T& Matrix<T>::at(size_t row, size_t col) {
+        template <typename T, typename Allocator, typename Layout>
+        T& Matrix<T, Allocator, Layout>::at(size_t row, size_t col) {
             if (row >= _rows || col >= _cols) {
                 throw std::out_of_range("Matrix::at(): index out of range");
             }
 
-            return _data[row * _cols + col];
+            return _data[Layout::index(row, col, _rows, _cols)];
         }
 
-        template <typename T>
-        const T& Matrix<T>::at(size_t row, size_t col) const {
+        template <typename T, typename Allocator, typename Layout>
+        const T& Matrix<T, Allocator, Layout>::at(size_t row, size_t col) const {
             if (row >= _rows || col >= _cols) {
                 throw std::out_of_range("Matrix::at(): index out of range");
             }
 
-            return _data[row * _cols + col];
+            return _data[Layout::index(row, col, _rows, _cols)];
+        }
+
+        // View methods
+
+        template <typename T, typename Allocator, typename Layout>
+        MatrixView<T> Matrix<T, Allocator, Layout>::view() noexcept {
+            static_assert(
+                VMAFU_IS_SAME_V(Layout, RowMajor),
+                "Matrix::view(): views require RowMajor storage"
+            );
+
+            return MatrixView<T>(_data, _rows, _cols);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        ConstMatrixView<T> Matrix<T, Allocator, Layout>::view() const noexcept {
+            static_assert(
+                VMAFU_IS_SAME_V(Layout, RowMajor),
+                "Matrix::view(): views require RowMajor storage"
+            );
+
+            return ConstMatrixView<T>(_data, _rows, _cols);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        MatrixView<T> Matrix<T, Allocator, Layout>::block(
+            size_t row,
+            size_t col,
+            size_t rows,
+            size_t cols
+        ) {
+            return view().block(row, col, rows, cols);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        ConstMatrixView<T> Matrix<T, Allocator, Layout>::block(
+            size_t row,
+            size_t col,
+            size_t rows,
+            size_t cols
+        ) const {
+            return view().block(row, col, rows, cols);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        VectorView<T> Matrix<T, Allocator, Layout>::row(size_t row) {
+            return view().row(row);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        ConstVectorView<T> Matrix<T, Allocator, Layout>::row(size_t row) const {
+            return view().row(row);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        VectorView<T> Matrix<T, Allocator, Layout>::col(size_t col) {
+            return view().col(col);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        ConstVectorView<T> Matrix<T, Allocator, Layout>::col(size_t col) const {
+            return view().col(col);
         }
 
         // Iterators
 
-        template <typename T>
-        T* Matrix<T>::begin() noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        T* Matrix<T, Allocator, Layout>::begin() noexcept {
             return _data;
         }
 
-        template <typename T>
-        const T* Matrix<T>::begin() const noexcept {
+        template <typename T, typename Allocator, typename Layout>
+        const T* Matrix<T, Allocator, Layout>::begin() const noexcept {
             return _data;
         }
 
-        template <typename T>
-        T* Matrix<T>::end() noexcept {
-            return _data + _rows * _cols;
+        template <typename T, typename Allocator, typename Layout>
+        T* Matrix<T, Allocator, Layout>::end() noexcept {
+            return _data + storage_size();
         }
 
-        template <typename T>
-        const T* Matrix<T>::end() const noexcept {
-            return _data + _rows * _cols;
+        template <typename T, typename Allocator, typename Layout>
+        const T* Matrix<T, Allocator, Layout>::end() const noexcept {
+            return _data + storage_size();
         }
 
         // Static methods
 
-        template <typename T>
-        Matrix<T> Matrix<T>::identity(size_t n) {
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout> Matrix<T, Allocator, Layout>::identity(size_t n) {
             Matrix result(n, n);
             for (size_t i = 0; i < n; i++) {
                 result(i, i) = T{1};
@@ -303,18 +630,18 @@ namespace vmafu {
             return result;
         }
 
-        template <typename T>
-        Matrix<T> Matrix<T>::zeros(size_t rows, size_t cols) {
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout> Matrix<T, Allocator, Layout>::zeros(size_t rows, size_t cols) {
             return Matrix(rows, cols);
         }
 
-        template <typename T>
-        Matrix<T> Matrix<T>::ones(size_t rows, size_t cols) {
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout> Matrix<T, Allocator, Layout>::ones(size_t rows, size_t cols) {
             return Matrix(rows, cols, T{1});
         }
 
-        template <typename T>
-        Matrix<T> Matrix<T>::constant(
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout> Matrix<T, Allocator, Layout>::constant(
             size_t rows,
             size_t cols,
             const T& fill_value
@@ -322,8 +649,8 @@ namespace vmafu {
             return Matrix(rows, cols, fill_value);
         }
 
-        template <typename T>
-        Matrix<T> Matrix<T>::from_function(
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout> Matrix<T, Allocator, Layout>::from_function(
             size_t rows,
             size_t cols,
             T (*func)(T, T)
@@ -337,5 +664,24 @@ namespace vmafu {
 
             return result;
         }
+
+        template <typename T, typename Allocator, typename Layout>
+        template <typename Func>
+        Matrix<T, Allocator, Layout> Matrix<T, Allocator, Layout>::from_function(
+            size_t rows,
+            size_t cols,
+            const Func& func
+        ) {
+            Matrix result(rows, cols);
+            for (size_t i = 0; i < rows; i++) {
+                const T x = static_cast<T>(i);
+
+                for (size_t j = 0; j < cols; j++) {
+                    result(i, j) = func(x, static_cast<T>(j));
+                }
+            }
+
+            return result;
+        }
     }
 }
@@ -0,0 +1,151 @@
+// core/detail/_MatrixView.ipp
+
+
+namespace vmafu {
+    namespace core {
+        // Constructors
+
+        template <typename T>
+        MatrixView<T>::MatrixView(
+            T* data,
+            size_t rows,
+            size_t cols
+        ) noexcept : _data(data), _rows(rows), _cols(cols), _ld(cols) {}
+
+        template <typename T>
+        MatrixView<T>::MatrixView(
+            T* data,
+            size_t rows,
+            size_t cols,
+            size_t leading_dimension
+        ) noexcept : _data(data), _rows(rows), _cols(cols), \
+          _ld(leading_dimension) {}
+
+        template <typename T>
+        template <typename U, typename>
+        MatrixView<T>::MatrixView(const MatrixView<U>& other_view) noexcept
+        : _data(other_view.data()), _rows(other_view.rows()), \
+          _cols(other_view.cols()), _ld(other_view.leading_dimension()) {}
+
+        // Getters
+
+        template <typename T>
+        T* MatrixView<T>::data() const noexcept {
+            return _data;
+        }
+
+        template <typename T>
+        size_t MatrixView<T>::rows() const noexcept {
+            return _rows;
+        }
+
+        template <typename T>
+        size_t MatrixView<T>::cols() const noexcept {
+            return _cols;
+        }
+
+        template <typename T>
+        size_t MatrixView<T>::leading_dimension() const noexcept {
+            return _ld;
+        }
+
+        template <typename T>
+        size_t MatrixView<T>::size() const noexcept {
+            return _rows * _cols;
+        }
+
+        template <typename T>
+        bool MatrixView<T>::is_contiguous() const noexcept {
+            return _ld == _cols || _rows <= 1;
+        }
+
+        // Access methods
+
+        template <typename T>
+        T& MatrixView<T>::operator()(size_t row, size_t col) const noexcept {
+            return _data[row * _ld + col];
+        }
+
+        template <typename T>
+        T& MatrixView<T>::at(size_t row, size_t col) const {
+            if (row >= _rows || col >= _cols) {
+                throw std::out_of_range("MatrixView::at(): index out of range");
+            }
+
+            return _data[row * _ld + col];
+        }
+
+        // Slicing methods
+
+        template <typename T>
+        MatrixView<T> MatrixView<T>::block(
+            size_t row,
+            size_t col,
+            size_t rows,
+            size_t cols
+        ) const {
+            if (row > _rows || rows > _rows - row || col > _cols || cols > _cols - col) {
+                throw std::out_of_range(
+                    "MatrixView::block(): block out of range"
+                );
+            }
+
+            return MatrixView(_data + row * _ld + col, rows, cols, _ld);
+        }
+
+        template <typename T>
+        VectorView<T> MatrixView<T>::row(size_t row) const {
+            if (row >= _rows) {
+                throw std::out_of_range("MatrixView::row(): row out of range");
+            }
+
+            return VectorView<T>(_data + row * _ld, _cols, 1);
+        }
+
+        template <typename T>
+        VectorView<T> MatrixView<T>::col(size_t col) const {
+            if (col >= _cols) {
+                throw std::out_of_range("MatrixView::col(): col out of range");
+            }
+
+            return VectorView<T>(_data + col, _rows, _ld);
+        }
+
+        // Assignment methods
+
+        template <typename T>
+        void MatrixView<T>::fill(const value_type& value) const {
+            if (is_contiguous()) {
+                std::fill(_data, _data + size(), value);
+
+                return;
+            }
+
+            for (size_t i = 0; i < _rows; i++) {
+                std::fill(_data + i * _ld, _data + i * _ld + _cols, value);
+            }
+        }
+
+        template <typename T>
+        template <typename U>
+        void MatrixView<T>::copy_from(const MatrixView<U>& source) const {
+            if (source.rows() != _rows || source.cols() != _cols) {
+                throw std::invalid_argument(
+                    "MatrixView::copy_from(): dimensions must match"
+                );
+            }
+
+            if (is_contiguous() && source.is_contiguous()) {
+                std::copy(source.data(), source.data() + size(), _data);
+
+                return;
+            }
+
+            for (size_t i = 0; i < _rows; i++) {
+                const auto* source_row = source.data() + i * source.leading_dimension();
+
+                std::copy(source_row, source_row + _cols, _data + i * _ld);
+            }
+        }
+    }
+}
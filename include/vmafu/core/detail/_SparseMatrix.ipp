@@ -0,0 +1,345 @@
+// core/detail/_SparseMatrix.ipp
+
+
+namespace vmafu {
+    namespace core {
+        // Constructors
+
+        template <typename T>
+        SparseMatrix<T>::SparseMatrix() : _row_ptr(1, 0) {}
+
+        template <typename T>
+        SparseMatrix<T>::SparseMatrix(
+            size_t rows,
+            size_t cols
+        ) : _rows(rows), _cols(cols), _row_ptr(rows + 1, 0) {}
+
+        template <typename T>
+        SparseMatrix<T>::SparseMatrix(
+            size_t rows,
+            size_t cols,
+            std::vector<size_t> row_ptr,
+            std::vector<size_t> col_indices,
+            std::vector<T> values
+        ) : _rows(rows),
+            _cols(cols),
+            _row_ptr(std::move(row_ptr)),
+            _col_indices(std::move(col_indices)),
+            _values(std::move(values)) {
+            if (_row_ptr.size() != _rows + 1) {
+                throw std::invalid_argument(
+                    "SparseMatrix::SparseMatrix(): row_ptr must have rows + 1 entries"
+                );
+            }
+
+            if (
+                _col_indices.size() != _values.size() || \
+                _row_ptr.front() != 0 || \
+                _row_ptr.back() != _values.size()
+            ) {
+                throw std::invalid_argument(
+                    "SparseMatrix::SparseMatrix(): Inconsistent CSR arrays"
+                );
+            }
+
+            for (size_t i = 0; i < _rows; i++) {
+                if (_row_ptr[i] > _row_ptr[i + 1]) {
+                    throw std::invalid_argument(
+                        "SparseMatrix::SparseMatrix(): row_ptr must be non-decreasing"
+                    );
+                }
+            }
+
+            for (size_t col : _col_indices) {
+                if (col >= _cols) {
+                    throw std::out_of_range(
+                        "SparseMatrix::SparseMatrix(): Column index out of range"
+                    );
+                }
+            }
+        }
+
+        // Getters
+
+        template <typename T>
+        size_t SparseMatrix<T>::rows() const noexcept {
+            return _rows;
+        }
+
+        template <typename T>
+        size_t SparseMatrix<T>::cols() const noexcept {
+            return _cols;
+        }
+
+        template <typename T>
+        size_t SparseMatrix<T>::nnz() const noexcept {
+            return _values.size();
+        }
+
+        template <typename T>
+        const std::vector<size_t>& SparseMatrix<T>::row_ptr() const noexcept {
+            return _row_ptr;
+        }
+
+        template <typename T>
+        const std::vector<size_t>& SparseMatrix<T>::col_indices() const noexcept {
+            return _col_indices;
+        }
+
+        template <typename T>
+        std::vector<T>& SparseMatrix<T>::values() noexcept {
+            return _values;
+        }
+
+        template <typename T>
+        const std::vector<T>& SparseMatrix<T>::values() const noexcept {
+            return _values;
+        }
+
+        // Access methods
+
+        template <typename T>
+        T SparseMatrix<T>::at(size_t row, size_t col) const {
+            if (row >= _rows || col >= _cols) {
+                throw std::out_of_range("SparseMatrix::at(): Index out of range");
+            }
+
+            auto first = _col_indices.begin() + _row_ptr[row];
+            auto last = _col_indices.begin() + _row_ptr[row + 1];
+
+            auto it = std::lower_bound(first, last, col);
+
+            if (it != last && *it == col) {
+                return _values[it - _col_indices.begin()];
+            }
+
+            return T();
+        }
+
+        // In-place operations
+
+        template <typename T>
+        SparseMatrix<T>& SparseMatrix<T>::operator*=(const T& scalar) {
+            for (T& value : _values) {
+                value *= scalar;
+            }
+
+            return *this;
+        }
+
+        // Conversion methods
+
+        template <typename T>
+        Matrix<T> SparseMatrix<T>::to_dense() const {
+            Matrix<T> result(_rows, _cols);
+
+            for (size_t i = 0; i < _rows; i++) {
+                for (size_t k = _row_ptr[i]; k < _row_ptr[i + 1]; k++) {
+                    result(i, _col_indices[k]) = _values[k];
+                }
+            }
+
+            return result;
+        }
+
+        template <typename T>
+        CooMatrix<T> SparseMatrix<T>::to_coo() const {
+            CooMatrix<T> result;
+
+            result.rows = _rows;
+            result.cols = _cols;
+            result.row_indices.reserve(nnz());
+            result.col_indices = _col_indices;
+            result.values = _values;
+
+            for (size_t i = 0; i < _rows; i++) {
+                result.row_indices.insert(
+                    result.row_indices.end(), _row_ptr[i + 1] - _row_ptr[i], i
+                );
+            }
+
+            return result;
+        }
+
+        template <typename T>
+        CscMatrix<T> SparseMatrix<T>::to_csc() const {
+            // CSC of A has the same arrays as CSR of A^T
+
+            SparseMatrix transposed = transpose();
+
+            CscMatrix<T> result;
+
+            result.rows = _rows;
+            result.cols = _cols;
+            result.col_ptr = std::move(transposed._row_ptr);
+            result.row_indices = std::move(transposed._col_indices);
+            result.values = std::move(transposed._values);
+
+            return result;
+        }
+
+        template <typename T>
+        SparseMatrix<T> SparseMatrix<T>::transpose() const {
+            // Counting sort by column; rows are visited in order, so each
+            // output row comes out sorted by column
+
+            std::vector<size_t> row_ptr(_cols + 1, 0);
+
+            for (size_t col : _col_indices) {
+                row_ptr[col + 1]++;
+            }
+
+            std::partial_sum(row_ptr.begin(), row_ptr.end(), row_ptr.begin());
+
+            std::vector<size_t> next(row_ptr.begin(), row_ptr.end() - 1);
+            std::vector<size_t> col_indices(nnz());
+            std::vector<T> values(nnz());
+
+            for (size_t i = 0; i < _rows; i++) {
+                for (size_t k = _row_ptr[i]; k < _row_ptr[i + 1]; k++) {
+                    size_t position = next[_col_indices[k]]++;
+
+                    col_indices[position] = i;
+                    values[position] = _values[k];
+                }
+            }
+
+            return SparseMatrix(
+                _cols, _rows,
+                std::move(row_ptr),
+                std::move(col_indices),
+                std::move(values)
+            );
+        }
+
+        // Static methods
+
+        template <typename T>
+        SparseMatrix<T> SparseMatrix<T>::from_triplets(
+            size_t rows,
+            size_t cols,
+            const std::vector<size_t>& row_indices,
+            const std::vector<size_t>& col_indices,
+            const std::vector<T>& values
+        ) {
+            if (
+                row_indices.size() != values.size() || \
+                col_indices.size() != values.size()
+            ) {
+                throw std::invalid_argument(
+                    "SparseMatrix::from_triplets(): Triplet arrays must have the same size"
+                );
+            }
+
+            // Counting sort by row, then sort each row by column and
+            // sum duplicate entries
+
+            std::vector<size_t> counts(rows + 1, 0);
+
+            for (size_t k = 0; k < values.size(); k++) {
+                if (row_indices[k] >= rows || col_indices[k] >= cols) {
+                    throw std::out_of_range(
+                        "SparseMatrix::from_triplets(): Index out of range"
+                    );
+                }
+
+                counts[row_indices[k] + 1]++;
+            }
+
+            std::partial_sum(counts.begin(), counts.end(), counts.begin());
+
+            std::vector<size_t> next(counts.begin(), counts.end() - 1);
+            std::vector<size_t> order(values.size());
+
+            for (size_t k = 0; k < values.size(); k++) {
+                order[next[row_indices[k]]++] = k;
+            }
+
+            std::vector<size_t> row_ptr(rows + 1, 0);
+            std::vector<size_t> result_cols;
+            std::vector<T> result_values;
+
+            result_cols.reserve(values.size());
+            result_values.reserve(values.size());
+
+            for (size_t i = 0; i < rows; i++) {
+                auto first = order.begin() + counts[i];
+                auto last = order.begin() + counts[i + 1];
+
+                std::sort(first, last, [&](size_t a, size_t b) {
+                    return col_indices[a] < col_indices[b];
+                });
+
+                for (auto it = first; it != last; ++it) {
+                    if (
+                        result_cols.size() > row_ptr[i] && \
+                        result_cols.back() == col_indices[*it]
+                    ) {
+                        result_values.back() += values[*it];
+                    } else {
+                        result_cols.push_back(col_indices[*it]);
+                        result_values.push_back(values[*it]);
+                    }
+                }
+
+                row_ptr[i + 1] = result_cols.size();
+            }
+
+            return SparseMatrix(
+                rows, cols,
+                std::move(row_ptr),
+                std::move(result_cols),
+                std::move(result_values)
+            );
+        }
+
+        template <typename T>
+        SparseMatrix<T> SparseMatrix<T>::from_coo(const CooMatrix<T>& matrix) {
+            return from_triplets(
+                matrix.rows, matrix.cols,
+                matrix.row_indices,
+                matrix.col_indices,
+                matrix.values
+            );
+        }
+
+        template <typename T>
+        SparseMatrix<T> SparseMatrix<T>::from_csc(const CscMatrix<T>& matrix) {
+            // The CSC arrays read as CSR describe A^T
+
+            SparseMatrix transposed(
+                matrix.cols, matrix.rows,
+                matrix.col_ptr,
+                matrix.row_indices,
+                matrix.values
+            );
+
+            return transposed.transpose();
+        }
+
+        template <typename T>
+        SparseMatrix<T> SparseMatrix<T>::from_dense(const Matrix<T>& matrix) {
+            std::vector<size_t> row_ptr(matrix.rows() + 1, 0);
+            std::vector<size_t> col_indices;
+            std::vector<T> values;
+
+            for (size_t i = 0; i < matrix.rows(); i++) {
+                for (size_t j = 0; j < matrix.cols(); j++) {
+                    if (matrix(i, j) != T()) {
+                        col_indices.push_back(j);
+                        values.push_back(matrix(i, j));
+                    }
+                }
+
+                row_ptr[i + 1] = values.size();
+            }
+
+            return SparseMatrix(
+                matrix.rows(), matrix.cols(),
+                std::move(row_ptr),
+                std::move(col_indices),
+                std::move(values)
+            );
+        }
+    }
+}
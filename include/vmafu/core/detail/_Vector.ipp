@@ -5,146 +5,169 @@ namespace vmafu {
     namespace core {
         // Helper methods ( memory managment )
 
-        template <typename T>
-        void Vector<T>::_allocate(size_t n) {
-            if (n) {
-                _data = new T[n]();
-            }
+        template <typename T, typename Allocator>
+        void Vector<T, Allocator>::_allocate(size_t n, bool initialize) {
+            _data = allocate_storage<T, Allocator>(n, initialize);
         }
 
-        template <typename T>
-        void Vector<T>::_deallocate() noexcept {
-            delete[] _data;
+        template <typename T, typename Allocator>
+        void Vector<T, Allocator>::_deallocate() noexcept {
+            deallocate_storage<T, Allocator>(_data, _size);
             _data = nullptr;
         }
 
+        template <typename T, typename Allocator>
+        template <typename Expression>
+        void Vector<T, Allocator>::_evaluate(const Expression& expression) {
+            // One fused pass; element i of an expression only reads element
+            // i of its operands, so evaluating into an operand is safe
+
+            for (size_t i = 0; i < _size; i++) {
+                _data[i] = expression[i];
+            }
+        }
+
         // Constructors / Destructor
 
-        template <typename T>
-        Vector<T>::Vector() = default;
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>::Vector() = default;
 
-        template <typename T>
-        Vector<T>::Vector(size_t size) : _size(size) {
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>::Vector(size_t size) : _size(size) {
             _allocate(_size);
         }
 
-        template <typename T>
-        Vector<T>::Vector(size_t size, const T& init_value) : _size(size) {
-            _allocate(_size);
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>::Vector(
+            size_t size,
+            uninitialized_t
+        ) : _size(size) {
+            _allocate(_size, false);
+        }
+
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>::Vector(size_t size, const T& init_value) : _size(size) {
+            _allocate(_size, false);
             std::fill(_data, _data + _size, init_value);
         }
 
-        template <typename T>
-        Vector<T>::Vector(
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>::Vector(
             std::initializer_list<T> init_list
         ) : _size(init_list.size()) {
-            _allocate(_size);
+            _allocate(_size, false);
             std::copy(init_list.begin(), init_list.end(), _data);
         }
 
-        template <typename T>
-        Vector<T>::~Vector() {
+        template <typename T, typename Allocator>
+        template <typename U>
+        Vector<T, Allocator>::Vector(const VectorView<U>& view)
+        : _size(view.size()) {
+            _allocate(_size, false);
+
+            try {
+                this->view().copy_from(view);
+            } catch (...) {
+                _deallocate();
+
+                throw;
+            }
+        }
+
+        template <typename T, typename Allocator>
+        template <typename Expression>
+        Vector<T, Allocator>::Vector(
+            const VectorExpression<Expression>& expression
+        ) : _size(expression.derived().size()) {
+            _allocate(_size, false);
+
+            try {
+                _evaluate(expression.derived());
+            } catch (...) {
+                _deallocate();
+
+                throw;
+            }
+        }
+
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>::~Vector() {
             _deallocate();
         }
 
         // Getters
 
-        template <typename T>
-        T* Vector<T>::data() noexcept {
+        template <typename T, typename Allocator>
+        T* Vector<T, Allocator>::data() noexcept {
             return _data;
         }
 
-        template <typename T>
-        const T* Vector<T>::data() const noexcept {
+        template <typename T, typename Allocator>
+        const T* Vector<T, Allocator>::data() const noexcept {
             return _data;
         }
 
-        template <typename T>
-        size_t Vector<T>::size() const noexcept {
+        template <typename T, typename Allocator>
+        size_t Vector<T, Allocator>::size() const noexcept {
             return _size;
         }
 
         // Setters ( memory managment )
 
-        template <typename T>
-        void Vector<T>::swap(Vector& other_vector) noexcept {
+        template <typename T, typename Allocator>
+        void Vector<T, Allocator>::swap(Vector& other_vector) noexcept {
             std::swap(_data, other_vector._data);
             std::swap(_size, other_vector._size);
         };
 
-        template <typename T>
-        void Vector<T>::resize(size_t new_size) {
+        template <typename T, typename Allocator>
+        void Vector<T, Allocator>::resize(size_t new_size) {
             if (new_size == _size) {
                 return;
             }
-        
-            T* new_data = nullptr;
-
-            if (new_size > 0) {
-                new_data = new T[new_size]();
 
-                size_t min_size = std::min(_size, new_size);
+            Vector temp(new_size);
 
-                for (size_t i = 0; i < min_size; i++) {
-                    new_data[i] = _data[i];
-                }
-            }
-            
-            _deallocate();
+            std::copy(_data, _data + std::min(_size, new_size), temp._data);
 
-            _data = new_data;
-            _size = new_size;
+            swap(temp);
         }
 
-        template <typename T>
-        void Vector<T>::resize(size_t new_size, T fill_value) {
+        template <typename T, typename Allocator>
+        void Vector<T, Allocator>::resize(size_t new_size, T fill_value) {
             if (new_size == _size) {
                 return;
             }
-        
-            T* new_data = nullptr;
 
-            if (new_size > 0) {
-                new_data = new T[new_size];
+            Vector temp(new_size, uninitialized);
 
-                size_t min_size = std::min(_size, new_size);
+            size_t min_size = std::min(_size, new_size);
 
-                for (size_t i = 0; i < min_size; i++) {
-                    new_data[i] = _data[i];
-                }
+            std::copy(_data, _data + min_size, temp._data);
+            std::fill(temp._data + min_size, temp._data + new_size, fill_value);
 
-                if (new_size > _size) {
-                    std::fill(
-                        new_data + _size, new_data + new_size, fill_value
-                    );
-                }
-            }
-            
-            _deallocate();
-
-            _data = new_data;
-            _size = new_size;
+            swap(temp);
         }
 
         // Copy / Move operators
 
-        template <typename T>
-        Vector<T>::Vector(
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>::Vector(
             const Vector& other_vector
         ) : _size(other_vector._size) {
-            _allocate(_size);
+            _allocate(_size, false);
             std::copy(other_vector._data, other_vector._data + _size, _data);
         }
 
-        template <typename T>
-        Vector<T>::Vector(Vector&& other_vector) noexcept
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>::Vector(Vector&& other_vector) noexcept
         : _data(other_vector._data), _size(other_vector._size) {
             other_vector._data = nullptr;
             other_vector._size = 0;
         }
 
-        template <typename T>
-        Vector<T>& Vector<T>::operator=(const Vector& other_vector) {
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>& Vector<T, Allocator>::operator=(const Vector& other_vector) {
             if (this != &other_vector) {
                 Vector temp(other_vector);
                 swap(temp);
@@ -153,8 +176,8 @@ namespace vmafu {
             return *this;
         }
 
-        template <typename T>
-        Vector<T>& Vector<T>::operator=(Vector&& other_vector) noexcept {
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>& Vector<T, Allocator>::operator=(Vector&& other_vector) noexcept {
             if (this != &other_vector) {
                 _deallocate();
 
@@ -168,20 +191,143 @@ namespace vmafu {
             return *this;
         }
 
+        template <typename T, typename Allocator>
+        template <typename Expression>
+        Vector<T, Allocator>& Vector<T, Allocator>::operator=(
+            const VectorExpression<Expression>& expression
+        ) {
+            if (expression.derived().size() == _size) {
+                _evaluate(expression.derived());
+            } else {
+                Vector temp(expression);
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        // Compound assignment ( in place, no allocation )
+
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>& Vector<T, Allocator>::operator+=(
+            const Vector& other_vector
+        ) {
+            if (other_vector._size != _size) {
+                throw std::invalid_argument(
+                    "Vector::operator+=(): Vector sizes must match"
+                );
+            }
+
+            for (size_t i = 0; i < _size; i++) {
+                _data[i] += other_vector._data[i];
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>& Vector<T, Allocator>::operator-=(
+            const Vector& other_vector
+        ) {
+            if (other_vector._size != _size) {
+                throw std::invalid_argument(
+                    "Vector::operator-=(): Vector sizes must match"
+                );
+            }
+
+            for (size_t i = 0; i < _size; i++) {
+                _data[i] -= other_vector._data[i];
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator>
+        template <typename Expression>
+        Vector<T, Allocator>& Vector<T, Allocator>::operator+=(
+            const VectorExpression<Expression>& expression
+        ) {
+            const Expression& source = expression.derived();
+
+            if (source.size() != _size) {
+                throw std::invalid_argument(
+                    "Vector::operator+=(): Vector sizes must match"
+                );
+            }
+
+            for (size_t i = 0; i < _size; i++) {
+                _data[i] += source[i];
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator>
+        template <typename Expression>
+        Vector<T, Allocator>& Vector<T, Allocator>::operator-=(
+            const VectorExpression<Expression>& expression
+        ) {
+            const Expression& source = expression.derived();
+
+            if (source.size() != _size) {
+                throw std::invalid_argument(
+                    "Vector::operator-=(): Vector sizes must match"
+                );
+            }
+
+            for (size_t i = 0; i < _size; i++) {
+                _data[i] -= source[i];
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>& Vector<T, Allocator>::operator*=(const T& scalar) {
+            for (size_t i = 0; i < _size; i++) {
+                _data[i] *= scalar;
+            }
+
+            return *this;
+        }
+
+        template <typename T, typename Allocator>
+        Vector<T, Allocator>& Vector<T, Allocator>::operator/=(const T& scalar) {
+            VMAFU_IF_CONSTEXPR (VMAFU_IS_FLOATING_POINT_V(T)) {
+                if (std::abs(scalar) < 1e-10) {
+                    throw std::invalid_argument(
+                        "Vector::operator/=(): Division by zero"
+                    );
+                }
+            } else {
+                if (scalar == T{0}) {
+                    throw std::invalid_argument(
+                        "Vector::operator/=(): Division by zero"
+                    );
+                }
+            }
+
+            for (size_t i = 0; i < _size; i++) {
+                _data[i] /= scalar;
+            }
+
+            return *this;
+        }
+
         // Access methods
 
-        template <typename T>
-        T& Vector<T>::operator[](size_t index) noexcept {
+        template <typename T, typename Allocator>
+        T& Vector<T, Allocator>::operator[](size_t index) noexcept {
             return _data[index];
         }
 
-        template <typename T>
-        const T& Vector<T>::operator[](size_t index) const noexcept {
+        template <typename T, typename Allocator>
+        const T& Vector<T, Allocator>::operator[](size_t index) const noexcept {
             return _data[index];
         }
 
-        template <typename T>
-        T& Vector<T>::at(size_t index) {
+        template <typename T, typename Allocator>
+        T& Vector<T, Allocator>::at(size_t index) {
             if (index >= _size) {
                 throw std::out_of_range("Vector::at(): index out of range");
             }
@@ -189,8 +335,8 @@ namespace vmafu {
             return _data[index];
         }
 
-        template <typename T>
-        const T& Vector<T>::at(size_t index) const {
+        template <typename T, typename Allocator>
+        const T& Vector<T, Allocator>::at(size_t index) const {
             if (index >= _size) {
                 throw std::out_of_range("Vector::at(): index out of range");
             }
@@ -198,79 +344,104 @@ namespace vmafu {
             return _data[index];
         }
 
-        template <typename T>
-        T& Vector<T>::front() noexcept {
+        template <typename T, typename Allocator>
+        T& Vector<T, Allocator>::front() noexcept {
             return _data[0];
         }
 
-        template <typename T>
-        const T& Vector<T>::front() const noexcept {
+        template <typename T, typename Allocator>
+        const T& Vector<T, Allocator>::front() const noexcept {
             return _data[0];
         }
 
-        template <typename T>
-        T& Vector<T>::back() noexcept {
+        template <typename T, typename Allocator>
+        T& Vector<T, Allocator>::back() noexcept {
             return _data[_size - 1];
         }
 
-        template <typename T>
-        const T& Vector<T>::back() const noexcept {
+        template <typename T, typename Allocator>
+        const T& Vector<T, Allocator>::back() const noexcept {
             return _data[_size - 1];
         }
 
+        // View methods
+
+        template <typename T, typename Allocator>
+        VectorView<T> Vector<T, Allocator>::view() noexcept {
+            return VectorView<T>(_data, _size);
+        }
+
+        template <typename T, typename Allocator>
+        ConstVectorView<T> Vector<T, Allocator>::view() const noexcept {
+            return ConstVectorView<T>(_data, _size);
+        }
+
+        template <typename T, typename Allocator>
+        VectorView<T> Vector<T, Allocator>::segment(size_t start, size_t count) {
+            return view().segment(start, count);
+        }
+
+        template <typename T, typename Allocator>
+        ConstVectorView<T> Vector<T, Allocator>::segment(
+            size_t start,
+            size_t count
+        ) const {
+            return view().segment(start, count);
+        }
+
         // Iterators
 
-        template <typename T>
-        T* Vector<T>::begin() noexcept {
+        template <typename T, typename Allocator>
+        T* Vector<T, Allocator>::begin() noexcept {
             return _data;
         }
 
-        template <typename T>
-        const T* Vector<T>::begin() const noexcept {
+        template <typename T, typename Allocator>
+        const T* Vector<T, Allocator>::begin() const noexcept {
             return _data;
         }
 
-        template <typename T>
-        T* Vector<T>::end() noexcept {
+        template <typename T, typename Allocator>
+        T* Vector<T, Allocator>::end() noexcept {
             return _data + _size;
         }
 
-        template <typename T>
-        const T* Vector<T>::end() const noexcept {
+        template <typename T, typename Allocator>
+        const T* Vector<T, Allocator>::end() const noexcept {
             return _data + _size;
         }
 
         // Static methods
 
-        template <typename T>
-        Vector<T> Vector<T>::unit(size_t size, size_t index) {
+        template <typename T, typename Allocator>
+        Vector<T, Allocator> Vector<T, Allocator>::unit(size_t size, size_t index) {
             if (index >= size) {
                 throw std::out_of_range("Vector::unit(): index out of range");
             }
 
-            Vector<T> result(size);
+            Vector<T, Allocator> result(size);
             result[index] = T{1};
 
             return result;
         }
 
-        template <typename T>
-        Vector<T> Vector<T>::zeros(size_t size) {
+        template <typename T, typename Allocator>
+        Vector<T, Allocator> Vector<T, Allocator>::zeros(size_t size) {
             return Vector(size);
         }
 
-        template <typename T>
-        Vector<T> Vector<T>::ones(size_t size) {
+        template <typename T, typename Allocator>
+        Vector<T, Allocator> Vector<T, Allocator>::ones(size_t size) {
             return Vector(size, T{1});
         }
 
-        template <typename T>
-        Vector<T> Vector<T>::constant(size_t size, const T& fill_value) {
+        template <typename T, typename Allocator>
+        Vector<T, Allocator> Vector<T, Allocator>::constant(size_t size, const T& fill_value) {
             return Vector(size, fill_value);
         }
 
-        template <typename T>
-        Vector<T> Vector<T>::from_function(size_t size, T (*func)(T)) {
+        template <typename T, typename Allocator>
+        Vector<T, Allocator> Vector<T, Allocator>::from_function(size_t size, T (*func)(T)) {
                 Vector result(size);
                 for (size_t i = 0; i < size; i++) {
                     result[i] = func(i);
@@ -278,5 +449,19 @@ namespace vmafu {
 
                 return result;
             }
+
+        template <typename T, typename Allocator>
+        template <typename Func>
+        Vector<T, Allocator> Vector<T, Allocator>::from_function(
+            size_t size,
+            const Func& func
+        ) {
+            Vector result(size, uninitialized);
+            for (size_t i = 0; i < size; i++) {
+                result._data[i] = func(static_cast<T>(i));
+            }
+
+            return result;
+        }
     }
 }
@@ -0,0 +1,107 @@
+// core/detail/_VectorView.ipp
+
+
+namespace vmafu {
+    namespace core {
+        // Constructors
+
+        template <typename T>
+        VectorView<T>::VectorView(
+            T* data,
+            size_t size,
+            size_t stride
+        ) noexcept : _data(data), _size(size), _stride(stride) {}
+
+        template <typename T>
+        template <typename U, typename>
+        VectorView<T>::VectorView(const VectorView<U>& other_view) noexcept
+        : _data(other_view.data()), _size(other_view.size()), \
+          _stride(other_view.stride()) {}
+
+        // Getters
+
+        template <typename T>
+        T* VectorView<T>::data() const noexcept {
+            return _data;
+        }
+
+        template <typename T>
+        size_t VectorView<T>::size() const noexcept {
+            return _size;
+        }
+
+        template <typename T>
+        size_t VectorView<T>::stride() const noexcept {
+            return _stride;
+        }
+
+        template <typename T>
+        bool VectorView<T>::is_contiguous() const noexcept {
+            return _stride == 1 || _size <= 1;
+        }
+
+        // Access methods
+
+        template <typename T>
+        T& VectorView<T>::operator[](size_t index) const noexcept {
+            return _data[index * _stride];
+        }
+
+        template <typename T>
+        T& VectorView<T>::at(size_t index) const {
+            if (index >= _size) {
+                throw std::out_of_range("VectorView::at(): index out of range");
+            }
+
+            return _data[index * _stride];
+        }
+
+        // Slicing methods
+
+        template <typename T>
+        VectorView<T> VectorView<T>::segment(size_t start, size_t count) const {
+            if (start > _size || count > _size - start) {
+                throw std::out_of_range(
+                    "VectorView::segment(): segment out of range"
+                );
+            }
+
+            return VectorView(_data + start * _stride, count, _stride);
+        }
+
+        // Assignment methods
+
+        template <typename T>
+        void VectorView<T>::fill(const value_type& value) const {
+            if (is_contiguous()) {
+                std::fill(_data, _data + _size, value);
+
+                return;
+            }
+
+            for (size_t i = 0; i < _size; i++) {
+                _data[i * _stride] = value;
+            }
+        }
+
+        template <typename T>
+        template <typename U>
+        void VectorView<T>::copy_from(const VectorView<U>& source) const {
+            if (source.size() != _size) {
+                throw std::invalid_argument(
+                    "VectorView::copy_from(): sizes must match"
+                );
+            }
+
+            if (is_contiguous() && source.is_contiguous()) {
+                std::copy(source.data(), source.data() + _size, _data);
+
+                return;
+            }
+
+            for (size_t i = 0; i < _size; i++) {
+                _data[i * _stride] = source[i];
+            }
+        }
+    }
+}
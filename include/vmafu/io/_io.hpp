@@ -5,13 +5,25 @@
 
 
 #include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <future>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
 
 #include "formats/formats.hpp"
 #include "parsers/parsers.hpp"
 #include "serializers/serializers.hpp"
+#include "indexing/indexing.hpp"
 
 #include "../core/_Vector.hpp"
 #include "../core/_Matrix.hpp"
+#include "../core/_FixedVector.hpp"
+#include "../core/_FixedMatrix.hpp"
+#include "../core/_SparseMatrix.hpp"
 
 
 namespace vmafu {
@@ -32,6 +44,54 @@ namespace vmafu {
         template <typename T>
         Matrix<T> load_matrix(const std::string& filename);
 
+        template <typename T>
+        void load_matrix_into(
+            const std::string& filename,
+            Matrix<T>& matrix,
+            std::string& buffer
+        );
+
+        template <typename T>
+        std::future<Vector<T>> load_vector_async(const std::string& filename);
+
+        template <typename T>
+        std::future<Matrix<T>> load_matrix_async(const std::string& filename);
+
+        inline RowIndex build_index(
+            const std::string& filename,
+            size_t stride = 1024
+        );
+
+        // Rows [row_begin, row_end). Binary formats and indexed text seek
+        // to the range; .mtx entries are unordered, so the whole file is
+        // scanned, keeping only the requested rows
+
+        template <typename T>
+        Matrix<T> load_matrix_rows(
+            const std::string& filename,
+            size_t row_begin,
+            size_t row_end
+        );
+
+        template <typename T>
+        Vector<T> load_vector_range(
+            const std::string& filename,
+            size_t begin,
+            size_t end
+        );
+
+        template <typename T>
+        MappedArray<T> map_matrix(const std::string& filename);
+
+        template <typename T>
+        SparseMatrix<T> load_sparse_matrix(const std::string& filename);
+
+        template <typename T>
+        void save_sparse_matrix(
+            const std::string& filename,
+            const SparseMatrix<T>& data
+        );
+
         template <typename T>
         void save_vector(
             const std::string& filename,
@@ -43,13 +103,46 @@ namespace vmafu {
             const std::string& filename,
             const Matrix<T>& data
         );
+
+        // Fixed-size containers ( through the dynamic path, dimensions are
+        // checked on load )
+
+        template <typename T, size_t N>
+        FixedVector<T, N> load_fixed_vector(const std::string& filename);
+
+        template <typename T, size_t R, size_t C>
+        FixedMatrix<T, R, C> load_fixed_matrix(const std::string& filename);
+
+        template <typename T, size_t N>
+        void save_vector(
+            const std::string& filename,
+            const FixedVector<T, N>& data
+        );
+
+        template <typename T, size_t R, size_t C>
+        void save_matrix(
+            const std::string& filename,
+            const FixedMatrix<T, R, C>& data
+        );
     }
 
     using io::load_vector;
     using io::load_matrix;
+    using io::load_matrix_into;
+    using io::load_vector_async;
+    using io::load_matrix_async;
+
+    using io::build_index;
+    using io::load_matrix_rows;
+    using io::load_vector_range;
+    using io::map_matrix;
+    using io::load_sparse_matrix;
+    using io::load_fixed_vector;
+    using io::load_fixed_matrix;
     
     using io::save_vector;
     using io::save_matrix;
+    using io::save_sparse_matrix;
 }
 
 
@@ -0,0 +1,97 @@
+// io/compression/_codecs.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef VMAFU_USE_ZLIB
+#include <zlib.h>
+#endif
+
+
+namespace vmafu {
+    namespace io {
+        namespace compression {
+            // Per-chunk codecs ( ZLIB requires building with VMAFU_USE_ZLIB )
+
+            enum class Codec : std::uint8_t {
+                NONE = 0,
+                LZ = 1,
+                ZLIB = 2
+            };
+
+            // Helper methods
+
+            inline std::string codec_name(Codec codec);
+
+            inline bool codec_available(Codec codec) noexcept;
+
+            // Byte shuffle: groups byte b of every element together, which
+            // makes slowly varying numeric data far more compressible
+
+            inline void shuffle(
+                const char* source,
+                size_t count,
+                size_t element_size,
+                char* destination
+            ) noexcept;
+
+            inline void unshuffle(
+                const char* source,
+                size_t count,
+                size_t element_size,
+                char* destination
+            ) noexcept;
+
+            // LZ codec: LZ4-style block of ( literals, offset, match ) sequences
+
+            inline std::string lz_compress(const char* source, size_t size);
+
+            inline void lz_decompress(
+                const char* source,
+                size_t size,
+                char* destination,
+                size_t raw_size
+            );
+
+            // zlib codec
+
+            inline std::string zlib_compress(const char* source, size_t size);
+
+            inline void zlib_decompress(
+                const char* source,
+                size_t size,
+                char* destination,
+                size_t raw_size
+            );
+
+            // Dispatch methods
+
+            inline std::string compress(
+                Codec codec,
+                const char* source,
+                size_t size
+            );
+
+            inline void decompress(
+                Codec codec,
+                const char* source,
+                size_t size,
+                char* destination,
+                size_t raw_size
+            );
+        }
+
+        using compression::Codec;
+    }
+}
+
+
+#include "detail/_codecs.ipp"
@@ -0,0 +1,7 @@
+// io/compression/compression.hpp
+
+
+#pragma once
+
+
+#include "_codecs.hpp"
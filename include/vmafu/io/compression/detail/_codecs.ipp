@@ -0,0 +1,430 @@
+// io/compression/detail/_codecs.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace compression {
+            namespace internal {
+                constexpr size_t LZ_MIN_MATCH = 4;
+                constexpr size_t LZ_MAX_OFFSET = 65535;
+                constexpr size_t LZ_HASH_BITS = 16;
+
+                // Matches never start in the last bytes of a block, so the
+                // final sequence is always literals only
+
+                constexpr size_t LZ_END_LITERALS = 12;
+
+                inline std::uint32_t read32(const unsigned char* p) noexcept {
+                    std::uint32_t value;
+                    std::memcpy(&value, p, 4);
+
+                    return value;
+                }
+
+                inline size_t lz_hash(std::uint32_t sequence) noexcept {
+                    return (sequence * 2654435761U) >> (32 - LZ_HASH_BITS);
+                }
+
+                inline void write_length(std::string& out, size_t length) {
+                    while (length >= 255) {
+                        out += static_cast<char>(255);
+                        length -= 255;
+                    }
+
+                    out += static_cast<char>(length);
+                }
+
+                inline void write_sequence(
+                    std::string& out,
+                    const unsigned char* literals,
+                    size_t literal_length,
+                    size_t offset,
+                    size_t match_length
+                ) {
+                    size_t match_code = match_length > 0 ? \
+                        match_length - LZ_MIN_MATCH : 0;
+
+                    out += static_cast<char>(
+                        (std::min<size_t>(literal_length, 15) << 4) | \
+                        std::min<size_t>(match_code, 15)
+                    );
+
+                    if (literal_length >= 15) {
+                        write_length(out, literal_length - 15);
+                    }
+
+                    out.append(reinterpret_cast<const char*>(literals), literal_length);
+
+                    if (match_length == 0) {
+                        return;
+                    }
+
+                    out += static_cast<char>(offset & 0xFF);
+                    out += static_cast<char>((offset >> 8) & 0xFF);
+
+                    if (match_code >= 15) {
+                        write_length(out, match_code - 15);
+                    }
+                }
+
+                inline size_t read_length(
+                    const unsigned char*& ip,
+                    const unsigned char* end,
+                    size_t length
+                ) {
+                    if (length != 15) {
+                        return length;
+                    }
+
+                    unsigned char byte;
+
+                    do {
+                        if (ip >= end) {
+                            throw std::runtime_error(
+                                "compression::lz_decompress(): Truncated length"
+                            );
+                        }
+
+                        byte = *ip++;
+                        length += byte;
+                    } while (byte == 255);
+
+                    return length;
+                }
+            }
+
+            // Helper methods
+
+            inline std::string codec_name(Codec codec) {
+                switch (codec) {
+                    case Codec::NONE: {
+                        return "none";
+                    }
+                    case Codec::LZ: {
+                        return "lz";
+                    }
+                    case Codec::ZLIB: {
+                        return "zlib";
+                    }
+                    default: {
+                        return "unknown";
+                    }
+                }
+            }
+
+            inline bool codec_available(Codec codec) noexcept {
+                switch (codec) {
+                    case Codec::NONE:
+                    case Codec::LZ: {
+                        return true;
+                    }
+                    case Codec::ZLIB: {
+#ifdef VMAFU_USE_ZLIB
+                        return true;
+#else
+                        return false;
+#endif
+                    }
+                    default: {
+                        return false;
+                    }
+                }
+            }
+
+            // Byte shuffle
+
+            inline void shuffle(
+                const char* source,
+                size_t count,
+                size_t element_size,
+                char* destination
+            ) noexcept {
+                for (size_t i = 0; i < count; i++) {
+                    for (size_t b = 0; b < element_size; b++) {
+                        destination[b * count + i] = source[i * element_size + b];
+                    }
+                }
+            }
+
+            inline void unshuffle(
+                const char* source,
+                size_t count,
+                size_t element_size,
+                char* destination
+            ) noexcept {
+                for (size_t b = 0; b < element_size; b++) {
+                    const char* plane = source + b * count;
+
+                    for (size_t i = 0; i < count; i++) {
+                        destination[i * element_size + b] = plane[i];
+                    }
+                }
+            }
+
+            // LZ codec
+
+            inline std::string lz_compress(const char* source, size_t size) {
+                const unsigned char* src = reinterpret_cast<const unsigned char*>(
+                    source
+                );
+
+                std::string out;
+                out.reserve(size + size / 255 + 16);
+
+                size_t anchor = 0;
+
+                if (size > internal::LZ_END_LITERALS) {
+                    std::vector<std::uint32_t> table(
+                        size_t(1) << internal::LZ_HASH_BITS, 0
+                    );
+
+                    // Table entries hold position + 1 so that 0 means empty
+
+                    size_t limit = size - internal::LZ_END_LITERALS;
+                    size_t ip = 0;
+
+                    while (ip < limit) {
+                        std::uint32_t sequence = internal::read32(src + ip);
+                        size_t h = internal::lz_hash(sequence);
+
+                        size_t candidate = table[h];
+                        table[h] = static_cast<std::uint32_t>(ip + 1);
+
+                        if (
+                            candidate == 0 || \
+                            ip - (candidate - 1) > internal::LZ_MAX_OFFSET || \
+                            internal::read32(src + candidate - 1) != sequence
+                        ) {
+                            ip++;
+
+                            continue;
+                        }
+
+                        size_t reference = candidate - 1;
+                        size_t length = internal::LZ_MIN_MATCH;
+                        size_t match_end = size - 5;
+
+                        while (
+                            ip + length < match_end && \
+                            src[reference + length] == src[ip + length]
+                        ) {
+                            length++;
+                        }
+
+                        internal::write_sequence(
+                            out, src + anchor, ip - anchor, ip - reference, length
+                        );
+
+                        ip += length;
+                        anchor = ip;
+                    }
+                }
+
+                internal::write_sequence(out, src + anchor, size - anchor, 0, 0);
+
+                return out;
+            }
+
+            inline void lz_decompress(
+                const char* source,
+                size_t size,
+                char* destination,
+                size_t raw_size
+            ) {
+                const unsigned char* ip = reinterpret_cast<const unsigned char*>(
+                    source
+                );
+                const unsigned char* end = ip + size;
+
+                unsigned char* dst = reinterpret_cast<unsigned char*>(destination);
+                size_t op = 0;
+
+                while (ip < end) {
+                    unsigned char token = *ip++;
+
+                    size_t literal_length = internal::read_length(ip, end, token >> 4);
+
+                    if (
+                        literal_length > static_cast<size_t>(end - ip) || \
+                        literal_length > raw_size - op
+                    ) {
+                        throw std::runtime_error(
+                            "compression::lz_decompress(): Corrupt literal run"
+                        );
+                    }
+
+                    std::memcpy(dst + op, ip, literal_length);
+
+                    ip += literal_length;
+                    op += literal_length;
+
+                    if (ip == end) {
+                        break;
+                    }
+
+                    if (end - ip < 2) {
+                        throw std::runtime_error(
+                            "compression::lz_decompress(): Truncated match offset"
+                        );
+                    }
+
+                    size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+                    ip += 2;
+
+                    size_t match_length = internal::read_length(
+                        ip, end, token & 0x0F
+                    ) + internal::LZ_MIN_MATCH;
+
+                    if (offset == 0 || offset > op || match_length > raw_size - op) {
+                        throw std::runtime_error(
+                            "compression::lz_decompress(): Corrupt match"
+                        );
+                    }
+
+                    // Byte-wise copy: the match may overlap its own output
+
+                    const unsigned char* match = dst + op - offset;
+
+                    for (size_t i = 0; i < match_length; i++) {
+                        dst[op + i] = match[i];
+                    }
+
+                    op += match_length;
+                }
+
+                if (op != raw_size) {
+                    throw std::runtime_error(
+                        "compression::lz_decompress(): Decompressed size mismatch"
+                    );
+                }
+            }
+
+            // zlib codec
+
+            inline std::string zlib_compress(const char* source, size_t size) {
+#ifdef VMAFU_USE_ZLIB
+                uLongf bound = compressBound(static_cast<uLong>(size));
+
+                std::string out(bound, '\0');
+
+                int status = compress2(
+                    reinterpret_cast<Bytef*>(&out[0]), &bound,
+                    reinterpret_cast<const Bytef*>(source),
+                    static_cast<uLong>(size), Z_DEFAULT_COMPRESSION
+                );
+
+                if (status != Z_OK) {
+                    throw std::runtime_error(
+                        "compression::zlib_compress(): zlib error " + std::to_string(status)
+                    );
+                }
+
+                out.resize(bound);
+
+                return out;
+#else
+                (void)source;
+                (void)size;
+
+                throw std::runtime_error(
+                    "compression::zlib_compress(): Built without VMAFU_USE_ZLIB"
+                );
+#endif
+            }
+
+            inline void zlib_decompress(
+                const char* source,
+                size_t size,
+                char* destination,
+                size_t raw_size
+            ) {
+#ifdef VMAFU_USE_ZLIB
+                uLongf length = static_cast<uLongf>(raw_size);
+
+                int status = uncompress(
+                    reinterpret_cast<Bytef*>(destination), &length,
+                    reinterpret_cast<const Bytef*>(source),
+                    static_cast<uLong>(size)
+                );
+
+                if (status != Z_OK || length != raw_size) {
+                    throw std::runtime_error(
+                        "compression::zlib_decompress(): Corrupt zlib stream"
+                    );
+                }
+#else
+                (void)source;
+                (void)size;
+                (void)destination;
+                (void)raw_size;
+
+                throw std::runtime_error(
+                    "compression::zlib_decompress(): Built without VMAFU_USE_ZLIB"
+                );
+#endif
+            }
+
+            // Dispatch methods
+
+            inline std::string compress(
+                Codec codec,
+                const char* source,
+                size_t size
+            ) {
+                switch (codec) {
+                    case Codec::NONE: {
+                        return std::string(source, size);
+                    }
+                    case Codec::LZ: {
+                        return lz_compress(source, size);
+                    }
+                    case Codec::ZLIB: {
+                        return zlib_compress(source, size);
+                    }
+                    default: {
+                        throw std::invalid_argument(
+                            "compression::compress(): Unknown codec"
+                        );
+                    }
+                }
+            }
+
+            inline void decompress(
+                Codec codec,
+                const char* source,
+                size_t size,
+                char* destination,
+                size_t raw_size
+            ) {
+                switch (codec) {
+                    case Codec::NONE: {
+                        if (size != raw_size) {
+                            throw std::runtime_error(
+                                "compression::decompress(): Stored size mismatch"
+                            );
+                        }
+
+                        std::memcpy(destination, source, size);
+
+                        return;
+                    }
+                    case Codec::LZ: {
+                        lz_decompress(source, size, destination, raw_size);
+
+                        return;
+                    }
+                    case Codec::ZLIB: {
+                        zlib_decompress(source, size, destination, raw_size);
+
+                        return;
+                    }
+                    default: {
+                        throw std::invalid_argument(
+                            "compression::decompress(): Unknown codec"
+                        );
+                    }
+                }
+            }
+        }
+    }
+}
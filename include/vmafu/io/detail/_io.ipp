@@ -3,6 +3,485 @@
 
 namespace vmafu {
     namespace io {
+        namespace internal {
+            template <typename T>
+            Matrix<T> load_matrix_binary(
+                const formats::IBinaryFormat& format,
+                const std::string& filename
+            ) {
+                formats::ArrayInfo info = format.read_info(filename);
+
+                // Contiguous payloads are converted straight out of the
+                // mapped file, without an intermediate byte buffer
+
+                std::vector<char> buffer;
+                formats::MappedFile mapped;
+
+                const char* payload;
+
+                if (info.contiguous) {
+                    mapped = formats::MappedFile(filename);
+
+                    if (
+                        mapped.size() < info.data_offset + \
+                        info.size() * formats::data_type_size(info.dtype)
+                    ) {
+                        throw std::runtime_error(
+                            "io::load_matrix(): Unexpected end of file: " + filename
+                        );
+                    }
+
+                    payload = mapped.data() + info.data_offset;
+                } else {
+                    buffer.resize(
+                        info.size() * formats::data_type_size(info.dtype)
+                    );
+
+                    format.read_data(filename, info, 0, info.size(), buffer.data());
+
+                    payload = buffer.data();
+                }
+
+                Matrix<T> matrix(info.rows, info.cols, uninitialized);
+
+                if (info.fortran_order) {
+                    Vector<T> column_major(info.size(), uninitialized);
+
+                    formats::convert_elements(
+                        payload, info, info.size(), column_major.data()
+                    );
+
+                    for (size_t j = 0; j < info.cols; j++) {
+                        for (size_t i = 0; i < info.rows; i++) {
+                            matrix(i, j) = column_major[j * info.rows + i];
+                        }
+                    }
+                } else {
+                    formats::convert_elements(
+                        payload, info, info.size(), matrix.data()
+                    );
+                }
+
+                return matrix;
+            }
+
+            template <typename T>
+            void save_matrix_binary(
+                const formats::IBinaryFormat& format,
+                const std::string& filename,
+                const Matrix<T>& matrix,
+                size_t ndim
+            ) {
+                formats::ArrayInfo info;
+
+                info.dtype = formats::data_type<T>();
+                info.rows = matrix.rows();
+                info.cols = matrix.cols();
+                info.ndim = ndim;
+                info.big_endian = formats::is_big_endian_host();
+
+                if (info.dtype == formats::DataType::UNKNOWN) {
+                    throw std::invalid_argument(
+                        "io::save_matrix(): Element type is not supported by binary formats"
+                    );
+                }
+
+                format.write_array(filename, info, matrix.data());
+            }
+
+            template <typename T>
+            SparseMatrix<T> load_matrix_market(const std::string& filename) {
+                formats::MarketInfo info = MatrixMarketFormat::read_info(filename);
+
+                formats::MappedFile file(filename);
+
+                std::vector<size_t> row_indices;
+                std::vector<size_t> col_indices;
+                std::vector<T> values;
+
+                size_t capacity = info.symmetry == "general" ? \
+                    info.entries : 2 * info.entries;
+
+                row_indices.reserve(capacity);
+                col_indices.reserve(capacity);
+                values.reserve(capacity);
+
+                size_t count = MatrixMarketFormat::parse_entries(
+                    file.data() + std::min(info.data_offset, file.size()),
+                    file.data() + file.size(),
+                    info, row_indices, col_indices, values
+                );
+
+                if (count != info.entries) {
+                    throw std::runtime_error(
+                        "io::load_sparse_matrix(): Expected " + \
+                        std::to_string(info.entries) + " entries, found " + \
+                        std::to_string(count) + ": " + filename
+                    );
+                }
+
+                return SparseMatrix<T>::from_triplets(
+                    info.rows, info.cols, row_indices, col_indices, values
+                );
+            }
+
+            // Rows [row_begin, row_end) of a Matrix Market file. Coordinate
+            // entries are unordered, so every entry is still parsed, but
+            // in bounded chunks that keep only the requested rows: memory
+            // is O(chunk + output) instead of the whole sparse matrix
+
+            template <typename T>
+            Matrix<T> load_matrix_market_rows(
+                const std::string& filename,
+                size_t row_begin,
+                size_t row_end
+            ) {
+                constexpr size_t CHUNK_BYTES = size_t(1) << 20;
+
+                formats::MarketInfo info = MatrixMarketFormat::read_info(filename);
+
+                if (row_end > info.rows) {
+                    throw std::out_of_range(
+                        "io::load_matrix_rows(): Row range out of bounds"
+                    );
+                }
+
+                formats::MappedFile file(filename);
+
+                Matrix<T> matrix(row_end - row_begin, info.cols, T(0));
+
+                std::vector<size_t> row_indices;
+                std::vector<size_t> col_indices;
+                std::vector<T> values;
+
+                const char* position = file.data() + std::min(info.data_offset, file.size());
+                const char* end = file.data() + file.size();
+
+                size_t count = 0;
+
+                while (position < end) {
+                    const char* stop = position + std::min<size_t>(CHUNK_BYTES, end - position);
+
+                    while (stop < end && stop[-1] != '\n') {
+                        stop++;
+                    }
+
+                    row_indices.clear();
+                    col_indices.clear();
+                    values.clear();
+
+                    count += MatrixMarketFormat::parse_entries(
+                        position, stop, info, row_indices, col_indices, values
+                    );
+
+                    for (size_t k = 0; k < values.size(); k++) {
+                        if (row_indices[k] >= row_begin && row_indices[k] < row_end) {
+                            matrix(row_indices[k] - row_begin, col_indices[k]) += values[k];
+                        }
+                    }
+
+                    position = stop;
+                }
+
+                if (count != info.entries) {
+                    throw std::runtime_error(
+                        "io::load_matrix_rows(): Expected " + \
+                        std::to_string(info.entries) + " entries, found " + \
+                        std::to_string(count) + ": " + filename
+                    );
+                }
+
+                return matrix;
+            }
+
+            template <typename T>
+            void save_matrix_market(
+                const std::string& filename,
+                const SparseMatrix<T>& matrix
+            ) {
+                std::ofstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "io::save_sparse_matrix(): Cannot open file: " + filename
+                    );
+                }
+
+                formats::MarketInfo info;
+
+                info.field = MatrixMarketFormat::field_name<T>();
+                info.rows = matrix.rows();
+                info.cols = matrix.cols();
+                info.entries = matrix.nnz();
+
+                file << MatrixMarketFormat::encode_header(info) \
+                     << MatrixMarketFormat::encode_entries(matrix);
+
+                if (!file) {
+                    throw std::runtime_error(
+                        "io::save_sparse_matrix(): Failed to write file: " + filename
+                    );
+                }
+            }
+
+            inline const FormatPtr& cached_format(const std::string& filename) {
+                // Per-thread format of the last extension seen, so repeated
+                // loads skip create_format's allocation
+
+                thread_local FormatPtr format;
+                thread_local std::string extension;
+
+                size_t dot_pos = filename.find_last_of('.');
+
+                std::string_view ext = dot_pos == std::string::npos ? \
+                    std::string_view() : std::string_view(filename).substr(dot_pos);
+
+                if (!format || ext != extension) {
+                    format = create_format(filename);
+                    extension.assign(ext.data(), ext.size());
+                }
+
+                return format;
+            }
+
+            template <typename T>
+            bool parse_numeric(
+                std::string_view content,
+                char delimiter,
+                bool skip_header,
+                Matrix<T>& matrix
+            ) {
+                // Plain numeric CSV only: quoted fields, ragged rows or
+                // anything strto* rejects go through the generic parser.
+                // content must be followed by a '\0' ( std::string storage )
+
+                if (content.find('"') != std::string_view::npos) {
+                    return false;
+                }
+
+                auto is_blank = [](std::string_view line) {
+                    return line.empty() || (line.size() == 1 && line[0] == '\r');
+                };
+
+                size_t rows = 0;
+                size_t cols = 0;
+
+                bool header = skip_header;
+
+                size_t pos = 0;
+
+                while (pos < content.size()) {
+                    size_t newline = content.find('\n', pos);
+                    if (newline == std::string_view::npos) {
+                        newline = content.size();
+                    }
+
+                    std::string_view line = content.substr(pos, newline - pos);
+
+                    pos = newline + 1;
+
+                    if (header) {
+                        header = false;
+                        continue;
+                    }
+
+                    if (is_blank(line)) {
+                        continue;
+                    }
+
+                    if (rows == 0) {
+                        cols = static_cast<size_t>(
+                            std::count(line.begin(), line.end(), delimiter)
+                        ) + 1;
+                    }
+
+                    rows++;
+                }
+
+                if (rows != matrix.rows() || cols != matrix.cols()) {
+                    matrix = Matrix<T>(rows, cols);
+                }
+
+                header = skip_header;
+                pos = 0;
+
+                size_t row = 0;
+
+                while (pos < content.size()) {
+                    size_t newline = content.find('\n', pos);
+                    if (newline == std::string_view::npos) {
+                        newline = content.size();
+                    }
+
+                    std::string_view line = content.substr(pos, newline - pos);
+
+                    const char* cursor = content.data() + pos;
+                    const char* line_end = content.data() + newline;
+
+                    pos = newline + 1;
+
+                    if (header) {
+                        header = false;
+                        continue;
+                    }
+
+                    if (is_blank(line)) {
+                        continue;
+                    }
+
+                    for (size_t col = 0; col < cols; col++) {
+                        const char* field_end = static_cast<const char*>(
+                            std::memchr(cursor, delimiter, line_end - cursor)
+                        );
+
+                        if (field_end == nullptr) {
+                            field_end = line_end;
+                        }
+
+                        if ((field_end == line_end) != (col + 1 == cols)) {
+                            return false;
+                        }
+
+                        char* next = nullptr;
+
+                        VMAFU_IF_CONSTEXPR (VMAFU_IS_INTEGRAL_V(T)) {
+                            matrix(row, col) = static_cast<T>(std::strtoll(cursor, &next, 10));
+                        } else {
+                            matrix(row, col) = static_cast<T>(std::strtod(cursor, &next));
+                        }
+
+                        if (next == cursor || next > field_end) {
+                            return false;
+                        }
+
+                        for (const char* p = next; p < field_end; p++) {
+                            if (!std::isspace(static_cast<unsigned char>(*p))) {
+                                return false;
+                            }
+                        }
+
+                        cursor = field_end + 1;
+                    }
+
+                    row++;
+                }
+
+                return true;
+            }
+
+            // Single parse of the sidecar; false when it is missing,
+            // stale or malformed, so the caller falls back to scanning
+
+            inline bool try_load_index(
+                const std::string& filename,
+                RowIndex& index
+            ) {
+                try {
+                    index = RowIndex::load(filename);
+
+                    return true;
+                } catch (const std::exception&) {
+                    return false;
+                }
+            }
+
+            inline char text_delimiter(const FormatPtr& format) {
+                auto csv = std::dynamic_pointer_cast<formats::CsvFormat>(format);
+
+                return csv ? csv->parser().delimiter() : '\0';
+            }
+
+            inline std::string read_row_range(
+                const std::string& filename,
+                size_t row_begin,
+                size_t row_end,
+                const RowIndex* index
+            ) {
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "io::load_matrix_rows(): Cannot open file: " + filename
+                    );
+                }
+
+                size_t skip = row_begin;
+
+                if (index) {
+                    auto position = index->seek_row(row_begin);
+
+                    file.seekg(static_cast<std::streamoff>(position.first));
+                    skip = position.second;
+                }
+
+                std::string text;
+                std::string line;
+
+                size_t row = 0;
+
+                while (row < skip + (row_end - row_begin) && std::getline(file, line)) {
+                    bool has_data = std::any_of(
+                        line.begin(), line.end(), [](char c) {
+                            return !std::isspace(static_cast<unsigned char>(c));
+                        }
+                    );
+
+                    if (!has_data) {
+                        continue;
+                    }
+
+                    if (row >= skip) {
+                        text += line;
+                        text += '\n';
+                    }
+
+                    row++;
+                }
+
+                return text;
+            }
+
+            inline std::string read_field_range(
+                const std::string& filename,
+                size_t begin,
+                size_t end,
+                char delimiter,
+                const RowIndex& index
+            ) {
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "io::load_vector_range(): Cannot open file: " + filename
+                    );
+                }
+
+                auto position = index.seek_field(begin);
+
+                file.seekg(static_cast<std::streamoff>(position.first));
+
+                size_t skip = position.second;
+                size_t needed = end - begin;
+
+                std::string text;
+
+                char c;
+
+                while (skip > 0 && file.get(c) && c != '\n') {
+                    if (c == delimiter) {
+                        skip--;
+                    }
+                }
+
+                while (needed > 0 && file.get(c) && c != '\n') {
+                    if (c == delimiter && --needed == 0) {
+                        break;
+                    }
+
+                    text += c;
+                }
+
+                return text;
+            }
+        }
+
         FormatPtr create_format(const std::string& filename) {
             size_t dot_pos = filename.find_last_of('.');
 
@@ -16,6 +495,14 @@ namespace vmafu {
                     ext == ".dat" || ext == ".DAT"
                 ) {
                     return TxtFormat::create();
+                } else if (ext == ".mtx" || ext == ".MTX") {
+                    return MatrixMarketFormat::create();
+                } else if (ext == ".bin" || ext == ".BIN") {
+                    return BinaryFormat::create();
+                } else if (ext == ".npy" || ext == ".NPY") {
+                    return NpyFormat::create();
+                } else if (ext == ".vmz" || ext == ".VMZ") {
+                    return ChunkedFormat::create();
                 }
             }
 
@@ -54,24 +541,404 @@ namespace vmafu {
         template <typename T>
         Vector<T> load_vector(const std::string& filename) {
             FormatPtr format = create_format(filename);
+
+            auto binary = std::dynamic_pointer_cast<formats::IBinaryFormat>(
+                format
+            );
+
+            if (binary) {
+                Matrix<T> matrix = internal::load_matrix_binary<T>(
+                    *binary, filename
+                );
+
+                if (matrix.rows() > 1 && matrix.cols() > 1) {
+                    throw std::runtime_error(
+                        "io::load_vector(): Binary array is not one-dimensional: " + filename
+                    );
+                }
+
+                Vector<T> vector(matrix.size());
+                std::copy(matrix.begin(), matrix.end(), vector.begin());
+
+                return vector;
+            }
+
+            if (std::dynamic_pointer_cast<MatrixMarketFormat>(format)) {
+                SparseMatrix<T> matrix = internal::load_matrix_market<T>(filename);
+
+                if (matrix.rows() > 1 && matrix.cols() > 1) {
+                    throw std::runtime_error(
+                        "io::load_vector(): Matrix Market array is not one-dimensional: " + filename
+                    );
+                }
+
+                Vector<T> vector(matrix.rows() * matrix.cols());
+
+                for (size_t i = 0; i < matrix.rows(); i++) {
+                    for (size_t k = matrix.row_ptr()[i]; k < matrix.row_ptr()[i + 1]; k++) {
+                        vector[i + matrix.col_indices()[k]] = matrix.values()[k];
+                    }
+                }
+
+                return vector;
+            }
+
             ParserPtr parser = create_parser(filename);
 
             auto serializer = create_serializer(Vector<T>());
 
-            return serializer->deserialize(
-                parser->parse(format->read(filename))
+            Vector<T> vector = serializer->deserialize(
+                parser->parse(format->read_view(filename))
             );
+
+            formats::IFormat::release_pooled_buffer();
+
+            return vector;
         }
 
         template <typename T>
         Matrix<T> load_matrix(const std::string& filename) {
             FormatPtr format = create_format(filename);
+
+            auto binary = std::dynamic_pointer_cast<formats::IBinaryFormat>(
+                format
+            );
+
+            if (binary) {
+                return internal::load_matrix_binary<T>(*binary, filename);
+            }
+
+            if (std::dynamic_pointer_cast<MatrixMarketFormat>(format)) {
+                return internal::load_matrix_market<T>(filename).to_dense();
+            }
+
             ParserPtr parser = create_parser(filename);
 
             auto serializer = create_serializer(Matrix<T>());
 
-            return serializer->deserialize(
-                parser->parse(format->read(filename))
+            Matrix<T> matrix = serializer->deserialize(
+                parser->parse(format->read_view(filename))
+            );
+
+            formats::IFormat::release_pooled_buffer();
+
+            return matrix;
+        }
+
+        template <typename T>
+        void load_matrix_into(
+            const std::string& filename,
+            Matrix<T>& matrix,
+            std::string& buffer
+        ) {
+            const FormatPtr& format = internal::cached_format(filename);
+
+            auto csv = std::dynamic_pointer_cast<formats::CsvFormat>(format);
+
+            if (csv) {
+                std::string_view content = csv->read_view(filename, buffer);
+
+                if (
+                    internal::parse_numeric(
+                        content,
+                        csv->parser().delimiter(),
+                        csv->parser().has_header(),
+                        matrix
+                    )
+                ) {
+                    return;
+                }
+
+                matrix = create_serializer(Matrix<T>())->deserialize(
+                    csv->parser().parse(content)
+                );
+
+                return;
+            }
+
+            matrix = load_matrix<T>(filename);
+        }
+
+        template <typename T>
+        std::future<Vector<T>> load_vector_async(const std::string& filename) {
+            return std::async(std::launch::async, [filename] {
+                return load_vector<T>(filename);
+            });
+        }
+
+        template <typename T>
+        std::future<Matrix<T>> load_matrix_async(const std::string& filename) {
+            return std::async(std::launch::async, [filename] {
+                return load_matrix<T>(filename);
+            });
+        }
+
+        RowIndex build_index(
+            const std::string& filename,
+            size_t stride
+        ) {
+            RowIndex index = RowIndex::build(
+                filename, internal::text_delimiter(create_format(filename)), stride
+            );
+
+            index.save(RowIndex::index_filename(filename));
+
+            return index;
+        }
+
+        template <typename T>
+        Matrix<T> load_matrix_rows(
+            const std::string& filename,
+            size_t row_begin,
+            size_t row_end
+        ) {
+            if (row_begin > row_end) {
+                throw std::invalid_argument(
+                    "io::load_matrix_rows(): Invalid row range"
+                );
+            }
+
+            FormatPtr format = create_format(filename);
+
+            auto binary = std::dynamic_pointer_cast<formats::IBinaryFormat>(
+                format
+            );
+
+            if (std::dynamic_pointer_cast<MatrixMarketFormat>(format)) {
+                return internal::load_matrix_market_rows<T>(
+                    filename, row_begin, row_end
+                );
+            }
+
+            if (binary) {
+                formats::ArrayInfo info = binary->read_info(filename);
+
+                if (row_end > info.rows) {
+                    throw std::out_of_range(
+                        "io::load_matrix_rows(): Row range out of bounds"
+                    );
+                }
+
+                size_t element_size = formats::data_type_size(info.dtype);
+                size_t rows = row_end - row_begin;
+
+                Matrix<T> matrix(rows, info.cols);
+
+                if (info.fortran_order) {
+                    std::vector<char> buffer(rows * element_size);
+                    Vector<T> column(rows);
+
+                    for (size_t j = 0; j < info.cols; j++) {
+                        binary->read_data(
+                            filename, info, j * info.rows + row_begin, rows,
+                            buffer.data()
+                        );
+
+                        formats::convert_elements(
+                            buffer.data(), info, rows, column.data()
+                        );
+
+                        for (size_t i = 0; i < rows; i++) {
+                            matrix(i, j) = column[i];
+                        }
+                    }
+                } else {
+                    std::vector<char> buffer(rows * info.cols * element_size);
+
+                    binary->read_data(
+                        filename, info, row_begin * info.cols, rows * info.cols,
+                        buffer.data()
+                    );
+
+                    formats::convert_elements(
+                        buffer.data(), info, rows * info.cols, matrix.data()
+                    );
+                }
+
+                return matrix;
+            }
+
+            if (row_begin == row_end) {
+                return Matrix<T>();
+            }
+
+            RowIndex index;
+            bool indexed = internal::try_load_index(filename, index);
+
+            if (indexed) {
+                if (row_end > index.rows()) {
+                    throw std::out_of_range(
+                        "io::load_matrix_rows(): Row range out of bounds"
+                    );
+                }
+            }
+
+            ParserPtr parser = create_parser(filename);
+
+            auto serializer = create_serializer(Matrix<T>());
+
+            Matrix<T> matrix = serializer->deserialize(
+                parser->parse(
+                    internal::read_row_range(
+                        filename, row_begin, row_end, indexed ? &index : nullptr
+                    )
+                )
+            );
+
+            if (matrix.rows() != row_end - row_begin) {
+                throw std::out_of_range(
+                    "io::load_matrix_rows(): Row range out of bounds"
+                );
+            }
+
+            return matrix;
+        }
+
+        template <typename T>
+        Vector<T> load_vector_range(
+            const std::string& filename,
+            size_t begin,
+            size_t end
+        ) {
+            if (begin > end) {
+                throw std::invalid_argument(
+                    "io::load_vector_range(): Invalid element range"
+                );
+            }
+
+            FormatPtr format = create_format(filename);
+
+            auto binary = std::dynamic_pointer_cast<formats::IBinaryFormat>(
+                format
+            );
+
+            if (binary) {
+                formats::ArrayInfo info = binary->read_info(filename);
+
+                if (info.rows > 1 && info.cols > 1) {
+                    throw std::runtime_error(
+                        "io::load_vector_range(): Binary array is not one-dimensional: " + filename
+                    );
+                }
+
+                if (end > info.size()) {
+                    throw std::out_of_range(
+                        "io::load_vector_range(): Element range out of bounds"
+                    );
+                }
+
+                std::vector<char> buffer(
+                    (end - begin) * formats::data_type_size(info.dtype)
+                );
+
+                binary->read_data(filename, info, begin, end - begin, buffer.data());
+
+                Vector<T> vector(end - begin);
+
+                formats::convert_elements(
+                    buffer.data(), info, end - begin, vector.data()
+                );
+
+                return vector;
+            }
+
+            if (begin == end) {
+                return Vector<T>();
+            }
+
+            Vector<T> vector;
+
+            RowIndex index;
+
+            if (internal::try_load_index(filename, index)) {
+                if (!index.field_offsets().empty()) {
+                    if (end > index.cols()) {
+                        throw std::out_of_range(
+                            "io::load_vector_range(): Element range out of bounds"
+                        );
+                    }
+
+                    ParserPtr parser = create_parser(filename);
+
+                    auto serializer = create_serializer(Vector<T>());
+
+                    vector = serializer->deserialize(
+                        parser->parse(
+                            internal::read_field_range(
+                                filename, begin, end,
+                                internal::text_delimiter(format), index
+                            )
+                        )
+                    );
+                } else if (index.cols() == 1) {
+                    Matrix<T> column = load_matrix_rows<T>(filename, begin, end);
+
+                    vector = Vector<T>(column.size());
+                    std::copy(column.begin(), column.end(), vector.begin());
+                }
+            }
+
+            if (vector.size() == 0) {
+                Vector<T> full = load_vector<T>(filename);
+
+                if (end > full.size()) {
+                    throw std::out_of_range(
+                        "io::load_vector_range(): Element range out of bounds"
+                    );
+                }
+
+                vector = Vector<T>(end - begin);
+                std::copy(full.begin() + begin, full.begin() + end, vector.begin());
+            }
+
+            if (vector.size() != end - begin) {
+                throw std::out_of_range(
+                    "io::load_vector_range(): Element range out of bounds"
+                );
+            }
+
+            return vector;
+        }
+
+        template <typename T>
+        SparseMatrix<T> load_sparse_matrix(const std::string& filename) {
+            if (std::dynamic_pointer_cast<MatrixMarketFormat>(create_format(filename))) {
+                return internal::load_matrix_market<T>(filename);
+            }
+
+            return SparseMatrix<T>::from_dense(load_matrix<T>(filename));
+        }
+
+        template <typename T>
+        void save_sparse_matrix(
+            const std::string& filename,
+            const SparseMatrix<T>& data
+        ) {
+            if (std::dynamic_pointer_cast<MatrixMarketFormat>(create_format(filename))) {
+                internal::save_matrix_market(filename, data);
+
+                return;
+            }
+
+            save_matrix(filename, data.to_dense());
+        }
+
+        template <typename T>
+        MappedArray<T> map_matrix(const std::string& filename) {
+            auto binary = std::dynamic_pointer_cast<formats::IBinaryFormat>(
+                create_format(filename)
+            );
+
+            if (!binary) {
+                throw std::invalid_argument(
+                    "io::map_matrix(): Only binary formats can be mapped: " + filename
+                );
+            }
+
+            formats::ArrayInfo info = binary->read_info(filename);
+
+            return MappedArray<T>(
+                std::make_shared<formats::MappedFile>(filename), info
             );
         }
 
@@ -81,6 +948,20 @@ namespace vmafu {
             const Vector<T>& data
         ) {
             FormatPtr format = create_format(filename);
+
+            auto binary = std::dynamic_pointer_cast<formats::IBinaryFormat>(
+                format
+            );
+
+            if (binary) {
+                Matrix<T> row(1, data.size());
+                std::copy(data.begin(), data.end(), row.begin());
+
+                internal::save_matrix_binary(*binary, filename, row, 1);
+
+                return;
+            }
+
             ParserPtr parser = create_parser(filename);
 
             auto serializer = create_serializer(data);
@@ -96,6 +977,25 @@ namespace vmafu {
             const Matrix<T>& data
         ) {
             FormatPtr format = create_format(filename);
+
+            auto binary = std::dynamic_pointer_cast<formats::IBinaryFormat>(
+                format
+            );
+
+            if (binary) {
+                internal::save_matrix_binary(*binary, filename, data, 2);
+
+                return;
+            }
+
+            if (std::dynamic_pointer_cast<MatrixMarketFormat>(format)) {
+                internal::save_matrix_market(
+                    filename, SparseMatrix<T>::from_dense(data)
+                );
+
+                return;
+            }
+
             ParserPtr parser = create_parser(filename);
 
             auto serializer = create_serializer(data);
@@ -104,5 +1004,50 @@ namespace vmafu {
                 filename, parser->unparse(serializer->serialize(data))
             );
         }
+
+        template <typename T, size_t N>
+        FixedVector<T, N> load_fixed_vector(const std::string& filename) {
+            Vector<T> vector = load_vector<T>(filename);
+
+            if (vector.size() != N) {
+                throw std::runtime_error(
+                    "io::load_fixed_vector(): Expected " + std::to_string(N) + \
+                    " elements, file has " + std::to_string(vector.size())
+                );
+            }
+
+            return FixedVector<T, N>(vector);
+        }
+
+        template <typename T, size_t R, size_t C>
+        FixedMatrix<T, R, C> load_fixed_matrix(const std::string& filename) {
+            Matrix<T> matrix = load_matrix<T>(filename);
+
+            if (matrix.rows() != R || matrix.cols() != C) {
+                throw std::runtime_error(
+                    "io::load_fixed_matrix(): Expected " + std::to_string(R) + \
+                    "x" + std::to_string(C) + ", file has " + \
+                    std::to_string(matrix.rows()) + "x" + std::to_string(matrix.cols())
+                );
+            }
+
+            return FixedMatrix<T, R, C>(matrix);
+        }
+
+        template <typename T, size_t N>
+        void save_vector(
+            const std::string& filename,
+            const FixedVector<T, N>& data
+        ) {
+            save_vector(filename, data.to_vector());
+        }
+
+        template <typename T, size_t R, size_t C>
+        void save_matrix(
+            const std::string& filename,
+            const FixedMatrix<T, R, C>& data
+        ) {
+            save_matrix(filename, data.to_matrix());
+        }
     }
 }
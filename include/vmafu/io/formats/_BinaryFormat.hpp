@@ -0,0 +1,76 @@
+// io/formats/_BinaryFormat.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <stdexcept>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+
+#include "_IBinaryFormat.hpp"
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Native vmafu binary layout: a fixed 64-byte header followed by
+            // the raw row-major elements
+
+            class BinaryFormat : public IBinaryFormat {
+                public:
+                    // Constants
+
+                    static constexpr char MAGIC[8] = {
+                        'V', 'M', 'A', 'F', 'U', 'B', 'I', 'N'
+                    };
+
+                    static constexpr std::uint32_t VERSION = 1;
+                    static constexpr size_t HEADER_SIZE = 64;
+
+                    // Constructor
+
+                    BinaryFormat() = default;
+
+                    // Array methods
+
+                    ArrayInfo read_info(
+                        const std::string& filename
+                    ) const override;
+
+                    void read_data(
+                        const std::string& filename,
+                        const ArrayInfo& info,
+                        size_t first,
+                        size_t count,
+                        void* buffer
+                    ) const override;
+
+                    void write_array(
+                        const std::string& filename,
+                        const ArrayInfo& info,
+                        const void* data
+                    ) const override;
+
+                    // Validation method
+
+                    bool validate(const std::string& content) const override;
+
+                    // Static methods
+
+                    static std::string encode_header(const ArrayInfo& info);
+
+                    static ArrayInfo decode_header(const char* header);
+
+                    static FormatPtr create();
+            };
+        }
+
+        using formats::BinaryFormat;
+    }
+}
+
+
+#include "detail/_BinaryFormat.ipp"
@@ -0,0 +1,132 @@
+// io/formats/_ChunkedFormat.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+#include <istream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+#include "_IBinaryFormat.hpp"
+
+#include "../compression/_codecs.hpp"
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Chunk table entry: stored_size == raw size marks a chunk
+            // written without compression
+
+            struct ChunkEntry {
+                std::uint64_t offset;
+                std::uint64_t stored_size;
+            };
+
+            struct ChunkLayout {
+                ArrayInfo info;
+
+                compression::Codec codec;
+                bool shuffle;
+
+                size_t chunk_elements;
+
+                std::vector<ChunkEntry> chunks;
+
+                // Methods
+
+                size_t chunk_size(size_t chunk) const noexcept;
+            };
+
+            // Block-compressed vmafu binary layout: a 64-byte header, a
+            // table of chunk offsets and the independently compressed
+            // chunks of chunk_elements row-major elements each
+
+            class ChunkedFormat : public IBinaryFormat {
+                private:
+                    compression::Codec _codec;
+                    bool _shuffle;
+                    size_t _chunk_bytes;
+
+                    // Helper method
+
+                    static void decode_chunk(
+                        const ChunkLayout& layout,
+                        size_t chunk,
+                        const std::string& stored,
+                        std::string& scratch,
+                        char* destination
+                    );
+
+                public:
+                    // Constants
+
+                    static constexpr char MAGIC[8] = {
+                        'V', 'M', 'A', 'F', 'U', 'V', 'M', 'Z'
+                    };
+
+                    static constexpr std::uint32_t VERSION = 1;
+                    static constexpr size_t HEADER_SIZE = 64;
+                    static constexpr size_t DEFAULT_CHUNK_BYTES = 1 << 20;
+
+                    // Constructor
+
+                    explicit ChunkedFormat(
+                        compression::Codec codec = compression::Codec::LZ,
+                        bool shuffle = true,
+                        size_t chunk_bytes = DEFAULT_CHUNK_BYTES
+                    );
+
+                    // Getters
+
+                    compression::Codec codec() const noexcept;
+                    bool shuffle() const noexcept;
+                    size_t chunk_bytes() const noexcept;
+
+                    // Array methods
+
+                    ArrayInfo read_info(
+                        const std::string& filename
+                    ) const override;
+
+                    void read_data(
+                        const std::string& filename,
+                        const ArrayInfo& info,
+                        size_t first,
+                        size_t count,
+                        void* buffer
+                    ) const override;
+
+                    void write_array(
+                        const std::string& filename,
+                        const ArrayInfo& info,
+                        const void* data
+                    ) const override;
+
+                    // Validation method
+
+                    bool validate(const std::string& content) const override;
+
+                    // Static methods
+
+                    static ChunkLayout read_layout(std::istream& stream);
+
+                    static ChunkLayout read_layout(const std::string& filename);
+
+                    static FormatPtr create();
+            };
+        }
+
+        using formats::ChunkedFormat;
+    }
+}
+
+
+#include "detail/_ChunkedFormat.ipp"
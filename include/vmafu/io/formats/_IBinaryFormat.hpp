@@ -0,0 +1,187 @@
+// io/formats/_IBinaryFormat.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <fstream>
+#include <cstdint>
+#include <type_traits>
+#include <cstring>
+
+#include "_IFormat.hpp"
+
+#include "../../utils/_compat.hpp"
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Element types
+
+            enum class DataType : std::uint32_t {
+                UNKNOWN = 0,
+                INT32 = 1,
+                INT64 = 2,
+                FLOAT32 = 3,
+                FLOAT64 = 4
+            };
+
+            // Array description
+
+            struct ArrayInfo {
+                DataType dtype = DataType::UNKNOWN;
+
+                size_t rows = 0;
+                size_t cols = 0;
+
+                // Rank of the stored array ( vectors are 1 x n with ndim 1 )
+
+                size_t ndim = 2;
+
+                size_t data_offset = 0;
+
+                bool fortran_order = false;
+                bool big_endian = false;
+
+                // Elements are stored raw, in row-major order, at data_offset
+
+                bool contiguous = true;
+
+                size_t size() const noexcept;
+            };
+
+            // Helper methods
+
+            inline size_t data_type_size(DataType dtype);
+
+            inline std::string data_type_name(DataType dtype);
+
+            template <typename T>
+            inline DataType data_type();
+
+            inline bool is_big_endian_host() noexcept;
+
+            inline void swap_bytes(
+                void* data,
+                size_t count,
+                size_t element_size
+            ) noexcept;
+
+            template <typename T>
+            inline void convert_elements(
+                const void* source,
+                const ArrayInfo& info,
+                size_t count,
+                T* destination
+            );
+
+            template <typename T>
+            inline void convert_elements(
+                const T* source,
+                size_t count,
+                const ArrayInfo& info,
+                void* destination
+            );
+
+            // Binary format interface
+
+            class IBinaryFormat : public IFormat {
+                public:
+                    // Destructor
+
+                    virtual ~IBinaryFormat() = default;
+
+                    // Array methods
+
+                    virtual ArrayInfo read_info(
+                        const std::string& filename
+                    ) const = 0;
+
+                    virtual void read_data(
+                        const std::string& filename,
+                        const ArrayInfo& info,
+                        size_t first,
+                        size_t count,
+                        void* buffer
+                    ) const = 0;
+
+                    virtual void write_array(
+                        const std::string& filename,
+                        const ArrayInfo& info,
+                        const void* data
+                    ) const = 0;
+
+                    // Read methods ( raw bytes )
+
+                    std::string read(
+                        const std::string& filename
+                    ) const override;
+
+                    std::string read_stream(
+                        std::istream& stream
+                    ) const override;
+
+                    std::string read_chunk(
+                        std::istream& stream,
+                        size_t chunk_size = 2048
+                    ) const override;
+
+                    std::string read_chunks(
+                        const std::string& filename,
+                        size_t chunk_size = 2048
+                    ) const override;
+
+                    std::string read_stream_chunks(
+                        std::istream& stream,
+                        size_t chunk_size = 2048
+                    ) const override;
+
+                    // Write methods ( raw bytes )
+
+                    void write(
+                        const std::string& filename,
+                        const std::string& content
+                    ) const override;
+
+                    void write_stream(
+                        std::ostream& stream,
+                        const std::string& content
+                    ) const override;
+
+                    void write_chunk(
+                        std::ostream& stream,
+                        const std::string& chunk
+                    ) const override;
+
+                    void write_chunks(
+                        const std::string& filename,
+                        const std::string& content,
+                        size_t chunk_size = 2048
+                    ) const override;
+
+                    void write_stream_chunks(
+                        std::ostream& stream,
+                        const std::string& content,
+                        size_t chunk_size = 2048
+                    ) const override;
+
+                    // Validation method
+
+                    bool validate_stream(
+                        std::istream& stream
+                    ) const override;
+            };
+
+            using BinaryFormatPtr = std::shared_ptr<IBinaryFormat>;
+        }
+
+        using formats::BinaryFormatPtr;
+    }
+}
+
+
+#include "detail/_IBinaryFormat.ipp"
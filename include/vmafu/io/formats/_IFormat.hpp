@@ -5,16 +5,37 @@
 
 
 #include <string>
+#include <string_view>
 #include <memory>
 #include <stdexcept>
 #include <fstream>
 
+#include "../../utils/_compat.hpp"
+
+#if VMAFU_HAS_MMAP
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/stat.h>
+#endif
+
 
 namespace vmafu {
     namespace io {
         namespace formats {
             class IFormat {
+                private:
+                    // Helper method
+
+                    static std::string& pooled_buffer();
+
                 public:
+                    // Constants
+
+                    // Capacity the per-thread pooled buffer may keep
+                    // between reads
+
+                    static constexpr size_t POOL_LIMIT = size_t(16) << 20;
+
                     // Destructor
 
                     virtual ~IFormat() = default;
@@ -44,6 +65,24 @@ namespace vmafu {
                         size_t chunk_size = 2048
                     ) const = 0;
 
+                    // Buffered read methods ( raw file bytes; the buffer only
+                    // reallocates when a larger file comes along )
+
+                    virtual std::string_view read_view(
+                        const std::string& filename,
+                        std::string& buffer
+                    ) const;
+
+                    // Per-thread pooled buffer: the view stays valid until
+                    // the next pooled read or release on the same thread
+
+                    std::string_view read_view(const std::string& filename) const;
+
+                    // Frees this thread's pooled buffer when its capacity
+                    // exceeds keep
+
+                    static void release_pooled_buffer(size_t keep = POOL_LIMIT);
+
                     // Write methods
 
                     virtual void write(
@@ -90,3 +129,6 @@ namespace vmafu {
         using formats::FormatPtr;
     }
 }
+
+
+#include "detail/_IFormat.ipp"
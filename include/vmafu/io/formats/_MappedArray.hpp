@@ -0,0 +1,79 @@
+// io/formats/_MappedArray.hpp
+
+
+#pragma once
+
+
+#include <memory>
+#include <string>
+#include <stdexcept>
+
+#include "_IBinaryFormat.hpp"
+#include "_MappedFile.hpp"
+
+#include "../../core/_Matrix.hpp"
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Zero-copy, read-only matrix over the payload of a mapped
+            // binary file; valid only while the array is alive
+
+            template <typename T>
+            class MappedArray {
+                private:
+                    std::shared_ptr<MappedFile> _file;
+
+                    const T* _data;
+
+                    size_t _rows;
+                    size_t _cols;
+
+                public:
+                    // Constructors
+
+                    MappedArray();
+
+                    MappedArray(
+                        std::shared_ptr<MappedFile> file,
+                        const ArrayInfo& info
+                    );
+
+                    // Getters
+
+                    const T* data() const noexcept;
+
+                    size_t rows() const noexcept;
+                    size_t cols() const noexcept;
+
+                    size_t size() const noexcept;
+
+                    bool is_mapped() const noexcept;
+
+                    // Access methods
+
+                    const T& operator()(size_t row, size_t col) const noexcept;
+                    const T& operator[](size_t index) const noexcept;
+
+                    // Iterators
+
+                    const T* begin() const noexcept;
+                    const T* end() const noexcept;
+
+                    // Conversion method
+
+                    core::Matrix<T> to_matrix() const;
+
+                    // Static method
+
+                    static bool can_map(const ArrayInfo& info);
+            };
+        }
+
+        using formats::MappedArray;
+    }
+}
+
+
+#include "detail/_MappedArray.ipp"
@@ -0,0 +1,72 @@
+// io/formats/_MappedFile.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+
+#include "../../utils/_compat.hpp"
+
+#if VMAFU_HAS_MMAP
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Read-only view of a whole file, memory mapped where the
+            // platform allows it and read into a buffer otherwise
+
+            class MappedFile {
+                private:
+                    const char* _data;
+                    size_t _size;
+
+                    bool _mapped;
+
+                    std::vector<char> _buffer;
+
+                    // Helper method
+
+                    void release() noexcept;
+
+                public:
+                    // Constructors / Destructor
+
+                    MappedFile();
+
+                    explicit MappedFile(const std::string& filename);
+
+                    ~MappedFile();
+
+                    // Getters
+
+                    const char* data() const noexcept;
+                    size_t size() const noexcept;
+
+                    bool is_mapped() const noexcept;
+
+                    // Copy / Move operators
+
+                    MappedFile(const MappedFile&) = delete;
+                    MappedFile& operator=(const MappedFile&) = delete;
+
+                    MappedFile(MappedFile&& other) noexcept;
+                    MappedFile& operator=(MappedFile&& other) noexcept;
+            };
+        }
+
+        using formats::MappedFile;
+    }
+}
+
+
+#include "detail/_MappedFile.ipp"
@@ -0,0 +1,101 @@
+// io/formats/_MatrixMarketFormat.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+#include <istream>
+#include <sstream>
+#include <fstream>
+#include <limits>
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+
+#include "_TxtFormat.hpp"
+
+#include "../../core/_SparseMatrix.hpp"
+#include "../../utils/_compat.hpp"
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Matrix Market header
+
+            struct MarketInfo {
+                std::string field = "real";
+                std::string symmetry = "general";
+
+                size_t rows = 0;
+                size_t cols = 0;
+                size_t entries = 0;
+
+                // Byte offset of the first entry line
+
+                size_t data_offset = 0;
+            };
+
+            // Matrix Market coordinate files: a banner line, '%' comments,
+            // a "rows cols entries" size line and one 1-based
+            // "row col [value]" triple per line
+
+            class MatrixMarketFormat : public TxtFormat {
+                public:
+                    // Constants
+
+                    static constexpr const char* BANNER = "%%MatrixMarket";
+
+                    // Constructor
+
+                    MatrixMarketFormat() = default;
+
+                    // Validation method
+
+                    bool validate(const std::string& content) const override;
+
+                    // Header methods
+
+                    static MarketInfo read_info(const std::string& filename);
+
+                    static MarketInfo decode_header(std::istream& stream);
+
+                    static std::string encode_header(const MarketInfo& info);
+
+                    // Entry methods
+
+                    template <typename T>
+                    static size_t parse_entries(
+                        const char* begin,
+                        const char* end,
+                        const MarketInfo& info,
+                        std::vector<size_t>& row_indices,
+                        std::vector<size_t>& col_indices,
+                        std::vector<T>& values
+                    );
+
+                    template <typename T>
+                    static std::string encode_entries(
+                        const core::SparseMatrix<T>& matrix,
+                        size_t row_offset = 0
+                    );
+
+                    template <typename T>
+                    static std::string field_name();
+
+                    // Static method
+
+                    static FormatPtr create();
+            };
+        }
+
+        using formats::MarketInfo;
+        using formats::MatrixMarketFormat;
+    }
+}
+
+
+#include "detail/_MatrixMarketFormat.ipp"
@@ -0,0 +1,95 @@
+// io/formats/_NpyFormat.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+#include <istream>
+#include <sstream>
+#include <stdexcept>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+
+#include "_IBinaryFormat.hpp"
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // NumPy .npy layout ( format versions 1.0, 2.0 and 3.0 )
+
+            class NpyFormat : public IBinaryFormat {
+                private:
+                    // Helper methods
+
+                    static std::string dict_value(
+                        const std::string& header,
+                        const std::string& key
+                    );
+
+                    static void parse_descr(
+                        const std::string& descr,
+                        ArrayInfo& info
+                    );
+
+                    static void parse_shape(
+                        const std::string& shape,
+                        ArrayInfo& info
+                    );
+
+                public:
+                    // Constants
+
+                    static constexpr char MAGIC[6] = {
+                        '\x93', 'N', 'U', 'M', 'P', 'Y'
+                    };
+
+                    static constexpr size_t ALIGNMENT = 64;
+
+                    // Constructor
+
+                    NpyFormat() = default;
+
+                    // Array methods
+
+                    ArrayInfo read_info(
+                        const std::string& filename
+                    ) const override;
+
+                    void read_data(
+                        const std::string& filename,
+                        const ArrayInfo& info,
+                        size_t first,
+                        size_t count,
+                        void* buffer
+                    ) const override;
+
+                    void write_array(
+                        const std::string& filename,
+                        const ArrayInfo& info,
+                        const void* data
+                    ) const override;
+
+                    // Validation method
+
+                    bool validate(const std::string& content) const override;
+
+                    // Static methods
+
+                    static std::string encode_header(const ArrayInfo& info);
+
+                    static ArrayInfo decode_header(std::istream& stream);
+
+                    static FormatPtr create();
+            };
+        }
+
+        using formats::NpyFormat;
+    }
+}
+
+
+#include "detail/_NpyFormat.ipp"
@@ -0,0 +1,202 @@
+// io/formats/detail/_BinaryFormat.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Array methods
+
+            inline ArrayInfo BinaryFormat::read_info(
+                const std::string& filename
+            ) const {
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "BinaryFormat::read_info(): Cannot open file: " + filename
+                    );
+                }
+
+                char header[HEADER_SIZE];
+
+                file.read(header, HEADER_SIZE);
+                if (file.gcount() != static_cast<std::streamsize>(HEADER_SIZE)) {
+                    throw std::runtime_error(
+                        "BinaryFormat::read_info(): Truncated header: " + filename
+                    );
+                }
+
+                return decode_header(header);
+            }
+
+            inline void BinaryFormat::read_data(
+                const std::string& filename,
+                const ArrayInfo& info,
+                size_t first,
+                size_t count,
+                void* buffer
+            ) const {
+                if (first + count > info.size()) {
+                    throw std::out_of_range(
+                        "BinaryFormat::read_data(): Element range out of bounds"
+                    );
+                }
+
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "BinaryFormat::read_data(): Cannot open file: " + filename
+                    );
+                }
+
+                size_t element_size = data_type_size(info.dtype);
+
+                file.seekg(
+                    static_cast<std::streamoff>(
+                        info.data_offset + first * element_size
+                    )
+                );
+                file.read(
+                    static_cast<char*>(buffer),
+                    static_cast<std::streamsize>(count * element_size)
+                );
+
+                if (!file) {
+                    throw std::runtime_error(
+                        "BinaryFormat::read_data(): Unexpected end of file: " + filename
+                    );
+                }
+            }
+
+            inline void BinaryFormat::write_array(
+                const std::string& filename,
+                const ArrayInfo& info,
+                const void* data
+            ) const {
+                std::ofstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "BinaryFormat::write_array(): Cannot open file: " + filename
+                    );
+                }
+
+                std::string header = encode_header(info);
+
+                file.write(header.data(), static_cast<std::streamsize>(header.size()));
+                file.write(
+                    static_cast<const char*>(data),
+                    static_cast<std::streamsize>(
+                        info.size() * data_type_size(info.dtype)
+                    )
+                );
+
+                if (!file) {
+                    throw std::runtime_error(
+                        "BinaryFormat::write_array(): Failed to write file: " + filename
+                    );
+                }
+            }
+
+            // Validation method
+
+            inline bool BinaryFormat::validate(
+                const std::string& content
+            ) const {
+                if (content.size() < HEADER_SIZE) {
+                    return false;
+                }
+
+                try {
+                    ArrayInfo info = decode_header(content.data());
+
+                    return content.size() >= info.data_offset + \
+                        info.size() * data_type_size(info.dtype);
+                } catch (...) {
+                    return false;
+                }
+            }
+
+            // Static methods
+
+            inline std::string BinaryFormat::encode_header(
+                const ArrayInfo& info
+            ) {
+                std::string header(HEADER_SIZE, '\0');
+
+                std::uint32_t version = VERSION;
+                std::uint32_t dtype = static_cast<std::uint32_t>(info.dtype);
+                std::uint64_t rows = info.rows;
+                std::uint64_t cols = info.cols;
+                std::uint8_t big_endian = is_big_endian_host() ? 1 : 0;
+
+                std::memcpy(&header[0], MAGIC, 8);
+                std::memcpy(&header[8], &version, 4);
+                std::memcpy(&header[12], &dtype, 4);
+                std::memcpy(&header[16], &rows, 8);
+                std::memcpy(&header[24], &cols, 8);
+                std::memcpy(&header[32], &big_endian, 1);
+
+                return header;
+            }
+
+            inline ArrayInfo BinaryFormat::decode_header(const char* header) {
+                if (std::memcmp(header, MAGIC, 8) != 0) {
+                    throw std::runtime_error(
+                        "BinaryFormat::decode_header(): Not a vmafu binary file"
+                    );
+                }
+
+                std::uint32_t version;
+                std::uint32_t dtype;
+                std::uint64_t rows;
+                std::uint64_t cols;
+                std::uint8_t big_endian;
+
+                std::memcpy(&version, header + 8, 4);
+                std::memcpy(&dtype, header + 12, 4);
+                std::memcpy(&rows, header + 16, 8);
+                std::memcpy(&cols, header + 24, 8);
+                std::memcpy(&big_endian, header + 32, 1);
+
+                if ((big_endian != 0) != is_big_endian_host()) {
+                    swap_bytes(&version, 1, 4);
+                    swap_bytes(&dtype, 1, 4);
+                    swap_bytes(&rows, 1, 8);
+                    swap_bytes(&cols, 1, 8);
+                }
+
+                if (version != VERSION) {
+                    throw std::runtime_error(
+                        "BinaryFormat::decode_header(): Unsupported version " + \
+                        std::to_string(version)
+                    );
+                }
+
+                if (
+                    dtype == static_cast<std::uint32_t>(DataType::UNKNOWN) || \
+                    dtype > static_cast<std::uint32_t>(DataType::FLOAT64)
+                ) {
+                    throw std::runtime_error(
+                        "BinaryFormat::decode_header(): Unknown data type " + \
+                        std::to_string(dtype)
+                    );
+                }
+
+                ArrayInfo info;
+
+                info.dtype = static_cast<DataType>(dtype);
+                info.rows = static_cast<size_t>(rows);
+                info.cols = static_cast<size_t>(cols);
+                info.data_offset = HEADER_SIZE;
+                info.fortran_order = false;
+                info.big_endian = big_endian != 0;
+                info.contiguous = true;
+
+                return info;
+            }
+
+            inline FormatPtr BinaryFormat::create() {
+                return std::make_shared<BinaryFormat>();
+            }
+        }
+    }
+}
@@ -0,0 +1,448 @@
+// io/formats/detail/_ChunkedFormat.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Struct methods
+
+            inline size_t ChunkLayout::chunk_size(size_t chunk) const noexcept {
+                size_t first = chunk * chunk_elements;
+
+                return std::min(chunk_elements, info.size() - first);
+            }
+
+            // Helper method
+
+            inline void ChunkedFormat::decode_chunk(
+                const ChunkLayout& layout,
+                size_t chunk,
+                const std::string& stored,
+                std::string& scratch,
+                char* destination
+            ) {
+                size_t element_size = data_type_size(layout.info.dtype);
+                size_t elements = layout.chunk_size(chunk);
+                size_t raw_size = elements * element_size;
+
+                bool compressed = stored.size() != raw_size;
+
+                if (!compressed && !layout.shuffle) {
+                    std::memcpy(destination, stored.data(), raw_size);
+
+                    return;
+                }
+
+                char* target = destination;
+
+                if (layout.shuffle) {
+                    scratch.resize(raw_size);
+                    target = &scratch[0];
+                }
+
+                if (compressed) {
+                    compression::decompress(
+                        layout.codec, stored.data(), stored.size(), target, raw_size
+                    );
+                } else {
+                    std::memcpy(target, stored.data(), raw_size);
+                }
+
+                if (layout.shuffle) {
+                    compression::unshuffle(
+                        scratch.data(), elements, element_size, destination
+                    );
+                }
+            }
+
+            // Constructor
+
+            inline ChunkedFormat::ChunkedFormat(
+                compression::Codec codec,
+                bool shuffle,
+                size_t chunk_bytes
+            ) : _codec(codec), _shuffle(shuffle), _chunk_bytes(chunk_bytes) {
+                if (!compression::codec_available(codec)) {
+                    throw std::invalid_argument(
+                        "ChunkedFormat::ChunkedFormat(): Codec not available: " + \
+                        compression::codec_name(codec)
+                    );
+                }
+
+                if (chunk_bytes == 0) {
+                    throw std::invalid_argument(
+                        "ChunkedFormat::ChunkedFormat(): Chunk size must be positive"
+                    );
+                }
+            }
+
+            // Getters
+
+            inline compression::Codec ChunkedFormat::codec() const noexcept {
+                return _codec;
+            }
+
+            inline bool ChunkedFormat::shuffle() const noexcept {
+                return _shuffle;
+            }
+
+            inline size_t ChunkedFormat::chunk_bytes() const noexcept {
+                return _chunk_bytes;
+            }
+
+            // Array methods
+
+            inline ArrayInfo ChunkedFormat::read_info(
+                const std::string& filename
+            ) const {
+                return read_layout(filename).info;
+            }
+
+            inline void ChunkedFormat::read_data(
+                const std::string& filename,
+                const ArrayInfo& info,
+                size_t first,
+                size_t count,
+                void* buffer
+            ) const {
+                if (first + count > info.size()) {
+                    throw std::out_of_range(
+                        "ChunkedFormat::read_data(): Element range out of bounds"
+                    );
+                }
+
+                if (count == 0) {
+                    return;
+                }
+
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::read_data(): Cannot open file: " + filename
+                    );
+                }
+
+                ChunkLayout layout = read_layout(file);
+
+                size_t element_size = data_type_size(layout.info.dtype);
+
+                char* output = static_cast<char*>(buffer);
+
+                std::string stored;
+                std::string scratch;
+                std::string decoded;
+
+                // Only the chunks overlapping [first, first + count) are read
+
+                size_t first_chunk = first / layout.chunk_elements;
+                size_t last_chunk = (first + count - 1) / layout.chunk_elements;
+
+                for (size_t c = first_chunk; c <= last_chunk; c++) {
+                    const ChunkEntry& entry = layout.chunks[c];
+
+                    stored.resize(static_cast<size_t>(entry.stored_size));
+
+                    file.seekg(static_cast<std::streamoff>(entry.offset));
+                    file.read(&stored[0], static_cast<std::streamsize>(stored.size()));
+
+                    if (!file) {
+                        throw std::runtime_error(
+                            "ChunkedFormat::read_data(): Unexpected end of file: " + filename
+                        );
+                    }
+
+                    size_t chunk_first = c * layout.chunk_elements;
+                    size_t chunk_count = layout.chunk_size(c);
+
+                    size_t begin = std::max(first, chunk_first);
+                    size_t end = std::min(first + count, chunk_first + chunk_count);
+
+                    // Whole chunks decode straight into the caller's buffer
+
+                    if (begin == chunk_first && end == chunk_first + chunk_count) {
+                        decode_chunk(
+                            layout, c, stored, scratch,
+                            output + (begin - first) * element_size
+                        );
+                    } else {
+                        decoded.resize(chunk_count * element_size);
+
+                        decode_chunk(layout, c, stored, scratch, &decoded[0]);
+
+                        std::memcpy(
+                            output + (begin - first) * element_size,
+                            decoded.data() + (begin - chunk_first) * element_size,
+                            (end - begin) * element_size
+                        );
+                    }
+                }
+            }
+
+            inline void ChunkedFormat::write_array(
+                const std::string& filename,
+                const ArrayInfo& info,
+                const void* data
+            ) const {
+                std::ofstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::write_array(): Cannot open file: " + filename
+                    );
+                }
+
+                size_t element_size = data_type_size(info.dtype);
+                size_t chunk_elements = std::max<size_t>(1, _chunk_bytes / element_size);
+                size_t chunk_count = (info.size() + chunk_elements - 1) / chunk_elements;
+
+                std::string header(HEADER_SIZE, '\0');
+
+                std::uint32_t version = VERSION;
+                std::uint32_t dtype = static_cast<std::uint32_t>(info.dtype);
+                std::uint64_t rows = info.rows;
+                std::uint64_t cols = info.cols;
+                std::uint8_t big_endian = is_big_endian_host() ? 1 : 0;
+                std::uint8_t codec = static_cast<std::uint8_t>(_codec);
+                std::uint8_t shuffle = _shuffle ? 1 : 0;
+                std::uint8_t ndim = static_cast<std::uint8_t>(info.ndim);
+                std::uint64_t chunk_elements_field = chunk_elements;
+                std::uint64_t chunk_count_field = chunk_count;
+
+                std::memcpy(&header[0], MAGIC, 8);
+                std::memcpy(&header[8], &version, 4);
+                std::memcpy(&header[12], &dtype, 4);
+                std::memcpy(&header[16], &rows, 8);
+                std::memcpy(&header[24], &cols, 8);
+                std::memcpy(&header[32], &big_endian, 1);
+                std::memcpy(&header[33], &codec, 1);
+                std::memcpy(&header[34], &shuffle, 1);
+                std::memcpy(&header[35], &ndim, 1);
+                std::memcpy(&header[40], &chunk_elements_field, 8);
+                std::memcpy(&header[48], &chunk_count_field, 8);
+
+                std::vector<ChunkEntry> table(chunk_count);
+
+                // The table is written once the chunk sizes are known
+
+                file.write(header.data(), static_cast<std::streamsize>(HEADER_SIZE));
+                file.write(
+                    reinterpret_cast<const char*>(table.data()),
+                    static_cast<std::streamsize>(chunk_count * sizeof(ChunkEntry))
+                );
+
+                const char* bytes = static_cast<const char*>(data);
+
+                std::uint64_t offset = HEADER_SIZE + chunk_count * sizeof(ChunkEntry);
+
+                std::string shuffled;
+
+                for (size_t c = 0; c < chunk_count; c++) {
+                    size_t elements = std::min(
+                        chunk_elements, info.size() - c * chunk_elements
+                    );
+                    size_t raw_size = elements * element_size;
+
+                    const char* raw = bytes + c * chunk_elements * element_size;
+
+                    if (_shuffle) {
+                        shuffled.resize(raw_size);
+                        compression::shuffle(raw, elements, element_size, &shuffled[0]);
+
+                        raw = shuffled.data();
+                    }
+
+                    std::string stored;
+
+                    if (_codec != compression::Codec::NONE) {
+                        stored = compression::compress(_codec, raw, raw_size);
+                    }
+
+                    // Incompressible chunks are stored raw
+
+                    if (_codec == compression::Codec::NONE || stored.size() >= raw_size) {
+                        stored.assign(raw, raw_size);
+                    }
+
+                    file.write(stored.data(), static_cast<std::streamsize>(stored.size()));
+
+                    table[c].offset = offset;
+                    table[c].stored_size = stored.size();
+
+                    offset += stored.size();
+                }
+
+                file.seekp(static_cast<std::streamoff>(HEADER_SIZE));
+                file.write(
+                    reinterpret_cast<const char*>(table.data()),
+                    static_cast<std::streamsize>(chunk_count * sizeof(ChunkEntry))
+                );
+
+                if (!file) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::write_array(): Failed to write file: " + filename
+                    );
+                }
+            }
+
+            // Validation method
+
+            inline bool ChunkedFormat::validate(
+                const std::string& content
+            ) const {
+                try {
+                    std::istringstream iss(content);
+
+                    ChunkLayout layout = read_layout(iss);
+
+                    for (const ChunkEntry& entry : layout.chunks) {
+                        if (entry.offset + entry.stored_size > content.size()) {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                } catch (...) {
+                    return false;
+                }
+            }
+
+            // Static methods
+
+            inline ChunkLayout ChunkedFormat::read_layout(std::istream& stream) {
+                char header[HEADER_SIZE];
+
+                stream.read(header, HEADER_SIZE);
+                if (stream.gcount() != static_cast<std::streamsize>(HEADER_SIZE)) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::read_layout(): Truncated header"
+                    );
+                }
+
+                if (std::memcmp(header, MAGIC, 8) != 0) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::read_layout(): Not a vmafu chunked file"
+                    );
+                }
+
+                std::uint32_t version;
+                std::uint32_t dtype;
+                std::uint64_t rows;
+                std::uint64_t cols;
+                std::uint8_t big_endian;
+                std::uint8_t codec;
+                std::uint8_t shuffle;
+                std::uint8_t ndim;
+                std::uint64_t chunk_elements;
+                std::uint64_t chunk_count;
+
+                std::memcpy(&version, header + 8, 4);
+                std::memcpy(&dtype, header + 12, 4);
+                std::memcpy(&rows, header + 16, 8);
+                std::memcpy(&cols, header + 24, 8);
+                std::memcpy(&big_endian, header + 32, 1);
+                std::memcpy(&codec, header + 33, 1);
+                std::memcpy(&shuffle, header + 34, 1);
+                std::memcpy(&ndim, header + 35, 1);
+                std::memcpy(&chunk_elements, header + 40, 8);
+                std::memcpy(&chunk_count, header + 48, 8);
+
+                bool swap = (big_endian != 0) != is_big_endian_host();
+
+                if (swap) {
+                    swap_bytes(&version, 1, 4);
+                    swap_bytes(&dtype, 1, 4);
+                    swap_bytes(&rows, 1, 8);
+                    swap_bytes(&cols, 1, 8);
+                    swap_bytes(&chunk_elements, 1, 8);
+                    swap_bytes(&chunk_count, 1, 8);
+                }
+
+                if (version != VERSION) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::read_layout(): Unsupported version " + \
+                        std::to_string(version)
+                    );
+                }
+
+                if (
+                    dtype == static_cast<std::uint32_t>(DataType::UNKNOWN) || \
+                    dtype > static_cast<std::uint32_t>(DataType::FLOAT64)
+                ) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::read_layout(): Unknown data type " + \
+                        std::to_string(dtype)
+                    );
+                }
+
+                if (!compression::codec_available(static_cast<compression::Codec>(codec))) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::read_layout(): Codec not available: " + \
+                        compression::codec_name(static_cast<compression::Codec>(codec))
+                    );
+                }
+
+                ChunkLayout layout;
+
+                layout.info.dtype = static_cast<DataType>(dtype);
+                layout.info.rows = static_cast<size_t>(rows);
+                layout.info.cols = static_cast<size_t>(cols);
+                layout.info.ndim = ndim;
+                layout.info.fortran_order = false;
+                layout.info.big_endian = big_endian != 0;
+                layout.info.contiguous = false;
+
+                layout.codec = static_cast<compression::Codec>(codec);
+                layout.shuffle = shuffle != 0;
+                layout.chunk_elements = static_cast<size_t>(chunk_elements);
+
+                size_t expected = layout.chunk_elements == 0 ? 0 : (
+                    layout.info.size() + layout.chunk_elements - 1
+                ) / layout.chunk_elements;
+
+                if (layout.chunk_elements == 0 || chunk_count != expected) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::read_layout(): Inconsistent chunk table"
+                    );
+                }
+
+                layout.chunks.resize(static_cast<size_t>(chunk_count));
+
+                stream.read(
+                    reinterpret_cast<char*>(layout.chunks.data()),
+                    static_cast<std::streamsize>(chunk_count * sizeof(ChunkEntry))
+                );
+
+                if (!stream) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::read_layout(): Truncated chunk table"
+                    );
+                }
+
+                if (swap) {
+                    swap_bytes(layout.chunks.data(), 2 * layout.chunks.size(), 8);
+                }
+
+                layout.info.data_offset = HEADER_SIZE + \
+                    layout.chunks.size() * sizeof(ChunkEntry);
+
+                return layout;
+            }
+
+            inline ChunkLayout ChunkedFormat::read_layout(
+                const std::string& filename
+            ) {
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "ChunkedFormat::read_layout(): Cannot open file: " + filename
+                    );
+                }
+
+                return read_layout(file);
+            }
+
+            inline FormatPtr ChunkedFormat::create() {
+                return std::make_shared<ChunkedFormat>();
+            }
+        }
+    }
+}
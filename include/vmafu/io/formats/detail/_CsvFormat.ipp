@@ -23,16 +23,13 @@ namespace vmafu {
             std::string CsvFormat::read(
                 const std::string& filename
             ) const {
-                std::ifstream file(filename);
-                if (!file.is_open()) {
-                    throw std::runtime_error(
-                        "CsvFormat::read(): Cannot open file: " + filename
-                    );
-                }
+                std::string result;
 
-                std::string result = read_stream(file);
+                read_view(filename, result);
 
-                file.close();
+                if (!result.empty() && result.back() != '\n') {
+                    result += '\n';
+                }
 
                 return result;
             }
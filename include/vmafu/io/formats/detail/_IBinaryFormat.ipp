@@ -0,0 +1,387 @@
+// io/formats/detail/_IBinaryFormat.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Struct methods
+
+            inline size_t ArrayInfo::size() const noexcept {
+                return rows * cols;
+            }
+
+            // Helper methods
+
+            size_t data_type_size(DataType dtype) {
+                switch (dtype) {
+                    case DataType::INT32: {
+                        return 4;
+                    }
+                    case DataType::INT64: {
+                        return 8;
+                    }
+                    case DataType::FLOAT32: {
+                        return 4;
+                    }
+                    case DataType::FLOAT64: {
+                        return 8;
+                    }
+                    default: {
+                        throw std::invalid_argument(
+                            "formats::data_type_size(): Unknown data type"
+                        );
+                    }
+                }
+            }
+
+            std::string data_type_name(DataType dtype) {
+                switch (dtype) {
+                    case DataType::INT32: {
+                        return "int32";
+                    }
+                    case DataType::INT64: {
+                        return "int64";
+                    }
+                    case DataType::FLOAT32: {
+                        return "float32";
+                    }
+                    case DataType::FLOAT64: {
+                        return "float64";
+                    }
+                    default: {
+                        return "unknown";
+                    }
+                }
+            }
+
+            // Unsigned integers have no dtype code: tagging them INT32 /
+            // INT64 would make other readers ( e.g. NumPy ) see signed data
+
+            template <typename T>
+            DataType data_type() {
+                VMAFU_IF_CONSTEXPR (
+                    VMAFU_IS_INTEGRAL_V(T) && std::is_signed<T>::value && sizeof(T) == 4
+                ) {
+                    return DataType::INT32;
+                } else VMAFU_IF_CONSTEXPR (
+                    VMAFU_IS_INTEGRAL_V(T) && std::is_signed<T>::value && sizeof(T) == 8
+                ) {
+                    return DataType::INT64;
+                } else VMAFU_IF_CONSTEXPR (VMAFU_IS_SAME_V(T, float)) {
+                    return DataType::FLOAT32;
+                } else VMAFU_IF_CONSTEXPR (VMAFU_IS_SAME_V(T, double)) {
+                    return DataType::FLOAT64;
+                } else {
+                    return DataType::UNKNOWN;
+                }
+            }
+
+            bool is_big_endian_host() noexcept {
+                const std::uint16_t probe = 1;
+
+                unsigned char first_byte;
+                std::memcpy(&first_byte, &probe, 1);
+
+                return first_byte == 0;
+            }
+
+            void swap_bytes(
+                void* data,
+                size_t count,
+                size_t element_size
+            ) noexcept {
+                unsigned char* bytes = static_cast<unsigned char*>(data);
+
+                for (size_t i = 0; i < count; i++) {
+                    unsigned char* element = bytes + i * element_size;
+
+                    for (size_t b = 0; b < element_size / 2; b++) {
+                        std::swap(element[b], element[element_size - 1 - b]);
+                    }
+                }
+            }
+
+            template <typename T>
+            void convert_elements(
+                const void* source,
+                const ArrayInfo& info,
+                size_t count,
+                T* destination
+            ) {
+                bool swap = info.big_endian != is_big_endian_host();
+
+                if (info.dtype == data_type<T>() && !swap) {
+                    std::memcpy(destination, source, count * sizeof(T));
+
+                    return;
+                }
+
+                size_t element_size = data_type_size(info.dtype);
+
+                const unsigned char* bytes = static_cast<const unsigned char*>(
+                    source
+                );
+
+                for (size_t i = 0; i < count; i++) {
+                    unsigned char element[8];
+                    std::memcpy(element, bytes + i * element_size, element_size);
+
+                    if (swap) {
+                        swap_bytes(element, 1, element_size);
+                    }
+
+                    switch (info.dtype) {
+                        case DataType::INT32: {
+                            std::int32_t value;
+                            std::memcpy(&value, element, 4);
+                            destination[i] = static_cast<T>(value);
+                            break;
+                        }
+                        case DataType::INT64: {
+                            std::int64_t value;
+                            std::memcpy(&value, element, 8);
+                            destination[i] = static_cast<T>(value);
+                            break;
+                        }
+                        case DataType::FLOAT32: {
+                            float value;
+                            std::memcpy(&value, element, 4);
+                            destination[i] = static_cast<T>(value);
+                            break;
+                        }
+                        case DataType::FLOAT64: {
+                            double value;
+                            std::memcpy(&value, element, 8);
+                            destination[i] = static_cast<T>(value);
+                            break;
+                        }
+                        default: {
+                            throw std::invalid_argument(
+                                "formats::convert_elements(): Unknown data type"
+                            );
+                        }
+                    }
+                }
+            }
+
+            template <typename T>
+            void convert_elements(
+                const T* source,
+                size_t count,
+                const ArrayInfo& info,
+                void* destination
+            ) {
+                bool swap = info.big_endian != is_big_endian_host();
+
+                size_t element_size = data_type_size(info.dtype);
+
+                unsigned char* bytes = static_cast<unsigned char*>(destination);
+
+                if (info.dtype == data_type<T>()) {
+                    std::memcpy(destination, source, count * sizeof(T));
+                } else {
+                    for (size_t i = 0; i < count; i++) {
+                        unsigned char* element = bytes + i * element_size;
+
+                        switch (info.dtype) {
+                            case DataType::INT32: {
+                                std::int32_t value = static_cast<std::int32_t>(source[i]);
+                                std::memcpy(element, &value, 4);
+                                break;
+                            }
+                            case DataType::INT64: {
+                                std::int64_t value = static_cast<std::int64_t>(source[i]);
+                                std::memcpy(element, &value, 8);
+                                break;
+                            }
+                            case DataType::FLOAT32: {
+                                float value = static_cast<float>(source[i]);
+                                std::memcpy(element, &value, 4);
+                                break;
+                            }
+                            case DataType::FLOAT64: {
+                                double value = static_cast<double>(source[i]);
+                                std::memcpy(element, &value, 8);
+                                break;
+                            }
+                            default: {
+                                throw std::invalid_argument(
+                                    "formats::convert_elements(): Unknown data type"
+                                );
+                            }
+                        }
+                    }
+                }
+
+                if (swap) {
+                    swap_bytes(destination, count, element_size);
+                }
+            }
+
+            // Binary format interface
+
+            // Read methods ( raw bytes )
+
+            inline std::string IBinaryFormat::read(
+                const std::string& filename
+            ) const {
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "IBinaryFormat::read(): Cannot open file: " + filename
+                    );
+                }
+
+                std::string result = read_stream(file);
+
+                file.close();
+
+                return result;
+            }
+
+            inline std::string IBinaryFormat::read_stream(
+                std::istream& stream
+            ) const {
+                return read_stream_chunks(stream, 1 << 20);
+            }
+
+            inline std::string IBinaryFormat::read_chunk(
+                std::istream& stream,
+                size_t chunk_size
+            ) const {
+                std::string chunk(chunk_size, '\0');
+
+                stream.read(&chunk[0], static_cast<std::streamsize>(chunk_size));
+                chunk.resize(static_cast<size_t>(stream.gcount()));
+
+                return chunk;
+            }
+
+            inline std::string IBinaryFormat::read_chunks(
+                const std::string& filename,
+                size_t chunk_size
+            ) const {
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "IBinaryFormat::read_chunks(): Cannot open file: " + filename
+                    );
+                }
+
+                std::string result = read_stream_chunks(file, chunk_size);
+
+                file.close();
+
+                return result;
+            }
+
+            inline std::string IBinaryFormat::read_stream_chunks(
+                std::istream& stream,
+                size_t chunk_size
+            ) const {
+                std::string result;
+                std::string chunk;
+
+                do {
+                    chunk = read_chunk(stream, chunk_size);
+                    result += chunk;
+                } while (!chunk.empty());
+
+                return result;
+            }
+
+            // Write methods ( raw bytes )
+
+            inline void IBinaryFormat::write(
+                const std::string& filename,
+                const std::string& content
+            ) const {
+                std::ofstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "IBinaryFormat::write(): Cannot open file: " + filename
+                    );
+                }
+
+                write_stream(file, content);
+
+                file.close();
+            }
+
+            inline void IBinaryFormat::write_stream(
+                std::ostream& stream,
+                const std::string& content
+            ) const {
+                if (!validate(content)) {
+                    throw std::runtime_error(
+                        "IBinaryFormat::write_stream(): Invalid binary content"
+                    );
+                }
+
+                write_chunk(stream, content);
+            }
+
+            inline void IBinaryFormat::write_chunk(
+                std::ostream& stream,
+                const std::string& chunk
+            ) const {
+                stream.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+
+                if (!stream) {
+                    throw std::runtime_error(
+                        "IBinaryFormat::write_chunk(): Failed to write chunk to stream"
+                    );
+                }
+            }
+
+            inline void IBinaryFormat::write_chunks(
+                const std::string& filename,
+                const std::string& content,
+                size_t chunk_size
+            ) const {
+                std::ofstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "IBinaryFormat::write_chunks(): Cannot open file: " + filename
+                    );
+                }
+
+                write_stream_chunks(file, content, chunk_size);
+
+                file.close();
+            }
+
+            inline void IBinaryFormat::write_stream_chunks(
+                std::ostream& stream,
+                const std::string& content,
+                size_t chunk_size
+            ) const {
+                if (!validate(content)) {
+                    throw std::runtime_error(
+                        "IBinaryFormat::write_stream_chunks(): Invalid binary content"
+                    );
+                }
+
+                size_t pos = 0;
+
+                while (pos < content.size()) {
+                    size_t current_chunk_size = std::min(
+                        chunk_size, content.size() - pos
+                    );
+
+                    write_chunk(stream, content.substr(pos, current_chunk_size));
+
+                    pos += current_chunk_size;
+                }
+            }
+
+            // Validation method
+
+            inline bool IBinaryFormat::validate_stream(
+                std::istream& stream
+            ) const {
+                return validate(read_stream(stream));
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+// io/formats/detail/_IFormat.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Buffered read methods
+
+            inline std::string_view IFormat::read_view(
+                const std::string& filename,
+                std::string& buffer
+            ) const {
+#if VMAFU_HAS_MMAP
+                int fd = ::open(filename.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    throw std::runtime_error(
+                        "IFormat::read_view(): Cannot open file: " + filename
+                    );
+                }
+
+                struct stat info;
+                if (fstat(fd, &info) != 0) {
+                    ::close(fd);
+
+                    throw std::runtime_error(
+                        "IFormat::read_view(): Cannot stat file: " + filename
+                    );
+                }
+
+                buffer.resize(static_cast<size_t>(info.st_size));
+
+                // One read() in practice; the loop only covers short reads
+
+                size_t done = 0;
+
+                while (done < buffer.size()) {
+                    ssize_t count = ::read(fd, &buffer[done], buffer.size() - done);
+
+                    if (count <= 0) {
+                        ::close(fd);
+
+                        throw std::runtime_error(
+                            "IFormat::read_view(): Failed to read file: " + filename
+                        );
+                    }
+
+                    done += static_cast<size_t>(count);
+                }
+
+                ::close(fd);
+#else
+                std::ifstream file(filename, std::ios::binary | std::ios::ate);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "IFormat::read_view(): Cannot open file: " + filename
+                    );
+                }
+
+                buffer.resize(static_cast<size_t>(file.tellg()));
+
+                file.seekg(0);
+                file.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+
+                if (!file) {
+                    throw std::runtime_error(
+                        "IFormat::read_view(): Failed to read file: " + filename
+                    );
+                }
+#endif
+
+                return std::string_view(buffer.data(), buffer.size());
+            }
+
+            inline std::string_view IFormat::read_view(
+                const std::string& filename
+            ) const {
+                // A large buffer left by the previous read is not kept
+                // for this one
+
+                release_pooled_buffer();
+
+                return read_view(filename, pooled_buffer());
+            }
+
+            inline void IFormat::release_pooled_buffer(size_t keep) {
+                std::string& pooled = pooled_buffer();
+
+                if (pooled.capacity() > keep) {
+                    std::string().swap(pooled);
+                }
+            }
+
+            // Helper method
+
+            inline std::string& IFormat::pooled_buffer() {
+                thread_local std::string pooled;
+
+                return pooled;
+            }
+        }
+    }
+}
@@ -0,0 +1,110 @@
+// io/formats/detail/_MappedArray.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Constructors
+
+            template <typename T>
+            MappedArray<T>::MappedArray()
+                : _file(nullptr), _data(nullptr), _rows(0), _cols(0) {}
+
+            template <typename T>
+            MappedArray<T>::MappedArray(
+                std::shared_ptr<MappedFile> file,
+                const ArrayInfo& info
+            ) : _file(std::move(file)), _data(nullptr),
+                _rows(info.rows), _cols(info.cols) {
+                if (!can_map(info)) {
+                    throw std::invalid_argument(
+                        "MappedArray::MappedArray(): Array needs conversion, use io::load_matrix()"
+                    );
+                }
+
+                if (info.data_offset + info.size() * sizeof(T) > _file->size()) {
+                    throw std::runtime_error(
+                        "MappedArray::MappedArray(): File is shorter than its header declares"
+                    );
+                }
+
+                _data = reinterpret_cast<const T*>(_file->data() + info.data_offset);
+            }
+
+            // Getters
+
+            template <typename T>
+            const T* MappedArray<T>::data() const noexcept {
+                return _data;
+            }
+
+            template <typename T>
+            size_t MappedArray<T>::rows() const noexcept {
+                return _rows;
+            }
+
+            template <typename T>
+            size_t MappedArray<T>::cols() const noexcept {
+                return _cols;
+            }
+
+            template <typename T>
+            size_t MappedArray<T>::size() const noexcept {
+                return _rows * _cols;
+            }
+
+            template <typename T>
+            bool MappedArray<T>::is_mapped() const noexcept {
+                return _file && _file->is_mapped();
+            }
+
+            // Access methods
+
+            template <typename T>
+            const T& MappedArray<T>::operator()(
+                size_t row,
+                size_t col
+            ) const noexcept {
+                return _data[row * _cols + col];
+            }
+
+            template <typename T>
+            const T& MappedArray<T>::operator[](size_t index) const noexcept {
+                return _data[index];
+            }
+
+            // Iterators
+
+            template <typename T>
+            const T* MappedArray<T>::begin() const noexcept {
+                return _data;
+            }
+
+            template <typename T>
+            const T* MappedArray<T>::end() const noexcept {
+                return _data + size();
+            }
+
+            // Conversion method
+
+            template <typename T>
+            core::Matrix<T> MappedArray<T>::to_matrix() const {
+                core::Matrix<T> matrix(_rows, _cols);
+
+                std::copy(begin(), end(), matrix.begin());
+
+                return matrix;
+            }
+
+            // Static method
+
+            template <typename T>
+            bool MappedArray<T>::can_map(const ArrayInfo& info) {
+                return info.dtype == data_type<T>() && \
+                    info.big_endian == is_big_endian_host() && \
+                    !info.fortran_order && info.contiguous && \
+                    info.data_offset % alignof(T) == 0;
+            }
+        }
+    }
+}
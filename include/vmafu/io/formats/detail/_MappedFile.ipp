@@ -0,0 +1,145 @@
+// io/formats/detail/_MappedFile.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Helper method
+
+            inline void MappedFile::release() noexcept {
+#if VMAFU_HAS_MMAP
+                if (_mapped && _data != nullptr) {
+                    munmap(const_cast<char*>(_data), _size);
+                }
+#endif
+
+                _data = nullptr;
+                _size = 0;
+                _mapped = false;
+
+                _buffer.clear();
+            }
+
+            // Constructors / Destructor
+
+            inline MappedFile::MappedFile()
+                : _data(nullptr), _size(0), _mapped(false) {}
+
+            inline MappedFile::MappedFile(const std::string& filename)
+                : _data(nullptr), _size(0), _mapped(false) {
+#if VMAFU_HAS_MMAP
+                int fd = ::open(filename.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    throw std::runtime_error(
+                        "MappedFile::MappedFile(): Cannot open file: " + filename
+                    );
+                }
+
+                struct stat info;
+                if (fstat(fd, &info) != 0) {
+                    ::close(fd);
+
+                    throw std::runtime_error(
+                        "MappedFile::MappedFile(): Cannot stat file: " + filename
+                    );
+                }
+
+                _size = static_cast<size_t>(info.st_size);
+
+                if (_size > 0) {
+                    void* address = mmap(
+                        nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0
+                    );
+
+                    if (address != MAP_FAILED) {
+                        _data = static_cast<const char*>(address);
+                        _mapped = true;
+                    }
+                }
+
+                ::close(fd);
+
+                if (_mapped || _size == 0) {
+                    return;
+                }
+#endif
+
+                std::ifstream file(filename, std::ios::binary | std::ios::ate);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "MappedFile::MappedFile(): Cannot open file: " + filename
+                    );
+                }
+
+                _size = static_cast<size_t>(file.tellg());
+                _buffer.resize(_size);
+
+                file.seekg(0);
+                file.read(_buffer.data(), static_cast<std::streamsize>(_size));
+
+                if (!file) {
+                    throw std::runtime_error(
+                        "MappedFile::MappedFile(): Failed to read file: " + filename
+                    );
+                }
+
+                _data = _buffer.data();
+            }
+
+            inline MappedFile::~MappedFile() {
+                release();
+            }
+
+            // Getters
+
+            inline const char* MappedFile::data() const noexcept {
+                return _data;
+            }
+
+            inline size_t MappedFile::size() const noexcept {
+                return _size;
+            }
+
+            inline bool MappedFile::is_mapped() const noexcept {
+                return _mapped;
+            }
+
+            // Copy / Move operators
+
+            inline MappedFile::MappedFile(MappedFile&& other) noexcept
+                : _data(other._data),
+                  _size(other._size),
+                  _mapped(other._mapped),
+                  _buffer(std::move(other._buffer)) {
+                if (!_mapped) {
+                    _data = _buffer.data();
+                }
+
+                other._data = nullptr;
+                other._size = 0;
+                other._mapped = false;
+            }
+
+            inline MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+                if (this != &other) {
+                    release();
+
+                    _data = other._data;
+                    _size = other._size;
+                    _mapped = other._mapped;
+                    _buffer = std::move(other._buffer);
+
+                    if (!_mapped) {
+                        _data = _buffer.data();
+                    }
+
+                    other._data = nullptr;
+                    other._size = 0;
+                    other._mapped = false;
+                }
+
+                return *this;
+            }
+        }
+    }
+}
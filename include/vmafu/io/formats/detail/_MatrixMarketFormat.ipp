@@ -0,0 +1,280 @@
+// io/formats/detail/_MatrixMarketFormat.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Validation method
+
+            inline bool MatrixMarketFormat::validate(
+                const std::string& content
+            ) const {
+                try {
+                    std::istringstream iss(content);
+
+                    decode_header(iss);
+
+                    return true;
+                } catch (...) {
+                    return false;
+                }
+            }
+
+            // Header methods
+
+            inline MarketInfo MatrixMarketFormat::read_info(
+                const std::string& filename
+            ) {
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "MatrixMarketFormat::read_info(): Cannot open file: " + filename
+                    );
+                }
+
+                return decode_header(file);
+            }
+
+            inline MarketInfo MatrixMarketFormat::decode_header(
+                std::istream& stream
+            ) {
+                std::string line;
+                size_t offset = 0;
+
+                if (!std::getline(stream, line)) {
+                    throw std::runtime_error(
+                        "MatrixMarketFormat::decode_header(): Empty file"
+                    );
+                }
+
+                offset += line.size() + 1;
+
+                for (char& c : line) {
+                    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+                }
+
+                std::istringstream banner(line);
+                std::string marker, object, format;
+
+                MarketInfo info;
+
+                banner >> marker >> object >> format >> info.field >> info.symmetry;
+
+                if (marker != "%%matrixmarket" || object != "matrix") {
+                    throw std::runtime_error(
+                        "MatrixMarketFormat::decode_header(): Missing %%MatrixMarket banner"
+                    );
+                }
+
+                if (format != "coordinate") {
+                    throw std::runtime_error(
+                        "MatrixMarketFormat::decode_header(): Only coordinate format is supported"
+                    );
+                }
+
+                if (info.field == "double") {
+                    info.field = "real";
+                }
+
+                if (
+                    info.field != "real" && \
+                    info.field != "integer" && \
+                    info.field != "pattern"
+                ) {
+                    throw std::runtime_error(
+                        "MatrixMarketFormat::decode_header(): Unsupported field: " + info.field
+                    );
+                }
+
+                if (
+                    info.symmetry != "general" && \
+                    info.symmetry != "symmetric" && \
+                    info.symmetry != "skew-symmetric"
+                ) {
+                    throw std::runtime_error(
+                        "MatrixMarketFormat::decode_header(): Unsupported symmetry: " + info.symmetry
+                    );
+                }
+
+                while (std::getline(stream, line)) {
+                    offset += line.size() + 1;
+
+                    size_t first = line.find_first_not_of(" \t\r");
+
+                    if (first == std::string::npos || line[first] == '%') {
+                        continue;
+                    }
+
+                    std::istringstream size_line(line);
+
+                    if (!(size_line >> info.rows >> info.cols >> info.entries)) {
+                        throw std::runtime_error(
+                            "MatrixMarketFormat::decode_header(): Malformed size line"
+                        );
+                    }
+
+                    if (info.symmetry != "general" && info.rows != info.cols) {
+                        throw std::runtime_error(
+                            "MatrixMarketFormat::decode_header(): Symmetric matrix must be square"
+                        );
+                    }
+
+                    info.data_offset = offset;
+
+                    return info;
+                }
+
+                throw std::runtime_error(
+                    "MatrixMarketFormat::decode_header(): Missing size line"
+                );
+            }
+
+            inline std::string MatrixMarketFormat::encode_header(
+                const MarketInfo& info
+            ) {
+                return std::string(BANNER) + " matrix coordinate " + \
+                    info.field + " " + info.symmetry + "\n" + \
+                    std::to_string(info.rows) + " " + \
+                    std::to_string(info.cols) + " " + \
+                    std::to_string(info.entries) + "\n";
+            }
+
+            // Entry methods
+
+            template <typename T>
+            size_t MatrixMarketFormat::parse_entries(
+                const char* begin,
+                const char* end,
+                const MarketInfo& info,
+                std::vector<size_t>& row_indices,
+                std::vector<size_t>& col_indices,
+                std::vector<T>& values
+            ) {
+                bool pattern = info.field == "pattern";
+                bool integer = info.field == "integer";
+                bool symmetric = info.symmetry != "general";
+                bool skew = info.symmetry == "skew-symmetric";
+
+                size_t count = 0;
+
+                const char* line = begin;
+
+                while (line < end) {
+                    const char* line_end = line;
+
+                    while (line_end < end && *line_end != '\n') {
+                        line_end++;
+                    }
+
+                    const char* p = line;
+
+                    while (p < line_end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+                        p++;
+                    }
+
+                    if (p == line_end || *p == '%') {
+                        line = line_end + 1;
+
+                        continue;
+                    }
+
+                    // strto* may skip past the newline on a short line,
+                    // so every field is checked against the line end
+
+                    char* next = nullptr;
+
+                    unsigned long long row = std::strtoull(p, &next, 10);
+                    bool ok = next != p && next <= line_end;
+
+                    p = next;
+
+                    unsigned long long col = std::strtoull(p, &next, 10);
+                    ok = ok && next != p && next <= line_end;
+
+                    p = next;
+
+                    T value = T(1);
+
+                    if (ok && !pattern) {
+                        if (integer) {
+                            value = static_cast<T>(std::strtoll(p, &next, 10));
+                        } else {
+                            value = static_cast<T>(std::strtod(p, &next));
+                        }
+
+                        ok = next != p && next <= line_end;
+                    }
+
+                    if (!ok) {
+                        throw std::runtime_error(
+                            "MatrixMarketFormat::parse_entries(): Malformed entry: " + \
+                            std::string(line, line_end)
+                        );
+                    }
+
+                    if (row == 0 || col == 0 || row > info.rows || col > info.cols) {
+                        throw std::out_of_range(
+                            "MatrixMarketFormat::parse_entries(): Entry index out of range: " + \
+                            std::string(line, line_end)
+                        );
+                    }
+
+                    row_indices.push_back(static_cast<size_t>(row - 1));
+                    col_indices.push_back(static_cast<size_t>(col - 1));
+                    values.push_back(value);
+
+                    if (symmetric && row != col) {
+                        row_indices.push_back(static_cast<size_t>(col - 1));
+                        col_indices.push_back(static_cast<size_t>(row - 1));
+                        values.push_back(skew ? static_cast<T>(-value) : value);
+                    }
+
+                    count++;
+
+                    line = line_end + 1;
+                }
+
+                return count;
+            }
+
+            template <typename T>
+            std::string MatrixMarketFormat::encode_entries(
+                const core::SparseMatrix<T>& matrix,
+                size_t row_offset
+            ) {
+                std::ostringstream oss;
+
+                oss.precision(std::numeric_limits<T>::max_digits10);
+
+                const auto& row_ptr = matrix.row_ptr();
+                const auto& col_indices = matrix.col_indices();
+                const auto& values = matrix.values();
+
+                for (size_t i = 0; i < matrix.rows(); i++) {
+                    for (size_t k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+                        oss << (row_offset + i + 1) << ' ' \
+                            << (col_indices[k] + 1) << ' ' \
+                            << values[k] << '\n';
+                    }
+                }
+
+                return oss.str();
+            }
+
+            template <typename T>
+            std::string MatrixMarketFormat::field_name() {
+                VMAFU_IF_CONSTEXPR (VMAFU_IS_INTEGRAL_V(T)) {
+                    return "integer";
+                } else {
+                    return "real";
+                }
+            }
+
+            // Static method
+
+            inline FormatPtr MatrixMarketFormat::create() {
+                return std::make_shared<MatrixMarketFormat>();
+            }
+        }
+    }
+}
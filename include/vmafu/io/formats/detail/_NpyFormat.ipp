@@ -0,0 +1,383 @@
+// io/formats/detail/_NpyFormat.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace formats {
+            // Helper methods
+
+            inline std::string NpyFormat::dict_value(
+                const std::string& header,
+                const std::string& key
+            ) {
+                size_t key_pos = header.find("'" + key + "'");
+                if (key_pos == std::string::npos) {
+                    key_pos = header.find("\"" + key + "\"");
+                }
+
+                if (key_pos == std::string::npos) {
+                    throw std::runtime_error(
+                        "NpyFormat::dict_value(): Missing header key: " + key
+                    );
+                }
+
+                size_t pos = header.find(':', key_pos + key.size() + 2);
+                if (pos == std::string::npos) {
+                    throw std::runtime_error(
+                        "NpyFormat::dict_value(): Malformed header near key: " + key
+                    );
+                }
+
+                pos = header.find_first_not_of(" \t", pos + 1);
+                if (pos == std::string::npos) {
+                    throw std::runtime_error(
+                        "NpyFormat::dict_value(): Malformed header near key: " + key
+                    );
+                }
+
+                char first = header[pos];
+                size_t end;
+
+                if (first == '\'' || first == '"') {
+                    end = header.find(first, pos + 1);
+
+                    if (end == std::string::npos) {
+                        throw std::runtime_error(
+                            "NpyFormat::dict_value(): Unterminated string for key: " + key
+                        );
+                    }
+
+                    return header.substr(pos + 1, end - pos - 1);
+                }
+
+                if (first == '(') {
+                    end = header.find(')', pos);
+
+                    if (end == std::string::npos) {
+                        throw std::runtime_error(
+                            "NpyFormat::dict_value(): Unterminated tuple for key: " + key
+                        );
+                    }
+
+                    return header.substr(pos, end - pos + 1);
+                }
+
+                end = header.find_first_of(",}", pos);
+
+                std::string value = header.substr(pos, end - pos);
+                value.erase(value.find_last_not_of(" \t") + 1);
+
+                return value;
+            }
+
+            inline void NpyFormat::parse_descr(
+                const std::string& descr,
+                ArrayInfo& info
+            ) {
+                if (descr.size() < 2) {
+                    throw std::runtime_error(
+                        "NpyFormat::parse_descr(): Unsupported dtype: " + descr
+                    );
+                }
+
+                size_t pos = 0;
+                char order = '=';
+
+                if (descr[0] == '<' || descr[0] == '>' || descr[0] == '=' || descr[0] == '|') {
+                    order = descr[0];
+                    pos = 1;
+                }
+
+                char kind = descr[pos];
+                std::string width = descr.substr(pos + 1);
+
+                info.big_endian = order == '>' || (
+                    order != '<' && is_big_endian_host()
+                );
+
+                if (kind == 'f' && width == "4") {
+                    info.dtype = DataType::FLOAT32;
+                } else if (kind == 'f' && width == "8") {
+                    info.dtype = DataType::FLOAT64;
+                } else if (kind == 'i' && width == "4") {
+                    info.dtype = DataType::INT32;
+                } else if (kind == 'i' && width == "8") {
+                    info.dtype = DataType::INT64;
+                } else {
+                    throw std::runtime_error(
+                        "NpyFormat::parse_descr(): Unsupported dtype: " + descr
+                    );
+                }
+            }
+
+            inline void NpyFormat::parse_shape(
+                const std::string& shape,
+                ArrayInfo& info
+            ) {
+                std::vector<size_t> dims;
+
+                std::string token;
+                std::istringstream iss(shape.substr(1, shape.size() - 2));
+
+                while (std::getline(iss, token, ',')) {
+                    size_t start = token.find_first_not_of(" \tL");
+                    if (start == std::string::npos) {
+                        continue;
+                    }
+
+                    dims.push_back(static_cast<size_t>(std::stoull(token.substr(start))));
+                }
+
+                info.ndim = dims.size();
+
+                if (dims.empty()) {
+                    info.rows = 1;
+                    info.cols = 1;
+                } else if (dims.size() == 1) {
+                    info.rows = 1;
+                    info.cols = dims[0];
+                } else if (dims.size() == 2) {
+                    info.rows = dims[0];
+                    info.cols = dims[1];
+                } else {
+                    throw std::runtime_error(
+                        "NpyFormat::parse_shape(): Arrays with more than two dimensions are not supported"
+                    );
+                }
+            }
+
+            // Array methods
+
+            inline ArrayInfo NpyFormat::read_info(
+                const std::string& filename
+            ) const {
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "NpyFormat::read_info(): Cannot open file: " + filename
+                    );
+                }
+
+                return decode_header(file);
+            }
+
+            inline void NpyFormat::read_data(
+                const std::string& filename,
+                const ArrayInfo& info,
+                size_t first,
+                size_t count,
+                void* buffer
+            ) const {
+                if (first + count > info.size()) {
+                    throw std::out_of_range(
+                        "NpyFormat::read_data(): Element range out of bounds"
+                    );
+                }
+
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "NpyFormat::read_data(): Cannot open file: " + filename
+                    );
+                }
+
+                size_t element_size = data_type_size(info.dtype);
+
+                file.seekg(
+                    static_cast<std::streamoff>(
+                        info.data_offset + first * element_size
+                    )
+                );
+                file.read(
+                    static_cast<char*>(buffer),
+                    static_cast<std::streamsize>(count * element_size)
+                );
+
+                if (!file) {
+                    throw std::runtime_error(
+                        "NpyFormat::read_data(): Unexpected end of file: " + filename
+                    );
+                }
+            }
+
+            inline void NpyFormat::write_array(
+                const std::string& filename,
+                const ArrayInfo& info,
+                const void* data
+            ) const {
+                std::ofstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "NpyFormat::write_array(): Cannot open file: " + filename
+                    );
+                }
+
+                std::string header = encode_header(info);
+
+                file.write(header.data(), static_cast<std::streamsize>(header.size()));
+                file.write(
+                    static_cast<const char*>(data),
+                    static_cast<std::streamsize>(
+                        info.size() * data_type_size(info.dtype)
+                    )
+                );
+
+                if (!file) {
+                    throw std::runtime_error(
+                        "NpyFormat::write_array(): Failed to write file: " + filename
+                    );
+                }
+            }
+
+            // Validation method
+
+            inline bool NpyFormat::validate(
+                const std::string& content
+            ) const {
+                try {
+                    std::istringstream iss(content);
+
+                    ArrayInfo info = decode_header(iss);
+
+                    return content.size() >= info.data_offset + \
+                        info.size() * data_type_size(info.dtype);
+                } catch (...) {
+                    return false;
+                }
+            }
+
+            // Static methods
+
+            inline std::string NpyFormat::encode_header(
+                const ArrayInfo& info
+            ) {
+                std::string descr;
+
+                descr += info.big_endian ? '>' : '<';
+
+                switch (info.dtype) {
+                    case DataType::INT32: {
+                        descr += "i4";
+                        break;
+                    }
+                    case DataType::INT64: {
+                        descr += "i8";
+                        break;
+                    }
+                    case DataType::FLOAT32: {
+                        descr += "f4";
+                        break;
+                    }
+                    case DataType::FLOAT64: {
+                        descr += "f8";
+                        break;
+                    }
+                    default: {
+                        throw std::invalid_argument(
+                            "NpyFormat::encode_header(): Unknown data type"
+                        );
+                    }
+                }
+
+                std::string shape;
+
+                if (info.ndim == 0) {
+                    shape = "()";
+                } else if (info.ndim == 1) {
+                    shape = "(" + std::to_string(info.size()) + ",)";
+                } else {
+                    shape = "(" + std::to_string(info.rows) + ", " + \
+                        std::to_string(info.cols) + ")";
+                }
+
+                std::string dict = "{'descr': '" + descr + "', 'fortran_order': " + \
+                    (info.fortran_order ? "True" : "False") + \
+                    ", 'shape': " + shape + ", }";
+
+                size_t prefix = 10;
+                size_t total = prefix + dict.size() + 1;
+
+                if (total + ALIGNMENT > 65535 + prefix) {
+                    prefix = 12;
+                    total = prefix + dict.size() + 1;
+                }
+
+                dict.append((ALIGNMENT - total % ALIGNMENT) % ALIGNMENT, ' ');
+                dict += '\n';
+
+                std::string header(MAGIC, 6);
+
+                header += static_cast<char>(prefix == 10 ? 1 : 2);
+                header += static_cast<char>(0);
+
+                size_t length = dict.size();
+
+                for (size_t b = 0; b < prefix - 8; b++) {
+                    header += static_cast<char>((length >> (8 * b)) & 0xFF);
+                }
+
+                return header + dict;
+            }
+
+            inline ArrayInfo NpyFormat::decode_header(std::istream& stream) {
+                char magic[6];
+                unsigned char version[2];
+
+                stream.read(magic, 6);
+                stream.read(reinterpret_cast<char*>(version), 2);
+
+                if (!stream || std::memcmp(magic, MAGIC, 6) != 0) {
+                    throw std::runtime_error(
+                        "NpyFormat::decode_header(): Not a NumPy .npy file"
+                    );
+                }
+
+                size_t length_bytes;
+
+                if (version[0] == 1) {
+                    length_bytes = 2;
+                } else if (version[0] == 2 || version[0] == 3) {
+                    length_bytes = 4;
+                } else {
+                    throw std::runtime_error(
+                        "NpyFormat::decode_header(): Unsupported version " + \
+                        std::to_string(version[0]) + "." + std::to_string(version[1])
+                    );
+                }
+
+                unsigned char length_field[4] = {0, 0, 0, 0};
+                stream.read(reinterpret_cast<char*>(length_field), length_bytes);
+
+                size_t length = 0;
+                for (size_t b = 0; b < length_bytes; b++) {
+                    length |= static_cast<size_t>(length_field[b]) << (8 * b);
+                }
+
+                std::string header(length, '\0');
+                stream.read(&header[0], static_cast<std::streamsize>(length));
+
+                if (!stream) {
+                    throw std::runtime_error(
+                        "NpyFormat::decode_header(): Truncated header"
+                    );
+                }
+
+                ArrayInfo info;
+
+                parse_descr(dict_value(header, "descr"), info);
+                parse_shape(dict_value(header, "shape"), info);
+
+                info.fortran_order = info.ndim == 2 && \
+                    dict_value(header, "fortran_order") == "True";
+                info.data_offset = 8 + length_bytes + length;
+                info.contiguous = true;
+
+                return info;
+            }
+
+            inline FormatPtr NpyFormat::create() {
+                return std::make_shared<NpyFormat>();
+            }
+        }
+    }
+}
@@ -23,16 +23,13 @@ namespace vmafu {
             std::string TxtFormat::read(
                 const std::string& filename
             ) const {
-                std::ifstream file(filename);
-                if (!file.is_open()) {
-                    throw std::runtime_error(
-                        "TxtFormat::read(): Cannot open file: " + filename
-                    );
-                }
+                std::string result;
 
-                std::string result = read_stream(file);
+                read_view(filename, result);
 
-                file.close();
+                if (!result.empty() && result.back() == '\n') {
+                    result.pop_back();
+                }
 
                 return result;
             }
@@ -7,3 +7,10 @@
 #include "_IFormat.hpp"
 #include "_TxtFormat.hpp"
 #include "_CsvFormat.hpp"
+#include "_MatrixMarketFormat.hpp"
+#include "_IBinaryFormat.hpp"
+#include "_BinaryFormat.hpp"
+#include "_NpyFormat.hpp"
+#include "_ChunkedFormat.hpp"
+#include "_MappedFile.hpp"
+#include "_MappedArray.hpp"
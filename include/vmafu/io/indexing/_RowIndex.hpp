@@ -0,0 +1,82 @@
+// io/indexing/_RowIndex.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
+
+
+namespace vmafu {
+    namespace io {
+        namespace indexing {
+            // Sidecar index of a text matrix file: byte offsets of every
+            // stride-th row, plus every stride-th field of a single-row file
+
+            class RowIndex {
+                private:
+                    size_t _rows;
+                    size_t _cols;
+                    size_t _stride;
+                    size_t _file_size;
+
+                    std::vector<std::uint64_t> _row_offsets;
+                    std::vector<std::uint64_t> _field_offsets;
+
+                public:
+                    // Constructor
+
+                    RowIndex();
+
+                    // Getters
+
+                    size_t rows() const noexcept;
+                    size_t cols() const noexcept;
+                    size_t stride() const noexcept;
+                    size_t file_size() const noexcept;
+
+                    const std::vector<std::uint64_t>& row_offsets() const noexcept;
+                    const std::vector<std::uint64_t>& field_offsets() const noexcept;
+
+                    // Lookup methods
+
+                    std::pair<std::uint64_t, size_t> seek_row(size_t row) const;
+                    std::pair<std::uint64_t, size_t> seek_field(size_t field) const;
+
+                    // Persistence methods
+
+                    void save(const std::string& index_filename) const;
+
+                    // Static methods
+
+                    static std::string index_filename(const std::string& filename);
+
+                    static size_t file_size(const std::string& filename);
+
+                    static RowIndex build(
+                        const std::string& filename,
+                        char delimiter = '\0',
+                        size_t stride = 1024
+                    );
+
+                    static RowIndex load(const std::string& filename);
+
+                    // Checks the sidecar header only; load() may still
+                    // reject a malformed body
+
+                    static bool exists(const std::string& filename);
+            };
+        }
+
+        using indexing::RowIndex;
+    }
+}
+
+
+#include "detail/_RowIndex.ipp"
@@ -0,0 +1,308 @@
+// io/indexing/detail/_RowIndex.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace indexing {
+            // Constructor
+
+            inline RowIndex::RowIndex()
+                : _rows(0), _cols(0), _stride(1), _file_size(0) {}
+
+            // Getters
+
+            inline size_t RowIndex::rows() const noexcept {
+                return _rows;
+            }
+
+            inline size_t RowIndex::cols() const noexcept {
+                return _cols;
+            }
+
+            inline size_t RowIndex::stride() const noexcept {
+                return _stride;
+            }
+
+            inline size_t RowIndex::file_size() const noexcept {
+                return _file_size;
+            }
+
+            inline const std::vector<std::uint64_t>& RowIndex::row_offsets() const noexcept {
+                return _row_offsets;
+            }
+
+            inline const std::vector<std::uint64_t>& RowIndex::field_offsets() const noexcept {
+                return _field_offsets;
+            }
+
+            // Lookup methods
+
+            inline std::pair<std::uint64_t, size_t> RowIndex::seek_row(
+                size_t row
+            ) const {
+                if (row >= _rows) {
+                    throw std::out_of_range(
+                        "RowIndex::seek_row(): Row index out of range"
+                    );
+                }
+
+                return {_row_offsets[row / _stride], row % _stride};
+            }
+
+            inline std::pair<std::uint64_t, size_t> RowIndex::seek_field(
+                size_t field
+            ) const {
+                if (_field_offsets.empty()) {
+                    throw std::runtime_error(
+                        "RowIndex::seek_field(): Index has no field offsets"
+                    );
+                }
+
+                if (field >= _cols) {
+                    throw std::out_of_range(
+                        "RowIndex::seek_field(): Field index out of range"
+                    );
+                }
+
+                return {_field_offsets[field / _stride], field % _stride};
+            }
+
+            // Persistence methods
+
+            inline void RowIndex::save(const std::string& index_filename) const {
+                std::ofstream file(index_filename);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "RowIndex::save(): Cannot open file: " + index_filename
+                    );
+                }
+
+                file << "vmafu-index 1\n" \
+                     << "size " << _file_size << "\n" \
+                     << "rows " << _rows << "\n" \
+                     << "cols " << _cols << "\n" \
+                     << "stride " << _stride << "\n" \
+                     << "row_offsets " << _row_offsets.size() << "\n";
+
+                for (auto offset : _row_offsets) {
+                    file << offset << "\n";
+                }
+
+                file << "field_offsets " << _field_offsets.size() << "\n";
+
+                for (auto offset : _field_offsets) {
+                    file << offset << "\n";
+                }
+
+                if (!file) {
+                    throw std::runtime_error(
+                        "RowIndex::save(): Failed to write file: " + index_filename
+                    );
+                }
+            }
+
+            // Static methods
+
+            inline std::string RowIndex::index_filename(
+                const std::string& filename
+            ) {
+                return filename + ".idx";
+            }
+
+            inline size_t RowIndex::file_size(const std::string& filename) {
+                std::ifstream file(filename, std::ios::binary | std::ios::ate);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "RowIndex::file_size(): Cannot open file: " + filename
+                    );
+                }
+
+                return static_cast<size_t>(file.tellg());
+            }
+
+            inline RowIndex RowIndex::build(
+                const std::string& filename,
+                char delimiter,
+                size_t stride
+            ) {
+                if (stride == 0) {
+                    throw std::invalid_argument(
+                        "RowIndex::build(): Stride must be positive"
+                    );
+                }
+
+                std::ifstream file(filename, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "RowIndex::build(): Cannot open file: " + filename
+                    );
+                }
+
+                RowIndex index;
+
+                index._stride = stride;
+
+                std::vector<char> buffer(1 << 20);
+
+                std::uint64_t position = 0;
+                std::uint64_t line_start = 0;
+
+                bool line_has_data = false;
+                bool in_first_row = false;
+
+                size_t first_row_fields = 0;
+
+                while (
+                    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) ||
+                    file.gcount() > 0
+                ) {
+                    size_t count = static_cast<size_t>(file.gcount());
+
+                    for (size_t i = 0; i < count; i++) {
+                        char c = buffer[i];
+                        std::uint64_t at = position + i;
+
+                        if (c == '\n') {
+                            if (line_has_data) {
+                                index._rows++;
+                            }
+
+                            line_start = at + 1;
+                            line_has_data = false;
+                            in_first_row = false;
+
+                            continue;
+                        }
+
+                        if (!line_has_data && !std::isspace(static_cast<unsigned char>(c))) {
+                            line_has_data = true;
+
+                            if (index._rows % stride == 0) {
+                                index._row_offsets.push_back(line_start);
+                            }
+
+                            if (index._rows == 0) {
+                                in_first_row = true;
+                                first_row_fields = 1;
+
+                                index._field_offsets.push_back(line_start);
+                            }
+                        }
+
+                        if (in_first_row && delimiter != '\0' && c == delimiter) {
+                            if (first_row_fields % stride == 0) {
+                                index._field_offsets.push_back(at + 1);
+                            }
+
+                            first_row_fields++;
+                        }
+                    }
+
+                    position += count;
+                }
+
+                if (line_has_data) {
+                    index._rows++;
+                }
+
+                if (index._rows > 0) {
+                    index._cols = delimiter != '\0' ? first_row_fields : 1;
+                }
+
+                if (index._rows != 1 || delimiter == '\0') {
+                    index._field_offsets.clear();
+                }
+
+                index._file_size = static_cast<size_t>(position);
+
+                return index;
+            }
+
+            inline RowIndex RowIndex::load(const std::string& filename) {
+                std::string index_file = index_filename(filename);
+
+                std::ifstream file(index_file);
+                if (!file.is_open()) {
+                    throw std::runtime_error(
+                        "RowIndex::load(): Cannot open file: " + index_file
+                    );
+                }
+
+                RowIndex index;
+
+                std::string key;
+                int version = 0;
+                size_t count = 0;
+
+                file >> key >> version;
+                if (key != "vmafu-index" || version != 1) {
+                    throw std::runtime_error(
+                        "RowIndex::load(): Not a vmafu index: " + index_file
+                    );
+                }
+
+                file >> key >> index._file_size \
+                     >> key >> index._rows \
+                     >> key >> index._cols \
+                     >> key >> index._stride \
+                     >> key >> count;
+
+                index._row_offsets.resize(count);
+                for (auto& offset : index._row_offsets) {
+                    file >> offset;
+                }
+
+                file >> key >> count;
+
+                index._field_offsets.resize(count);
+                for (auto& offset : index._field_offsets) {
+                    file >> offset;
+                }
+
+                if (!file || index._stride == 0) {
+                    throw std::runtime_error(
+                        "RowIndex::load(): Malformed index: " + index_file
+                    );
+                }
+
+                if (index._file_size != file_size(filename)) {
+                    throw std::runtime_error(
+                        "RowIndex::load(): Index is stale: " + index_file
+                    );
+                }
+
+                return index;
+            }
+
+            inline bool RowIndex::exists(const std::string& filename) {
+                // Header only: magic, version and the indexed file size,
+                // which is enough to reject missing or stale indexes
+
+                std::ifstream file(index_filename(filename));
+                if (!file.is_open()) {
+                    return false;
+                }
+
+                std::string key;
+                int version = 0;
+                size_t indexed_size = 0;
+
+                file >> key >> version;
+                if (!file || key != "vmafu-index" || version != 1) {
+                    return false;
+                }
+
+                file >> key >> indexed_size;
+                if (!file) {
+                    return false;
+                }
+
+                try {
+                    return indexed_size == file_size(filename);
+                } catch (...) {
+                    return false;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,7 @@
+// io/indexing/indexing.hpp
+
+
+#pragma once
+
+
+#include "_RowIndex.hpp"
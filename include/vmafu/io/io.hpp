@@ -20,3 +20,15 @@
 // Serializers
 
 #include "serializers/serializers.hpp"
+
+// Indexing
+
+#include "indexing/indexing.hpp"
+
+// Compression
+
+#include "compression/compression.hpp"
+
+// Loading
+
+#include "loading/loading.hpp"
@@ -0,0 +1,113 @@
+// io/loading/_PrefetchQueue.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <stdexcept>
+#include <memory>
+
+#include "../_io.hpp"
+
+
+namespace vmafu {
+    namespace io {
+        namespace loading {
+            // Loads a list of matrix files in order on background threads,
+            // keeping at most `depth` files and `max_bytes` of estimated
+            // matrix memory loaded ahead of the consumer
+
+            template <typename T>
+            class PrefetchQueue {
+                private:
+                    struct Slot {
+                        bool ready = false;
+
+                        size_t bytes = 0;
+
+                        Matrix<T> matrix;
+                        std::exception_ptr error;
+                    };
+
+                    std::vector<std::string> _filenames;
+                    std::vector<size_t> _estimates;
+                    std::vector<Slot> _slots;
+
+                    size_t _max_bytes;
+                    size_t _depth;
+
+                    size_t _next_claim = 0;
+                    size_t _next_out = 0;
+                    size_t _in_flight_bytes = 0;
+
+                    bool _stop = false;
+
+                    mutable std::mutex _mutex;
+                    std::condition_variable _ready;
+                    std::condition_variable _space;
+
+                    std::vector<std::thread> _workers;
+
+                    // Helper methods
+
+                    void worker();
+
+                    bool can_claim() const noexcept;
+
+                public:
+                    // Constants
+
+                    static constexpr size_t DEFAULT_MAX_BYTES = size_t(256) << 20;
+
+                    // Constructor / Destructor
+
+                    explicit PrefetchQueue(
+                        std::vector<std::string> filenames,
+                        size_t max_bytes = DEFAULT_MAX_BYTES,
+                        size_t depth = 2,
+                        size_t threads = 1
+                    );
+
+                    ~PrefetchQueue();
+
+                    // Getters
+
+                    size_t size() const noexcept;
+                    size_t position() const;
+
+                    size_t in_flight_bytes() const;
+
+                    bool has_next() const;
+
+                    // Consume method
+
+                    Matrix<T> next();
+
+                    // Copy / Move operators
+
+                    PrefetchQueue(const PrefetchQueue&) = delete;
+                    PrefetchQueue& operator=(const PrefetchQueue&) = delete;
+
+                    // Static method
+
+                    // Upper bound on the loaded size of a file ( 0 when
+                    // it cannot be read ), charged against max_bytes
+
+                    static size_t estimate_bytes(const std::string& filename);
+            };
+        }
+
+        using loading::PrefetchQueue;
+    }
+
+    using io::PrefetchQueue;
+}
+
+
+#include "detail/_PrefetchQueue.ipp"
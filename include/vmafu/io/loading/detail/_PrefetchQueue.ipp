@@ -0,0 +1,236 @@
+// io/loading/detail/_PrefetchQueue.ipp
+
+
+namespace vmafu {
+    namespace io {
+        namespace loading {
+            // Helper methods
+
+            template <typename T>
+            bool PrefetchQueue<T>::can_claim() const noexcept {
+                if (_next_claim >= _filenames.size()) {
+                    return false;
+                }
+
+                if (_next_claim >= _next_out + _depth) {
+                    return false;
+                }
+
+                // A file larger than the whole budget is still loaded once
+                // nothing else is held, so the queue cannot stall
+
+                return _next_claim == _next_out || \
+                    _in_flight_bytes + _estimates[_next_claim] <= _max_bytes;
+            }
+
+            template <typename T>
+            void PrefetchQueue<T>::worker() {
+                while (true) {
+                    size_t index;
+
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+
+                        _space.wait(lock, [this] {
+                            return _stop || \
+                                _next_claim >= _filenames.size() || \
+                                can_claim();
+                        });
+
+                        if (_stop || _next_claim >= _filenames.size()) {
+                            return;
+                        }
+
+                        index = _next_claim++;
+                        _in_flight_bytes += _estimates[index];
+                    }
+
+                    Slot slot;
+
+                    try {
+                        slot.matrix = load_matrix<T>(_filenames[index]);
+                    } catch (...) {
+                        slot.error = std::current_exception();
+                    }
+
+                    slot.bytes = slot.matrix.size() * sizeof(T);
+                    slot.ready = true;
+
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+
+                        _in_flight_bytes = _in_flight_bytes - _estimates[index] + slot.bytes;
+                        _slots[index] = std::move(slot);
+                    }
+
+                    _ready.notify_all();
+                    _space.notify_all();
+                }
+            }
+
+            // Constructor / Destructor
+
+            template <typename T>
+            PrefetchQueue<T>::PrefetchQueue(
+                std::vector<std::string> filenames,
+                size_t max_bytes,
+                size_t depth,
+                size_t threads
+            ) : _filenames(std::move(filenames)),
+                _max_bytes(max_bytes),
+                _depth(depth) {
+                if (depth == 0 || threads == 0) {
+                    throw std::invalid_argument(
+                        "PrefetchQueue::PrefetchQueue(): depth and threads must be positive"
+                    );
+                }
+
+                _estimates.reserve(_filenames.size());
+
+                for (const std::string& filename : _filenames) {
+                    _estimates.push_back(estimate_bytes(filename));
+                }
+
+                _slots.resize(_filenames.size());
+
+                threads = std::min(threads, std::max<size_t>(_filenames.size(), 1));
+
+                // The destructor does not run if a thread fails to start,
+                // so the ones already running are stopped here
+
+                try {
+                    for (size_t i = 0; i < threads; i++) {
+                        _workers.emplace_back(&PrefetchQueue::worker, this);
+                    }
+                } catch (...) {
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+
+                        _stop = true;
+                    }
+
+                    _space.notify_all();
+
+                    for (std::thread& thread : _workers) {
+                        thread.join();
+                    }
+
+                    throw;
+                }
+            }
+
+            template <typename T>
+            PrefetchQueue<T>::~PrefetchQueue() {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+
+                    _stop = true;
+                }
+
+                _space.notify_all();
+
+                for (std::thread& thread : _workers) {
+                    thread.join();
+                }
+            }
+
+            // Getters
+
+            template <typename T>
+            size_t PrefetchQueue<T>::size() const noexcept {
+                return _filenames.size();
+            }
+
+            template <typename T>
+            size_t PrefetchQueue<T>::position() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                return _next_out;
+            }
+
+            template <typename T>
+            size_t PrefetchQueue<T>::in_flight_bytes() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                return _in_flight_bytes;
+            }
+
+            template <typename T>
+            bool PrefetchQueue<T>::has_next() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                return _next_out < _filenames.size();
+            }
+
+            // Consume method
+
+            template <typename T>
+            Matrix<T> PrefetchQueue<T>::next() {
+                Slot slot;
+
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+
+                    if (_next_out >= _filenames.size()) {
+                        throw std::out_of_range(
+                            "PrefetchQueue::next(): No files left in the queue"
+                        );
+                    }
+
+                    _ready.wait(lock, [this] {
+                        return _slots[_next_out].ready;
+                    });
+
+                    slot = std::move(_slots[_next_out]);
+
+                    _in_flight_bytes -= slot.bytes;
+                    _next_out++;
+                }
+
+                _space.notify_all();
+
+                if (slot.error) {
+                    std::rethrow_exception(slot.error);
+                }
+
+                return std::move(slot.matrix);
+            }
+
+            // Static method
+
+            template <typename T>
+            size_t PrefetchQueue<T>::estimate_bytes(const std::string& filename) {
+                // Upper bound on the loaded matrix: exact from binary and
+                // Matrix Market headers or a row index, otherwise every
+                // text element takes at least two bytes ( digit and
+                // delimiter or newline )
+
+                try {
+                    FormatPtr format = create_format(filename);
+
+                    auto binary = std::dynamic_pointer_cast<formats::IBinaryFormat>(format);
+
+                    if (binary) {
+                        return binary->read_info(filename).size() * sizeof(T);
+                    }
+
+                    if (std::dynamic_pointer_cast<MatrixMarketFormat>(format)) {
+                        formats::MarketInfo info = MatrixMarketFormat::read_info(filename);
+
+                        return info.rows * info.cols * sizeof(T);
+                    }
+
+                    RowIndex index;
+
+                    if (internal::try_load_index(filename, index)) {
+                        return index.rows() * index.cols() * sizeof(T);
+                    }
+
+                    return (RowIndex::file_size(filename) / 2 + 1) * sizeof(T);
+                } catch (...) {
+                    return 0;
+                }
+            }
+        }
+    }
+}
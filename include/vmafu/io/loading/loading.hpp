@@ -0,0 +1,7 @@
+// io/loading/loading.hpp
+
+
+#pragma once
+
+
+#include "_PrefetchQueue.hpp"
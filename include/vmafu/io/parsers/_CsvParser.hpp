@@ -6,6 +6,7 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <sstream>
 
 #include "_IParser.hpp"
@@ -23,7 +24,7 @@ namespace vmafu {
                     // Helper methods
 
                     std::vector<std::string> split_line(
-                        const std::string& line
+                        std::string_view line
                     ) const;
 
                     std::string escape_field(
@@ -52,7 +53,7 @@ namespace vmafu {
                     // Parsing methods
 
                     std::vector<std::vector<std::string>> parse(
-                        const std::string& content
+                        std::string_view content
                     ) const override;
 
                     std::string unparse(
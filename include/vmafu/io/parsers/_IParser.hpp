@@ -5,6 +5,7 @@
 
 
 #include <string>
+#include <string_view>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -22,7 +23,7 @@ namespace vmafu {
                     // Parsing methodd
 
                     virtual std::vector<std::vector<std::string>> parse(
-                        const std::string& content
+                        std::string_view content
                     ) const = 0;
 
                     virtual std::string unparse(
@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <sstream>
 
 #include "_IParser.hpp"
@@ -19,7 +20,7 @@ namespace vmafu {
                 
                 // Helper methods
 
-                std::string process_line(const std::string& line) const;
+                std::string process_line(std::string_view line) const;
                 std::vector<std::string> split_by_whitespace(const std::string& line) const;
                 
             public:
@@ -40,7 +41,7 @@ namespace vmafu {
                 // Parsing methods
 
                 std::vector<std::vector<std::string>> parse(
-                    const std::string& content
+                    std::string_view content
                 ) const override;
 
                 std::string unparse(
@@ -7,7 +7,7 @@ namespace vmafu {
             // Helper methods
 
             std::vector<std::string> CsvParser::split_line(
-                const std::string& line
+                std::string_view line
             ) const {
                 std::vector<std::string> fields;
                 std::string current_field;
@@ -39,7 +39,8 @@ namespace vmafu {
 
                 if (in_quotes) {
                     throw std::runtime_error(
-                        "CsvParser::split_line(): Unclosed quotes in CSV line: " + line
+                        "CsvParser::split_line(): Unclosed quotes in CSV line: " + \
+                        std::string(line)
                     );
                 }
 
@@ -176,16 +177,24 @@ namespace vmafu {
             // Parsing methods
 
             std::vector<std::vector<std::string>> CsvParser::parse(
-                const std::string& content
+                std::string_view content
             ) const {
-                std::istringstream iss(content);
-                std::string line;
-
                 std::vector<std::vector<std::string>> result;
 
                 bool first_line = true;
 
-                while (std::getline(iss, line)) {
+                size_t pos = 0;
+
+                while (pos < content.size()) {
+                    size_t newline = content.find('\n', pos);
+                    if (newline == std::string_view::npos) {
+                        newline = content.size();
+                    }
+
+                    std::string_view line = content.substr(pos, newline - pos);
+
+                    pos = newline + 1;
+
                     if (first_line && _has_header) {
                         first_line = false;
                         continue;
@@ -6,9 +6,9 @@ namespace vmafu {
             // Helper methods
 
             std::string TxtParser::process_line(
-                const std::string& line
+                std::string_view line
             ) const {
-                std::string processed = line;
+                std::string processed(line);
 
                 if (_trim_lines) {
                     size_t start = 0;
@@ -78,15 +78,23 @@ namespace vmafu {
             // Parsing methods
 
             std::vector<std::vector<std::string>> TxtParser::parse(
-                const std::string& content
+                std::string_view content
             ) const {
-                std::istringstream iss(content);
-                std::string line;
-
                 std::vector<std::vector<std::string>> result;
 
-                while (std::getline(iss, line)) {
-                    std::string processed_line = process_line(line);
+                size_t pos = 0;
+
+                while (pos < content.size()) {
+                    size_t newline = content.find('\n', pos);
+                    if (newline == std::string_view::npos) {
+                        newline = content.size();
+                    }
+
+                    std::string processed_line = process_line(
+                        content.substr(pos, newline - pos)
+                    );
+
+                    pos = newline + 1;
 
                     if (_skip_empty_lines && processed_line.empty()) {
                         continue;
@@ -0,0 +1,102 @@
+// linalg/_blas.hpp
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../core/core.hpp"
+#include "../utils/_compat.hpp"
+
+
+namespace vmafu {
+    namespace linalg {
+        // In-place BLAS style kernels: results go to caller-owned outputs
+        // and nothing is allocated. Outputs must not overlap the inputs.
+
+        enum class Transpose {
+            NO_TRANS,
+            TRANS
+        };
+
+        // Level 1: y = alpha * x + y
+
+        template <typename A, typename B>
+        void axpy(
+            const typename core::VectorView<B>::value_type& alpha,
+            const core::VectorView<A>& x,
+            const core::VectorView<B>& y
+        );
+
+        template <typename T, typename AllocatorX, typename AllocatorY>
+        void axpy(
+            const typename Vector<T, AllocatorX>::value_type& alpha,
+            const Vector<T, AllocatorX>& x,
+            Vector<T, AllocatorY>& y
+        );
+
+        // Level 2: y = alpha * op(A) * x + beta * y
+
+        template <typename A, typename B, typename C>
+        void gemv(
+            const typename core::VectorView<C>::value_type& alpha,
+            const core::MatrixView<A>& matrix,
+            const core::VectorView<B>& x,
+            const typename core::VectorView<C>::value_type& beta,
+            const core::VectorView<C>& y,
+            Transpose trans = Transpose::NO_TRANS
+        );
+
+        template <
+            typename T,
+            typename AllocatorA,
+            typename AllocatorX,
+            typename AllocatorY
+        >
+        void gemv(
+            const typename Vector<T, AllocatorY>::value_type& alpha,
+            const Matrix<T, AllocatorA>& matrix,
+            const Vector<T, AllocatorX>& x,
+            const typename Vector<T, AllocatorY>::value_type& beta,
+            Vector<T, AllocatorY>& y,
+            Transpose trans = Transpose::NO_TRANS
+        );
+
+        // Level 3: C = alpha * op(A) * op(B) + beta * C, with op(X) = X or
+        // X^T read in place
+
+        template <typename A, typename B, typename C>
+        void gemm(
+            const typename core::MatrixView<C>::value_type& alpha,
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs,
+            const typename core::MatrixView<C>::value_type& beta,
+            const core::MatrixView<C>& result,
+            Transpose trans_lhs = Transpose::NO_TRANS,
+            Transpose trans_rhs = Transpose::NO_TRANS
+        );
+
+        template <
+            typename T,
+            typename AllocatorA,
+            typename AllocatorB,
+            typename AllocatorC
+        >
+        void gemm(
+            const typename Matrix<T, AllocatorC>::value_type& alpha,
+            const Matrix<T, AllocatorA>& lhs,
+            const Matrix<T, AllocatorB>& rhs,
+            const typename Matrix<T, AllocatorC>::value_type& beta,
+            Matrix<T, AllocatorC>& result,
+            Transpose trans_lhs = Transpose::NO_TRANS,
+            Transpose trans_rhs = Transpose::NO_TRANS
+        );
+    }
+}
+
+
+#include "detail/_blas.ipp"
@@ -0,0 +1,26 @@
+// linalg/_determinants.hpp
+
+
+#pragma once
+
+
+#include "../core/_Matrix.hpp"
+
+#include "_lu.hpp"
+
+
+namespace vmafu {
+    namespace linalg {
+        // Determinant methods ( product of the U diagonal, signed by the
+        // row exchanges; 0 for a singular matrix )
+
+        template <typename T>
+        T det(const LUDecomposition<T>& decomposition);
+
+        template <typename T, typename Allocator, typename Layout>
+        T det(const Matrix<T, Allocator, Layout>& matrix);
+    }
+}
+
+
+#include "detail/_determinants.ipp"
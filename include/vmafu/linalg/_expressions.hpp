@@ -0,0 +1,419 @@
+// linalg/_expressions.hpp
+
+
+#pragma once
+
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../core/core.hpp"
+#include "../utils/_compat.hpp"
+
+
+namespace vmafu {
+    namespace linalg {
+        // Elementwise Vector / Matrix operators build expression trees;
+        // assigning one to a Vector / Matrix evaluates the whole tree in a
+        // single loop without temporaries. Leaves reference lvalue operands
+        // and take ownership of rvalue ones, so an expression stored with
+        // `auto` stays valid as long as its lvalue operands do.
+
+        // Leaves ( Holder is `const Vector&` or an owned `Vector` )
+
+        template <typename Holder>
+        class VectorLeaf : public core::VectorExpression<VectorLeaf<Holder>> {
+            private:
+                Holder _vector;
+
+            public:
+                using value_type = typename std::decay_t<Holder>::value_type;
+
+                explicit VectorLeaf(Holder vector);
+
+                size_t size() const noexcept;
+
+                const value_type& operator[](size_t index) const noexcept;
+        };
+
+        template <typename Holder>
+        class MatrixLeaf : public core::MatrixExpression<MatrixLeaf<Holder>> {
+            private:
+                Holder _matrix;
+
+            public:
+                using value_type = typename std::decay_t<Holder>::value_type;
+                using layout_type = typename std::decay_t<Holder>::layout_type;
+
+                explicit MatrixLeaf(Holder matrix);
+
+                size_t rows() const noexcept;
+                size_t cols() const noexcept;
+                size_t size() const noexcept;
+
+                const value_type& operator[](size_t index) const noexcept;
+                const value_type& operator()(size_t row, size_t col) const noexcept;
+        };
+
+        // Nodes
+
+        template <typename Op, typename Lhs, typename Rhs>
+        class VectorBinary
+        : public core::VectorExpression<VectorBinary<Op, Lhs, Rhs>> {
+            private:
+                Lhs _lhs;
+                Rhs _rhs;
+                Op _op;
+
+            public:
+                using value_type = typename Lhs::value_type;
+
+                VectorBinary(Lhs lhs, Rhs rhs, Op op = Op());
+
+                size_t size() const noexcept;
+
+                value_type operator[](size_t index) const;
+        };
+
+        template <typename Op, typename Operand>
+        class VectorUnary
+        : public core::VectorExpression<VectorUnary<Op, Operand>> {
+            private:
+                Operand _operand;
+                Op _op;
+
+            public:
+                using value_type = typename Operand::value_type;
+
+                VectorUnary(Operand operand, Op op = Op());
+
+                size_t size() const noexcept;
+
+                value_type operator[](size_t index) const;
+        };
+
+        template <typename Op, typename Lhs, typename Rhs>
+        class MatrixBinary
+        : public core::MatrixExpression<MatrixBinary<Op, Lhs, Rhs>> {
+            static_assert(
+                VMAFU_IS_SAME_V(
+                    typename Lhs::layout_type, typename Rhs::layout_type
+                ),
+                "MatrixBinary: operands must share a storage layout"
+            );
+
+            private:
+                Lhs _lhs;
+                Rhs _rhs;
+                Op _op;
+
+            public:
+                using value_type = typename Lhs::value_type;
+                using layout_type = typename Lhs::layout_type;
+
+                MatrixBinary(Lhs lhs, Rhs rhs, Op op = Op());
+
+                size_t rows() const noexcept;
+                size_t cols() const noexcept;
+                size_t size() const noexcept;
+
+                value_type operator[](size_t index) const;
+                value_type operator()(size_t row, size_t col) const;
+        };
+
+        template <typename Op, typename Operand>
+        class MatrixUnary
+        : public core::MatrixExpression<MatrixUnary<Op, Operand>> {
+            private:
+                Operand _operand;
+                Op _op;
+
+            public:
+                using value_type = typename Operand::value_type;
+                using layout_type = typename Operand::layout_type;
+
+                MatrixUnary(Operand operand, Op op = Op());
+
+                size_t rows() const noexcept;
+                size_t cols() const noexcept;
+                size_t size() const noexcept;
+
+                value_type operator[](size_t index) const;
+                value_type operator()(size_t row, size_t col) const;
+        };
+
+        // Functors
+
+        struct Negate {
+            template <typename U>
+            U operator()(const U& value) const;
+        };
+
+        template <typename Op, typename T>
+        struct BindLeft {
+            T scalar;
+
+            template <typename U>
+            U operator()(const U& value) const;
+        };
+
+        template <typename Op, typename T>
+        struct BindRight {
+            T scalar;
+
+            template <typename U>
+            U operator()(const U& value) const;
+        };
+
+        // Operand conversion
+
+        template <typename T, typename Allocator>
+        VectorLeaf<const Vector<T, Allocator>&> as_operand(
+            const Vector<T, Allocator>& vector
+        );
+
+        template <typename T, typename Allocator>
+        VectorLeaf<Vector<T, Allocator>> as_operand(
+            Vector<T, Allocator>&& vector
+        );
+
+        template <typename T, typename Allocator, typename Layout>
+        MatrixLeaf<const Matrix<T, Allocator, Layout>&> as_operand(
+            const Matrix<T, Allocator, Layout>& matrix
+        );
+
+        template <typename T, typename Allocator, typename Layout>
+        MatrixLeaf<Matrix<T, Allocator, Layout>> as_operand(
+            Matrix<T, Allocator, Layout>&& matrix
+        );
+
+        template <typename Expression>
+        const Expression& as_operand(
+            const core::VectorExpression<Expression>& expression
+        );
+
+        template <typename Expression>
+        const Expression& as_operand(
+            const core::MatrixExpression<Expression>& expression
+        );
+
+        // Nested temporaries are moved into the parent node, so owned leaf
+        // buffers are not copied as the tree grows
+
+        template <typename Expression>
+        Expression&& as_operand(
+            core::VectorExpression<Expression>&& expression
+        );
+
+        template <typename Expression>
+        Expression&& as_operand(
+            core::MatrixExpression<Expression>&& expression
+        );
+
+        // Traits
+
+        template <typename T>
+        struct is_vector : std::false_type {};
+
+        template <typename T, typename Allocator>
+        struct is_vector<Vector<T, Allocator>> : std::true_type {};
+
+        template <typename T>
+        struct is_matrix : std::false_type {};
+
+        template <typename T, typename Allocator, typename Layout>
+        struct is_matrix<Matrix<T, Allocator, Layout>> : std::true_type {};
+
+        template <typename T>
+        struct is_vector_operand : std::integral_constant<
+            bool,
+            is_vector<std::decay_t<T>>::value || \
+            core::is_vector_expression<T>::value
+        > {};
+
+        template <typename T>
+        struct is_matrix_operand : std::integral_constant<
+            bool,
+            is_matrix<std::decay_t<T>>::value || \
+            core::is_matrix_expression<T>::value
+        > {};
+
+        template <typename T>
+        struct is_operand : std::integral_constant<
+            bool,
+            is_vector_operand<T>::value || is_matrix_operand<T>::value
+        > {};
+
+        // Node type of an operand passed as X ( e.g. `const Vector&` )
+
+        template <typename X>
+        using operand_t = std::decay_t<decltype(as_operand(std::declval<X>()))>;
+
+        template <typename X, typename = void>
+        struct operand_value {};
+
+        template <typename X>
+        struct operand_value<X, VMAFU_ENABLE_IF_T(is_operand<X>::value)> {
+            using type = typename operand_t<X>::value_type;
+        };
+
+        template <typename X>
+        using operand_value_t = typename operand_value<X>::type;
+
+        // S is usable as the scalar of an operand X
+
+        template <typename S, typename X, typename = void>
+        struct is_scalar_operand : std::false_type {};
+
+        template <typename S, typename X>
+        struct is_scalar_operand<S, X, VMAFU_ENABLE_IF_T(is_operand<X>::value)>
+        : std::integral_constant<
+            bool,
+            !is_operand<S>::value && \
+            std::is_convertible<S, operand_value_t<X>>::value
+        > {};
+
+        template <typename L, typename R>
+        struct is_elementwise_pair : std::integral_constant<
+            bool,
+            (is_vector_operand<L>::value && is_vector_operand<R>::value) || \
+            (is_matrix_operand<L>::value && is_matrix_operand<R>::value)
+        > {};
+
+        // Node builders
+
+        template <typename Op, typename L, typename R>
+        using binary_t = std::conditional_t<
+            is_vector_operand<L>::value,
+            VectorBinary<Op, operand_t<L>, operand_t<R>>,
+            MatrixBinary<Op, operand_t<L>, operand_t<R>>
+        >;
+
+        template <typename Op, typename X>
+        using unary_t = std::conditional_t<
+            is_vector_operand<X>::value,
+            VectorUnary<Op, operand_t<X>>,
+            MatrixUnary<Op, operand_t<X>>
+        >;
+
+        template <typename Op, typename X>
+        using left_t = unary_t<BindLeft<Op, operand_value_t<X>>, X>;
+
+        template <typename Op, typename X>
+        using right_t = unary_t<BindRight<Op, operand_value_t<X>>, X>;
+
+        // Evaluation ( Vector / Matrix operands are passed through )
+
+        template <typename T, typename Allocator>
+        const Vector<T, Allocator>& eval(const Vector<T, Allocator>& vector);
+
+        template <typename T, typename Allocator, typename Layout>
+        const Matrix<T, Allocator, Layout>& eval(
+            const Matrix<T, Allocator, Layout>& matrix
+        );
+
+        template <typename Expression>
+        Vector<typename Expression::value_type> eval(
+            const core::VectorExpression<Expression>& expression
+        );
+
+        template <typename Expression>
+        Matrix<
+            typename Expression::value_type,
+            core::AlignedAllocator<typename Expression::value_type>,
+            typename Expression::layout_type
+        > eval(const core::MatrixExpression<Expression>& expression);
+
+        // Elementwise operations
+
+        // lhs + rhs
+
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_elementwise_pair<L, R>::value))* = nullptr
+        >
+        binary_t<std::plus<>, L, R> operator+(L&& lhs, R&& rhs);
+
+        // lhs - rhs
+
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_elementwise_pair<L, R>::value))* = nullptr
+        >
+        binary_t<std::minus<>, L, R> operator-(L&& lhs, R&& rhs);
+
+        // Unary minus
+
+        template <
+            typename X,
+            VMAFU_ENABLE_IF_T(is_operand<X>::value)* = nullptr
+        >
+        unary_t<Negate, X> operator-(X&& operand);
+
+        // operand * scalar, scalar * operand
+
+        template <
+            typename X,
+            typename S,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))* = nullptr
+        >
+        right_t<std::multiplies<>, X> operator*(X&& operand, const S& scalar);
+
+        template <
+            typename S,
+            typename X,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))* = nullptr
+        >
+        left_t<std::multiplies<>, X> operator*(const S& scalar, X&& operand);
+
+        // operand / scalar
+
+        template <
+            typename X,
+            typename S,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))* = nullptr
+        >
+        right_t<std::divides<>, X> operator/(X&& operand, const S& scalar);
+
+        // operand + scalar, scalar + operand
+
+        template <
+            typename X,
+            typename S,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))* = nullptr
+        >
+        right_t<std::plus<>, X> operator+(X&& operand, const S& scalar);
+
+        template <
+            typename S,
+            typename X,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))* = nullptr
+        >
+        left_t<std::plus<>, X> operator+(const S& scalar, X&& operand);
+
+        // operand - scalar, scalar - operand
+
+        template <
+            typename X,
+            typename S,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))* = nullptr
+        >
+        right_t<std::minus<>, X> operator-(X&& operand, const S& scalar);
+
+        template <
+            typename S,
+            typename X,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))* = nullptr
+        >
+        left_t<std::minus<>, X> operator-(const S& scalar, X&& operand);
+    }
+}
+
+
+#include "detail/_expressions.ipp"
@@ -0,0 +1,151 @@
+// linalg/_fixed.hpp
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../core/core.hpp"
+#include "../utils/_compat.hpp"
+#include "../utils/_unroll.hpp"
+
+
+namespace vmafu {
+    namespace linalg {
+        // FixedVector operations
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator+(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept;
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator-(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept;
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator-(const FixedVector<T, N>& vector) noexcept;
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator*(
+            const FixedVector<T, N>& vector,
+            const typename FixedVector<T, N>::value_type& scalar
+        ) noexcept;
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator*(
+            const typename FixedVector<T, N>::value_type& scalar,
+            const FixedVector<T, N>& vector
+        ) noexcept;
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator/(
+            const FixedVector<T, N>& vector,
+            const typename FixedVector<T, N>::value_type& scalar
+        );
+
+        template <typename T, size_t N>
+        constexpr T dot(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept;
+
+        template <typename T>
+        constexpr FixedVector<T, 3> cross(
+            const FixedVector<T, 3>& lhs,
+            const FixedVector<T, 3>& rhs
+        ) noexcept;
+
+        // FixedMatrix operations
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator+(
+            const FixedMatrix<T, R, C>& lhs,
+            const FixedMatrix<T, R, C>& rhs
+        ) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator-(
+            const FixedMatrix<T, R, C>& lhs,
+            const FixedMatrix<T, R, C>& rhs
+        ) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator-(const FixedMatrix<T, R, C>& matrix) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator*(
+            const FixedMatrix<T, R, C>& matrix,
+            const typename FixedMatrix<T, R, C>::value_type& scalar
+        ) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator*(
+            const typename FixedMatrix<T, R, C>::value_type& scalar,
+            const FixedMatrix<T, R, C>& matrix
+        ) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator/(
+            const FixedMatrix<T, R, C>& matrix,
+            const typename FixedMatrix<T, R, C>::value_type& scalar
+        );
+
+        // R x K times K x C ( i-k-j, the inner row update is unrolled )
+
+        template <typename T, size_t R, size_t K, size_t C>
+        constexpr FixedMatrix<T, R, C> operator*(
+            const FixedMatrix<T, R, K>& lhs,
+            const FixedMatrix<T, K, C>& rhs
+        ) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedVector<T, R> operator*(
+            const FixedMatrix<T, R, C>& matrix,
+            const FixedVector<T, C>& vector
+        ) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedVector<T, C> operator*(
+            const FixedVector<T, R>& vector,
+            const FixedMatrix<T, R, C>& matrix
+        ) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, C, R> transpose(const FixedMatrix<T, R, C>& matrix) noexcept;
+
+        // Comparison operations
+
+        template <typename T, size_t N>
+        constexpr bool operator==(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept;
+
+        template <typename T, size_t N>
+        constexpr bool operator!=(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr bool operator==(
+            const FixedMatrix<T, R, C>& lhs,
+            const FixedMatrix<T, R, C>& rhs
+        ) noexcept;
+
+        template <typename T, size_t R, size_t C>
+        constexpr bool operator!=(
+            const FixedMatrix<T, R, C>& lhs,
+            const FixedMatrix<T, R, C>& rhs
+        ) noexcept;
+    }
+}
+
+
+#include "detail/_fixed.ipp"
@@ -0,0 +1,100 @@
+// linalg/_linear_operator.hpp
+
+
+#pragma once
+
+
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../core/_Vector.hpp"
+#include "../core/_Matrix.hpp"
+#include "../core/_SparseMatrix.hpp"
+#include "../utils/_parallel_for.hpp"
+
+#include "_operations.hpp"
+#include "_sparse.hpp"
+
+
+namespace vmafu {
+    namespace linalg {
+        // Matrix-free operator: only y = A x ( and optionally y = A^T x )
+        // is known. The callables get y already sized. The adapters keep
+        // a reference to the wrapped matrix, which must outlive the
+        // operator; from_entries stores nothing but the entry generator
+
+        template <typename T>
+        class LinearOperator {
+            private:
+                size_t _rows;
+                size_t _cols;
+
+                std::function<void(const Vector<T>&, Vector<T>&)> _apply;
+                std::function<void(const Vector<T>&, Vector<T>&)> _apply_transpose;
+
+            public:
+                // Types
+
+                using value_type = T;
+
+                // Constructors
+
+                LinearOperator();
+
+                LinearOperator(
+                    size_t rows,
+                    size_t cols,
+                    std::function<void(const Vector<T>&, Vector<T>&)> apply,
+                    std::function<void(const Vector<T>&, Vector<T>&)> apply_transpose = nullptr
+                );
+
+                // Getters
+
+                size_t rows() const noexcept;
+                size_t cols() const noexcept;
+
+                bool has_transpose() const noexcept;
+
+                // Apply methods ( y is resized to the output size )
+
+                void apply(const Vector<T>& x, Vector<T>& y) const;
+                Vector<T> apply(const Vector<T>& x) const;
+
+                void apply_transpose(const Vector<T>& x, Vector<T>& y) const;
+                Vector<T> apply_transpose(const Vector<T>& x) const;
+
+                // Operator with apply and apply_transpose swapped
+
+                LinearOperator transpose() const;
+
+                // Static methods ( adapters; threads == 0 uses every
+                // hardware thread )
+
+                template <typename Allocator, typename Layout>
+                static LinearOperator from_matrix(
+                    const Matrix<T, Allocator, Layout>& matrix
+                );
+
+                static LinearOperator from_sparse(
+                    const SparseMatrix<T>& matrix,
+                    size_t threads = 0
+                );
+
+                // A(i, j) = entry(i, j) computed on every product: O(rows *
+                // cols) work, no storage. Rows are split across threads
+
+                template <typename Entry>
+                static LinearOperator from_entries(
+                    size_t rows,
+                    size_t cols,
+                    const Entry& entry,
+                    size_t threads = 0
+                );
+        };
+    }
+}
+
+
+#include "detail/_linear_operator.ipp"
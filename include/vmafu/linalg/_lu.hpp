@@ -0,0 +1,90 @@
+// linalg/_lu.hpp
+
+
+#pragma once
+
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "../core/_Vector.hpp"
+#include "../core/_Matrix.hpp"
+
+#include "_blas.hpp"
+
+
+namespace vmafu {
+    namespace linalg {
+        // P A = L U with L unit lower triangular and U upper triangular,
+        // packed together in factors. Step i exchanged rows i and
+        // pivots[i]. A zero pivot marks the matrix singular; the
+        // factorization still completes
+
+        template <typename T>
+        struct LUDecomposition {
+            Matrix<T> factors;
+
+            std::vector<size_t> pivots;
+
+            bool singular = false;
+
+            // Factor extraction methods
+
+            Matrix<T> lower() const;
+            Matrix<T> upper() const;
+
+            // det(P) = +-1
+
+            int permutation_sign() const noexcept;
+        };
+
+        // Right-looking blocked LU with partial pivoting: each panel of
+        // block_size columns is factored unblocked, then the trailing
+        // matrix gets one GEMM update
+
+        template <typename T, typename Allocator, typename Layout>
+        LUDecomposition<T> lu(
+            const Matrix<T, Allocator, Layout>& matrix,
+            size_t block_size = 64
+        );
+
+        // Solve methods ( A x = b through the factors )
+
+        template <typename T>
+        Vector<T> solve(
+            const LUDecomposition<T>& decomposition,
+            const Vector<T>& rhs
+        );
+
+        template <typename T>
+        Matrix<T> solve(
+            const LUDecomposition<T>& decomposition,
+            const Matrix<T>& rhs
+        );
+
+        template <typename T, typename Allocator, typename Layout>
+        Vector<T> solve(
+            const Matrix<T, Allocator, Layout>& matrix,
+            const Vector<T>& rhs
+        );
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T> solve(
+            const Matrix<T, Allocator, Layout>& matrix,
+            const Matrix<T>& rhs
+        );
+
+        // Inverse methods
+
+        template <typename T>
+        Matrix<T> inverse(const LUDecomposition<T>& decomposition);
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T> inverse(const Matrix<T, Allocator, Layout>& matrix);
+    }
+}
+
+
+#include "detail/_lu.ipp"
@@ -9,149 +9,141 @@
 
 #include "../core/_Vector.hpp"
 #include "../core/_Matrix.hpp"
+#include "../core/_Layout.hpp"
+#include "../core/_VectorView.hpp"
+#include "../core/_MatrixView.hpp"
 #include "../utils/_compat.hpp"
 
+#include "_expressions.hpp"
+#include "_blas.hpp"
+#include "_fixed.hpp"
+#include "_sparse.hpp"
+
 
 namespace vmafu {
     namespace linalg {
-        // Vector-Vector operations
-
-        // Vector addition
-
-        template <typename T>
-        Vector<T> operator+(const Vector<T>& lhs, const Vector<T>& rhs);
-
-        // Vector subtraction
-
-        template <typename T>
-        Vector<T> operator-(const Vector<T>& lhs, const Vector<T>& rhs);
-
-        // Unary minus
-        
-        template <typename T>
-        Vector<T> operator-(const Vector<T>& vector);
-
-        // Vector-Scalar operations
-
-        // Vector * scalar
-
-        template <typename T>
-        Vector<T> operator*(const Vector<T>& vector, T scalar);
-
-        // scalar * Vector
-
-        template <typename T>
-        Vector<T> operator*(T scalar, const Vector<T>& vector);
-
-        // Vector / scalar
-
-        template <typename T>
-        Vector<T> operator/(const Vector<T>& vector, T scalar);
-
-        // Vector + scalar
-
-        template <typename T>
-        Vector<T> operator+(const Vector<T>& vector, T scalar);
-
-        // scalar + Vector
-
-        template <typename T>
-        Vector<T> operator+(T scalar, const Vector<T>& vector);
-
-        // Vector - scalar
-
-        template <typename T>
-        Vector<T> operator-(const Vector<T>& vector, T scalar);
-
-        // scalar - Vector
-
-        template <typename T>
-        Vector<T> operator-(T scalar, const Vector<T>& vector);
-
-        //  Matrix-Matrix operations
-
-        // Matrix addition
-
-        template <typename T>
-        Matrix<T> operator+(const Matrix<T>& lhs, const Matrix<T>& rhs);
-
-        // Matrix subtraction
-
-        template <typename T>
-        Matrix<T> operator-(const Matrix<T>& lhs, const Matrix<T>& rhs);
-
-        // Unary minus (negation)
-
-        template <typename T>
-        Matrix<T> operator-(const Matrix<T>& m);
+        // Traits
+
+        template <typename L, typename R>
+        struct is_product_pair : std::integral_constant<
+            bool,
+            is_operand<L>::value && is_operand<R>::value && \
+            !(is_vector_operand<L>::value && is_vector_operand<R>::value) && \
+            (
+                core::is_vector_expression<L>::value || \
+                core::is_matrix_expression<L>::value || \
+                core::is_vector_expression<R>::value || \
+                core::is_matrix_expression<R>::value
+            )
+        > {};
 
         // Matrix multiplication
 
-        template <typename T>
-        Matrix<T> operator*(const Matrix<T>& lhs, const Matrix<T>& rhs);
-
-        //  Matrix-Scalar operations
-
-        // Matrix * scalar
-
-        template <typename T>
-        Matrix<T> operator*(const Matrix<T>& matrix, T scalar);
-
-        // scalar * Matrix
-
-        template <typename T>
-        Matrix<T> operator*(T scalar, const Matrix<T>& matrix);
-
-        // Matrix / scalar
-
-        template <typename T>
-        Matrix<T> operator/(const Matrix<T>& m, T scalar);
-
-        // Matrix + scalar
-
-        template <typename T>
-        Matrix<T> operator+(const Matrix<T>& matrix, T scalar);
-
-        // scalar + Matrix
-
-        template <typename T>
-        Matrix<T> operator+(T scalar, const Matrix<T>& matrix);
-
-        // Matrix - scalar
-
-        template <typename T>
-        Matrix<T> operator-(const Matrix<T>& matrix, T scalar);
-
-        // scalar - Matrix
-
-        template <typename T>
-        Matrix<T> operator-(T scalar, const Matrix<T>& matrix);
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout> operator*(
+            const Matrix<T, Allocator, Layout>& lhs,
+            const Matrix<T, Allocator, Layout>& rhs
+        );
 
         // Matrix-Vector operations
 
         // Matrix * Vector (matrix-vector multiplication)
 
-        template <typename T>
-        Vector<T> operator*(const Matrix<T>& matrix, const Vector<T>& vector);
+        template <typename T, typename Allocator, typename Layout>
+        Vector<T> operator*(
+            const Matrix<T, Allocator, Layout>& matrix,
+            const Vector<T>& vector
+        );
 
         // Vector * Matrix (vector-matrix multiplication, result is row vector)
 
-        template <typename T>
-        Vector<T> operator*(const Vector<T>& vector, const Matrix<T>& matrix);
+        template <typename T, typename Allocator, typename Layout>
+        Vector<T> operator*(
+            const Vector<T>& vector,
+            const Matrix<T, Allocator, Layout>& matrix
+        );
+
+        // Products with expression operands: the operands are evaluated
+        // once and the product runs through the kernels above
+
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_product_pair<L, R>::value))* = nullptr
+        >
+        auto operator*(const L& lhs, const R& rhs) -> decltype(eval(lhs) * eval(rhs));
+
+        // View operations ( results must not overlap the operands )
+
+        // lhs * rhs -> result
+
+        template <typename A, typename B, typename C>
+        void multiply(
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs,
+            const core::MatrixView<C>& result
+        );
+
+        // matrix * vector -> result
+
+        template <typename A, typename B, typename C>
+        void multiply(
+            const core::MatrixView<A>& matrix,
+            const core::VectorView<B>& vector,
+            const core::VectorView<C>& result
+        );
+
+        // View addition / subtraction
+
+        template <typename A, typename B>
+        Matrix<std::remove_const_t<A>> operator+(
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs
+        );
+
+        template <typename A, typename B>
+        Matrix<std::remove_const_t<A>> operator-(
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs
+        );
+
+        // View multiplication
+
+        template <typename A, typename B>
+        Matrix<std::remove_const_t<A>> operator*(
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs
+        );
+
+        template <typename A, typename B>
+        Vector<std::remove_const_t<A>> operator*(
+            const core::MatrixView<A>& matrix,
+            const core::VectorView<B>& vector
+        );
+
+        // Dot product
+
+        template <typename A, typename B>
+        std::remove_const_t<A> dot(
+            const core::VectorView<A>& lhs,
+            const core::VectorView<B>& rhs
+        );
 
         // Comparison operations
 
-        template <typename T>
-        bool operator==(const Vector<T>& lhs, const Vector<T>& rhs);
-
-        template <typename T>
-        bool operator!=(const Vector<T>& lhs, const Vector<T>& rhs);
-
-        template <typename T>
-        bool operator==(const Matrix<T>& lhs, const Matrix<T>& rhs);
-
-        template <typename T>
-        bool operator!=(const Matrix<T>& lhs, const Matrix<T>& rhs);
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_elementwise_pair<L, R>::value))* = nullptr
+        >
+        bool operator==(const L& lhs, const R& rhs);
+
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_elementwise_pair<L, R>::value))* = nullptr
+        >
+        bool operator!=(const L& lhs, const R& rhs);
     }
 }
 
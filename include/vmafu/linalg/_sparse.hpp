@@ -0,0 +1,114 @@
+// linalg/_sparse.hpp
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "../core/core.hpp"
+#include "../utils/_compat.hpp"
+#include "../utils/_parallel_for.hpp"
+
+#include "_blas.hpp"
+
+
+namespace vmafu {
+    namespace linalg {
+        // CSR kernels: rows are split across threads ( threads == 0 uses
+        // every hardware thread; small matrices stay on the caller ).
+        // Outputs must not overlap the inputs.
+
+        // y = alpha * A * x + beta * y
+
+        template <typename T, typename B>
+        void spmv(
+            const typename core::VectorView<T>::value_type& alpha,
+            const SparseMatrix<T>& matrix,
+            const core::VectorView<B>& x,
+            const typename core::VectorView<T>::value_type& beta,
+            const core::VectorView<T>& y,
+            size_t threads = 0
+        );
+
+        template <typename T, typename AllocatorX, typename AllocatorY>
+        void spmv(
+            const typename Vector<T, AllocatorY>::value_type& alpha,
+            const SparseMatrix<T>& matrix,
+            const Vector<T, AllocatorX>& x,
+            const typename Vector<T, AllocatorY>::value_type& beta,
+            Vector<T, AllocatorY>& y,
+            size_t threads = 0
+        );
+
+        // C = alpha * A * B + beta * C, with B and C dense
+
+        template <typename T, typename B>
+        void spmm(
+            const typename core::MatrixView<T>::value_type& alpha,
+            const SparseMatrix<T>& matrix,
+            const core::MatrixView<B>& dense,
+            const typename core::MatrixView<T>::value_type& beta,
+            const core::MatrixView<T>& result,
+            size_t threads = 0
+        );
+
+        template <typename T, typename AllocatorB, typename AllocatorC>
+        void spmm(
+            const typename Matrix<T, AllocatorC>::value_type& alpha,
+            const SparseMatrix<T>& matrix,
+            const Matrix<T, AllocatorB>& dense,
+            const typename Matrix<T, AllocatorC>::value_type& beta,
+            Matrix<T, AllocatorC>& result,
+            size_t threads = 0
+        );
+
+        // Sparse operators
+
+        template <typename T, typename Allocator>
+        Vector<T> operator*(
+            const SparseMatrix<T>& matrix,
+            const Vector<T, Allocator>& vector
+        );
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T> operator*(
+            const SparseMatrix<T>& matrix,
+            const Matrix<T, Allocator, Layout>& dense
+        );
+
+        template <typename T>
+        SparseMatrix<T> operator+(
+            const SparseMatrix<T>& lhs,
+            const SparseMatrix<T>& rhs
+        );
+
+        template <typename T>
+        SparseMatrix<T> operator-(
+            const SparseMatrix<T>& lhs,
+            const SparseMatrix<T>& rhs
+        );
+
+        template <typename T>
+        SparseMatrix<T> operator-(const SparseMatrix<T>& matrix);
+
+        template <typename T>
+        SparseMatrix<T> operator*(
+            const SparseMatrix<T>& matrix,
+            const typename SparseMatrix<T>::value_type& scalar
+        );
+
+        template <typename T>
+        SparseMatrix<T> operator*(
+            const typename SparseMatrix<T>::value_type& scalar,
+            const SparseMatrix<T>& matrix
+        );
+    }
+}
+
+
+#include "detail/_sparse.ipp"
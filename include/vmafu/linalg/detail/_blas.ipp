@@ -0,0 +1,243 @@
+// linalg/detail/_blas.ipp
+
+
+namespace vmafu {
+    namespace linalg {
+        // Helper methods
+
+        namespace internal {
+            // y = beta * y; beta == 0 overwrites, so NaN / Inf in an
+            // uninitialized output do not leak into the result
+
+            template <typename T>
+            void scale(const T& beta, const core::VectorView<T>& y) {
+                if (beta == T(0)) {
+                    y.fill(T(0));
+                } else if (beta != T(1)) {
+                    for (size_t i = 0; i < y.size(); i++) {
+                        y[i] *= beta;
+                    }
+                }
+            }
+
+            template <typename T>
+            void scale(const T& beta, const core::MatrixView<T>& result) {
+                for (size_t i = 0; i < result.rows(); i++) {
+                    scale(beta, result.row(i));
+                }
+            }
+        }
+
+        // Level 1
+
+        template <typename A, typename B>
+        void axpy(
+            const typename core::VectorView<B>::value_type& alpha,
+            const core::VectorView<A>& x,
+            const core::VectorView<B>& y
+        ) {
+            if (x.size() != y.size()) {
+                throw std::invalid_argument(
+                    "blas::axpy: Vector sizes must match"
+                );
+            }
+
+            for (size_t i = 0; i < y.size(); i++) {
+                y[i] += alpha * x[i];
+            }
+        }
+
+        template <typename T, typename AllocatorX, typename AllocatorY>
+        void axpy(
+            const typename Vector<T, AllocatorX>::value_type& alpha,
+            const Vector<T, AllocatorX>& x,
+            Vector<T, AllocatorY>& y
+        ) {
+            axpy(alpha, x.view(), y.view());
+        }
+
+        // Level 2
+
+        template <typename A, typename B, typename C>
+        void gemv(
+            const typename core::VectorView<C>::value_type& alpha,
+            const core::MatrixView<A>& matrix,
+            const core::VectorView<B>& x,
+            const typename core::VectorView<C>::value_type& beta,
+            const core::VectorView<C>& y,
+            Transpose trans
+        ) {
+            using T = typename core::VectorView<C>::value_type;
+
+            bool transposed = trans == Transpose::TRANS;
+
+            size_t rows = transposed ? matrix.cols() : matrix.rows();
+            size_t cols = transposed ? matrix.rows() : matrix.cols();
+
+            if (x.size() != cols || y.size() != rows) {
+                throw std::invalid_argument(
+                    "blas::gemv: Incompatible dimensions"
+                );
+            }
+
+            if (!transposed) {
+                // Row dots: each row of A is read contiguously
+
+                for (size_t i = 0; i < rows; i++) {
+                    const A* row = &matrix(i, 0);
+
+                    T sum = T();
+                    for (size_t j = 0; j < cols; j++) {
+                        sum += row[j] * x[j];
+                    }
+
+                    y[i] = beta == T(0) ? alpha * sum : alpha * sum + beta * y[i];
+                }
+            } else {
+                // Row axpys: y += (alpha * x[i]) * row i of A
+
+                internal::scale(beta, y);
+
+                for (size_t i = 0; i < matrix.rows(); i++) {
+                    const T scale = alpha * x[i];
+                    const A* row = &matrix(i, 0);
+
+                    for (size_t j = 0; j < matrix.cols(); j++) {
+                        y[j] += scale * row[j];
+                    }
+                }
+            }
+        }
+
+        template <
+            typename T,
+            typename AllocatorA,
+            typename AllocatorX,
+            typename AllocatorY
+        >
+        void gemv(
+            const typename Vector<T, AllocatorY>::value_type& alpha,
+            const Matrix<T, AllocatorA>& matrix,
+            const Vector<T, AllocatorX>& x,
+            const typename Vector<T, AllocatorY>::value_type& beta,
+            Vector<T, AllocatorY>& y,
+            Transpose trans
+        ) {
+            gemv(alpha, matrix.view(), x.view(), beta, y.view(), trans);
+        }
+
+        // Level 3
+
+        template <typename A, typename B, typename C>
+        void gemm(
+            const typename core::MatrixView<C>::value_type& alpha,
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs,
+            const typename core::MatrixView<C>::value_type& beta,
+            const core::MatrixView<C>& result,
+            Transpose trans_lhs,
+            Transpose trans_rhs
+        ) {
+            using T = typename core::MatrixView<C>::value_type;
+
+            bool lhs_t = trans_lhs == Transpose::TRANS;
+            bool rhs_t = trans_rhs == Transpose::TRANS;
+
+            size_t m = lhs_t ? lhs.cols() : lhs.rows();
+            size_t k = lhs_t ? lhs.rows() : lhs.cols();
+            size_t n = rhs_t ? rhs.rows() : rhs.cols();
+
+            if (
+                (rhs_t ? rhs.cols() : rhs.rows()) != k || \
+                result.rows() != m || result.cols() != n
+            ) {
+                throw std::invalid_argument(
+                    "blas::gemm: Incompatible dimensions"
+                );
+            }
+
+            internal::scale(beta, result);
+
+            // Loop orders keep the innermost loop on contiguous rows; only
+            // A^T * B^T has to walk result columns
+
+            if (!lhs_t && !rhs_t) {
+                for (size_t i = 0; i < m; i++) {
+                    T* result_row = &result(i, 0);
+
+                    for (size_t p = 0; p < k; p++) {
+                        const T scale = alpha * lhs(i, p);
+                        const B* rhs_row = &rhs(p, 0);
+
+                        for (size_t j = 0; j < n; j++) {
+                            result_row[j] += scale * rhs_row[j];
+                        }
+                    }
+                }
+            } else if (lhs_t && !rhs_t) {
+                for (size_t p = 0; p < k; p++) {
+                    const A* lhs_row = &lhs(p, 0);
+                    const B* rhs_row = &rhs(p, 0);
+
+                    for (size_t i = 0; i < m; i++) {
+                        const T scale = alpha * lhs_row[i];
+                        T* result_row = &result(i, 0);
+
+                        for (size_t j = 0; j < n; j++) {
+                            result_row[j] += scale * rhs_row[j];
+                        }
+                    }
+                }
+            } else if (!lhs_t && rhs_t) {
+                for (size_t i = 0; i < m; i++) {
+                    const A* lhs_row = &lhs(i, 0);
+
+                    for (size_t j = 0; j < n; j++) {
+                        const B* rhs_row = &rhs(j, 0);
+
+                        T sum = T();
+                        for (size_t p = 0; p < k; p++) {
+                            sum += lhs_row[p] * rhs_row[p];
+                        }
+
+                        result(i, j) += alpha * sum;
+                    }
+                }
+            } else {
+                for (size_t j = 0; j < n; j++) {
+                    const B* rhs_row = &rhs(j, 0);
+
+                    for (size_t p = 0; p < k; p++) {
+                        const T scale = alpha * rhs_row[p];
+                        const A* lhs_row = &lhs(p, 0);
+
+                        for (size_t i = 0; i < m; i++) {
+                            result(i, j) += scale * lhs_row[i];
+                        }
+                    }
+                }
+            }
+        }
+
+        template <
+            typename T,
+            typename AllocatorA,
+            typename AllocatorB,
+            typename AllocatorC
+        >
+        void gemm(
+            const typename Matrix<T, AllocatorC>::value_type& alpha,
+            const Matrix<T, AllocatorA>& lhs,
+            const Matrix<T, AllocatorB>& rhs,
+            const typename Matrix<T, AllocatorC>::value_type& beta,
+            Matrix<T, AllocatorC>& result,
+            Transpose trans_lhs,
+            Transpose trans_rhs
+        ) {
+            gemm(
+                alpha, lhs.view(), rhs.view(), beta, result.view(),
+                trans_lhs, trans_rhs
+            );
+        }
+    }
+}
@@ -0,0 +1,28 @@
+// linalg/detail/_determinants.ipp
+
+
+namespace vmafu {
+    namespace linalg {
+        // Determinant methods
+
+        template <typename T>
+        T det(const LUDecomposition<T>& decomposition) {
+            if (decomposition.singular) {
+                return T(0);
+            }
+
+            T result = static_cast<T>(decomposition.permutation_sign());
+
+            for (size_t i = 0; i < decomposition.factors.rows(); i++) {
+                result *= decomposition.factors(i, i);
+            }
+
+            return result;
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        T det(const Matrix<T, Allocator, Layout>& matrix) {
+            return det(lu(matrix));
+        }
+    }
+}
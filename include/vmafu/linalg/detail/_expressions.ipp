@@ -0,0 +1,424 @@
+// linalg/detail/_expressions.ipp
+
+
+namespace vmafu {
+    namespace linalg {
+        // Vector leaf
+
+        template <typename Holder>
+        VectorLeaf<Holder>::VectorLeaf(Holder vector)
+        : _vector(std::forward<Holder>(vector)) {}
+
+        template <typename Holder>
+        size_t VectorLeaf<Holder>::size() const noexcept {
+            return _vector.size();
+        }
+
+        template <typename Holder>
+        const typename VectorLeaf<Holder>::value_type&
+        VectorLeaf<Holder>::operator[](size_t index) const noexcept {
+            return _vector[index];
+        }
+
+        // Matrix leaf
+
+        template <typename Holder>
+        MatrixLeaf<Holder>::MatrixLeaf(Holder matrix)
+        : _matrix(std::forward<Holder>(matrix)) {}
+
+        template <typename Holder>
+        size_t MatrixLeaf<Holder>::rows() const noexcept {
+            return _matrix.rows();
+        }
+
+        template <typename Holder>
+        size_t MatrixLeaf<Holder>::cols() const noexcept {
+            return _matrix.cols();
+        }
+
+        template <typename Holder>
+        size_t MatrixLeaf<Holder>::size() const noexcept {
+            return _matrix.size();
+        }
+
+        template <typename Holder>
+        const typename MatrixLeaf<Holder>::value_type&
+        MatrixLeaf<Holder>::operator[](size_t index) const noexcept {
+            return _matrix[index];
+        }
+
+        template <typename Holder>
+        const typename MatrixLeaf<Holder>::value_type&
+        MatrixLeaf<Holder>::operator()(size_t row, size_t col) const noexcept {
+            return _matrix(row, col);
+        }
+
+        // Vector nodes
+
+        template <typename Op, typename Lhs, typename Rhs>
+        VectorBinary<Op, Lhs, Rhs>::VectorBinary(Lhs lhs, Rhs rhs, Op op)
+        : _lhs(std::move(lhs)), _rhs(std::move(rhs)), _op(op) {}
+
+        template <typename Op, typename Lhs, typename Rhs>
+        size_t VectorBinary<Op, Lhs, Rhs>::size() const noexcept {
+            return _lhs.size();
+        }
+
+        template <typename Op, typename Lhs, typename Rhs>
+        typename VectorBinary<Op, Lhs, Rhs>::value_type
+        VectorBinary<Op, Lhs, Rhs>::operator[](size_t index) const {
+            return _op(_lhs[index], _rhs[index]);
+        }
+
+        template <typename Op, typename Operand>
+        VectorUnary<Op, Operand>::VectorUnary(Operand operand, Op op)
+        : _operand(std::move(operand)), _op(op) {}
+
+        template <typename Op, typename Operand>
+        size_t VectorUnary<Op, Operand>::size() const noexcept {
+            return _operand.size();
+        }
+
+        template <typename Op, typename Operand>
+        typename VectorUnary<Op, Operand>::value_type
+        VectorUnary<Op, Operand>::operator[](size_t index) const {
+            return _op(_operand[index]);
+        }
+
+        // Matrix nodes
+
+        template <typename Op, typename Lhs, typename Rhs>
+        MatrixBinary<Op, Lhs, Rhs>::MatrixBinary(Lhs lhs, Rhs rhs, Op op)
+        : _lhs(std::move(lhs)), _rhs(std::move(rhs)), _op(op) {}
+
+        template <typename Op, typename Lhs, typename Rhs>
+        size_t MatrixBinary<Op, Lhs, Rhs>::rows() const noexcept {
+            return _lhs.rows();
+        }
+
+        template <typename Op, typename Lhs, typename Rhs>
+        size_t MatrixBinary<Op, Lhs, Rhs>::cols() const noexcept {
+            return _lhs.cols();
+        }
+
+        template <typename Op, typename Lhs, typename Rhs>
+        size_t MatrixBinary<Op, Lhs, Rhs>::size() const noexcept {
+            return _lhs.size();
+        }
+
+        template <typename Op, typename Lhs, typename Rhs>
+        typename MatrixBinary<Op, Lhs, Rhs>::value_type
+        MatrixBinary<Op, Lhs, Rhs>::operator[](size_t index) const {
+            return _op(_lhs[index], _rhs[index]);
+        }
+
+        template <typename Op, typename Lhs, typename Rhs>
+        typename MatrixBinary<Op, Lhs, Rhs>::value_type
+        MatrixBinary<Op, Lhs, Rhs>::operator()(size_t row, size_t col) const {
+            return _op(_lhs(row, col), _rhs(row, col));
+        }
+
+        template <typename Op, typename Operand>
+        MatrixUnary<Op, Operand>::MatrixUnary(Operand operand, Op op)
+        : _operand(std::move(operand)), _op(op) {}
+
+        template <typename Op, typename Operand>
+        size_t MatrixUnary<Op, Operand>::rows() const noexcept {
+            return _operand.rows();
+        }
+
+        template <typename Op, typename Operand>
+        size_t MatrixUnary<Op, Operand>::cols() const noexcept {
+            return _operand.cols();
+        }
+
+        template <typename Op, typename Operand>
+        size_t MatrixUnary<Op, Operand>::size() const noexcept {
+            return _operand.size();
+        }
+
+        template <typename Op, typename Operand>
+        typename MatrixUnary<Op, Operand>::value_type
+        MatrixUnary<Op, Operand>::operator[](size_t index) const {
+            return _op(_operand[index]);
+        }
+
+        template <typename Op, typename Operand>
+        typename MatrixUnary<Op, Operand>::value_type
+        MatrixUnary<Op, Operand>::operator()(size_t row, size_t col) const {
+            return _op(_operand(row, col));
+        }
+
+        // Functors
+
+        template <typename U>
+        U Negate::operator()(const U& value) const {
+            return -value;
+        }
+
+        template <typename Op, typename T>
+        template <typename U>
+        U BindLeft<Op, T>::operator()(const U& value) const {
+            return Op()(scalar, value);
+        }
+
+        template <typename Op, typename T>
+        template <typename U>
+        U BindRight<Op, T>::operator()(const U& value) const {
+            return Op()(value, scalar);
+        }
+
+        // Operand conversion
+
+        template <typename T, typename Allocator>
+        VectorLeaf<const Vector<T, Allocator>&> as_operand(
+            const Vector<T, Allocator>& vector
+        ) {
+            return VectorLeaf<const Vector<T, Allocator>&>(vector);
+        }
+
+        template <typename T, typename Allocator>
+        VectorLeaf<Vector<T, Allocator>> as_operand(
+            Vector<T, Allocator>&& vector
+        ) {
+            return VectorLeaf<Vector<T, Allocator>>(std::move(vector));
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        MatrixLeaf<const Matrix<T, Allocator, Layout>&> as_operand(
+            const Matrix<T, Allocator, Layout>& matrix
+        ) {
+            return MatrixLeaf<const Matrix<T, Allocator, Layout>&>(matrix);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        MatrixLeaf<Matrix<T, Allocator, Layout>> as_operand(
+            Matrix<T, Allocator, Layout>&& matrix
+        ) {
+            return MatrixLeaf<Matrix<T, Allocator, Layout>>(std::move(matrix));
+        }
+
+        template <typename Expression>
+        const Expression& as_operand(
+            const core::VectorExpression<Expression>& expression
+        ) {
+            return expression.derived();
+        }
+
+        template <typename Expression>
+        const Expression& as_operand(
+            const core::MatrixExpression<Expression>& expression
+        ) {
+            return expression.derived();
+        }
+
+        template <typename Expression>
+        Expression&& as_operand(
+            core::VectorExpression<Expression>&& expression
+        ) {
+            return static_cast<Expression&&>(expression);
+        }
+
+        template <typename Expression>
+        Expression&& as_operand(
+            core::MatrixExpression<Expression>&& expression
+        ) {
+            return static_cast<Expression&&>(expression);
+        }
+
+        // Evaluation
+
+        template <typename T, typename Allocator>
+        const Vector<T, Allocator>& eval(const Vector<T, Allocator>& vector) {
+            return vector;
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        const Matrix<T, Allocator, Layout>& eval(
+            const Matrix<T, Allocator, Layout>& matrix
+        ) {
+            return matrix;
+        }
+
+        template <typename Expression>
+        Vector<typename Expression::value_type> eval(
+            const core::VectorExpression<Expression>& expression
+        ) {
+            return Vector<typename Expression::value_type>(expression);
+        }
+
+        template <typename Expression>
+        Matrix<
+            typename Expression::value_type,
+            core::AlignedAllocator<typename Expression::value_type>,
+            typename Expression::layout_type
+        > eval(const core::MatrixExpression<Expression>& expression) {
+            return Matrix<
+                typename Expression::value_type,
+                core::AlignedAllocator<typename Expression::value_type>,
+                typename Expression::layout_type
+            >(expression);
+        }
+
+        // Helper methods
+
+        namespace internal {
+            template <typename L, typename R>
+            bool same_shape(const L& lhs, const R& rhs, std::true_type) {
+                return lhs.size() == rhs.size();
+            }
+
+            template <typename L, typename R>
+            bool same_shape(const L& lhs, const R& rhs, std::false_type) {
+                return lhs.rows() == rhs.rows() && lhs.cols() == rhs.cols();
+            }
+
+            template <typename T>
+            void check_divisor(const T& scalar) {
+                VMAFU_IF_CONSTEXPR(VMAFU_IS_FLOATING_POINT_V(T)) {
+                    if (std::abs(scalar) < 1e-10) {
+                        throw std::invalid_argument(
+                            "operations::operator/: Division by zero"
+                        );
+                    }
+                } else {
+                    if (scalar == T{0}) {
+                        throw std::invalid_argument(
+                            "operations::operator/: Division by zero"
+                        );
+                    }
+                }
+            }
+        }
+
+        // Elementwise operations
+
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_elementwise_pair<L, R>::value))*
+        >
+        binary_t<std::plus<>, L, R> operator+(L&& lhs, R&& rhs) {
+            if (!internal::same_shape(lhs, rhs, is_vector_operand<L>())) {
+                throw std::invalid_argument(
+                    "operations::operator+: Operand dimensions must match"
+                );
+            }
+
+            return binary_t<std::plus<>, L, R>(
+                as_operand(std::forward<L>(lhs)), as_operand(std::forward<R>(rhs))
+            );
+        }
+
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_elementwise_pair<L, R>::value))*
+        >
+        binary_t<std::minus<>, L, R> operator-(L&& lhs, R&& rhs) {
+            if (!internal::same_shape(lhs, rhs, is_vector_operand<L>())) {
+                throw std::invalid_argument(
+                    "operations::operator-: Operand dimensions must match"
+                );
+            }
+
+            return binary_t<std::minus<>, L, R>(
+                as_operand(std::forward<L>(lhs)), as_operand(std::forward<R>(rhs))
+            );
+        }
+
+        template <
+            typename X,
+            VMAFU_ENABLE_IF_T(is_operand<X>::value)*
+        >
+        unary_t<Negate, X> operator-(X&& operand) {
+            return unary_t<Negate, X>(as_operand(std::forward<X>(operand)));
+        }
+
+        template <
+            typename X,
+            typename S,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))*
+        >
+        right_t<std::multiplies<>, X> operator*(X&& operand, const S& scalar) {
+            return right_t<std::multiplies<>, X>(
+                as_operand(std::forward<X>(operand)),
+                {static_cast<operand_value_t<X>>(scalar)}
+            );
+        }
+
+        template <
+            typename S,
+            typename X,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))*
+        >
+        left_t<std::multiplies<>, X> operator*(const S& scalar, X&& operand) {
+            return left_t<std::multiplies<>, X>(
+                as_operand(std::forward<X>(operand)),
+                {static_cast<operand_value_t<X>>(scalar)}
+            );
+        }
+
+        template <
+            typename X,
+            typename S,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))*
+        >
+        right_t<std::divides<>, X> operator/(X&& operand, const S& scalar) {
+            internal::check_divisor(static_cast<operand_value_t<X>>(scalar));
+
+            return right_t<std::divides<>, X>(
+                as_operand(std::forward<X>(operand)),
+                {static_cast<operand_value_t<X>>(scalar)}
+            );
+        }
+
+        template <
+            typename X,
+            typename S,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))*
+        >
+        right_t<std::plus<>, X> operator+(X&& operand, const S& scalar) {
+            return right_t<std::plus<>, X>(
+                as_operand(std::forward<X>(operand)),
+                {static_cast<operand_value_t<X>>(scalar)}
+            );
+        }
+
+        template <
+            typename S,
+            typename X,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))*
+        >
+        left_t<std::plus<>, X> operator+(const S& scalar, X&& operand) {
+            return left_t<std::plus<>, X>(
+                as_operand(std::forward<X>(operand)),
+                {static_cast<operand_value_t<X>>(scalar)}
+            );
+        }
+
+        template <
+            typename X,
+            typename S,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))*
+        >
+        right_t<std::minus<>, X> operator-(X&& operand, const S& scalar) {
+            return right_t<std::minus<>, X>(
+                as_operand(std::forward<X>(operand)),
+                {static_cast<operand_value_t<X>>(scalar)}
+            );
+        }
+
+        template <
+            typename S,
+            typename X,
+            VMAFU_ENABLE_IF_T((is_scalar_operand<S, X>::value))*
+        >
+        left_t<std::minus<>, X> operator-(const S& scalar, X&& operand) {
+            return left_t<std::minus<>, X>(
+                as_operand(std::forward<X>(operand)),
+                {static_cast<operand_value_t<X>>(scalar)}
+            );
+        }
+    }
+}
@@ -0,0 +1,262 @@
+// linalg/detail/_fixed.ipp
+
+
+namespace vmafu {
+    namespace linalg {
+        // Helper methods
+
+        namespace internal {
+            template <typename T, size_t N>
+            constexpr bool fixed_equal(const T* lhs, const T* rhs) noexcept {
+                bool equal = true;
+
+                utils::unroll<N>([&](size_t i) {
+                    VMAFU_IF_CONSTEXPR (VMAFU_IS_FLOATING_POINT_V(T)) {
+                        T difference = lhs[i] - rhs[i];
+
+                        equal &= !((difference < T{0} ? -difference : difference) > T(1e-10));
+                    } else {
+                        equal &= lhs[i] == rhs[i];
+                    }
+                });
+
+                return equal;
+            }
+        }
+
+        // FixedVector operations
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator+(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept {
+            FixedVector<T, N> result(lhs);
+
+            return result += rhs;
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator-(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept {
+            FixedVector<T, N> result(lhs);
+
+            return result -= rhs;
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator-(const FixedVector<T, N>& vector) noexcept {
+            FixedVector<T, N> result;
+
+            utils::unroll<N>([&](size_t i) { result[i] = -vector[i]; });
+
+            return result;
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator*(
+            const FixedVector<T, N>& vector,
+            const typename FixedVector<T, N>::value_type& scalar
+        ) noexcept {
+            FixedVector<T, N> result(vector);
+
+            return result *= scalar;
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator*(
+            const typename FixedVector<T, N>::value_type& scalar,
+            const FixedVector<T, N>& vector
+        ) noexcept {
+            return vector * scalar;
+        }
+
+        template <typename T, size_t N>
+        constexpr FixedVector<T, N> operator/(
+            const FixedVector<T, N>& vector,
+            const typename FixedVector<T, N>::value_type& scalar
+        ) {
+            FixedVector<T, N> result(vector);
+
+            return result /= scalar;
+        }
+
+        template <typename T, size_t N>
+        constexpr T dot(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept {
+            T sum = T();
+
+            utils::unroll<N>([&](size_t i) { sum += lhs[i] * rhs[i]; });
+
+            return sum;
+        }
+
+        template <typename T>
+        constexpr FixedVector<T, 3> cross(
+            const FixedVector<T, 3>& lhs,
+            const FixedVector<T, 3>& rhs
+        ) noexcept {
+            return FixedVector<T, 3>(
+                lhs[1] * rhs[2] - lhs[2] * rhs[1],
+                lhs[2] * rhs[0] - lhs[0] * rhs[2],
+                lhs[0] * rhs[1] - lhs[1] * rhs[0]
+            );
+        }
+
+        // FixedMatrix operations
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator+(
+            const FixedMatrix<T, R, C>& lhs,
+            const FixedMatrix<T, R, C>& rhs
+        ) noexcept {
+            FixedMatrix<T, R, C> result(lhs);
+
+            return result += rhs;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator-(
+            const FixedMatrix<T, R, C>& lhs,
+            const FixedMatrix<T, R, C>& rhs
+        ) noexcept {
+            FixedMatrix<T, R, C> result(lhs);
+
+            return result -= rhs;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator-(const FixedMatrix<T, R, C>& matrix) noexcept {
+            FixedMatrix<T, R, C> result;
+
+            utils::unroll<R * C>([&](size_t i) { result[i] = -matrix[i]; });
+
+            return result;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator*(
+            const FixedMatrix<T, R, C>& matrix,
+            const typename FixedMatrix<T, R, C>::value_type& scalar
+        ) noexcept {
+            FixedMatrix<T, R, C> result(matrix);
+
+            return result *= scalar;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator*(
+            const typename FixedMatrix<T, R, C>::value_type& scalar,
+            const FixedMatrix<T, R, C>& matrix
+        ) noexcept {
+            return matrix * scalar;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, R, C> operator/(
+            const FixedMatrix<T, R, C>& matrix,
+            const typename FixedMatrix<T, R, C>::value_type& scalar
+        ) {
+            FixedMatrix<T, R, C> result(matrix);
+
+            return result /= scalar;
+        }
+
+        template <typename T, size_t R, size_t K, size_t C>
+        constexpr FixedMatrix<T, R, C> operator*(
+            const FixedMatrix<T, R, K>& lhs,
+            const FixedMatrix<T, K, C>& rhs
+        ) noexcept {
+            FixedMatrix<T, R, C> result;
+
+            utils::unroll<R>([&](size_t i) {
+                utils::unroll<K>([&](size_t k) {
+                    const T scale = lhs(i, k);
+
+                    utils::unroll<C>([&](size_t j) { result(i, j) += scale * rhs(k, j); });
+                });
+            });
+
+            return result;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedVector<T, R> operator*(
+            const FixedMatrix<T, R, C>& matrix,
+            const FixedVector<T, C>& vector
+        ) noexcept {
+            FixedVector<T, R> result;
+
+            utils::unroll<R>([&](size_t i) {
+                utils::unroll<C>([&](size_t j) { result[i] += matrix(i, j) * vector[j]; });
+            });
+
+            return result;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedVector<T, C> operator*(
+            const FixedVector<T, R>& vector,
+            const FixedMatrix<T, R, C>& matrix
+        ) noexcept {
+            FixedVector<T, C> result;
+
+            utils::unroll<R>([&](size_t i) {
+                const T scale = vector[i];
+
+                utils::unroll<C>([&](size_t j) { result[j] += scale * matrix(i, j); });
+            });
+
+            return result;
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr FixedMatrix<T, C, R> transpose(const FixedMatrix<T, R, C>& matrix) noexcept {
+            FixedMatrix<T, C, R> result;
+
+            utils::unroll<R>([&](size_t i) {
+                utils::unroll<C>([&](size_t j) { result(j, i) = matrix(i, j); });
+            });
+
+            return result;
+        }
+
+        // Comparison operations
+
+        template <typename T, size_t N>
+        constexpr bool operator==(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept {
+            return internal::fixed_equal<T, N>(lhs.data(), rhs.data());
+        }
+
+        template <typename T, size_t N>
+        constexpr bool operator!=(
+            const FixedVector<T, N>& lhs,
+            const FixedVector<T, N>& rhs
+        ) noexcept {
+            return !(lhs == rhs);
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr bool operator==(
+            const FixedMatrix<T, R, C>& lhs,
+            const FixedMatrix<T, R, C>& rhs
+        ) noexcept {
+            return internal::fixed_equal<T, R * C>(lhs.data(), rhs.data());
+        }
+
+        template <typename T, size_t R, size_t C>
+        constexpr bool operator!=(
+            const FixedMatrix<T, R, C>& lhs,
+            const FixedMatrix<T, R, C>& rhs
+        ) noexcept {
+            return !(lhs == rhs);
+        }
+    }
+}
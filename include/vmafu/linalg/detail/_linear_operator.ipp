@@ -0,0 +1,245 @@
+// linalg/detail/_linear_operator.ipp
+
+
+namespace vmafu {
+    namespace linalg {
+        // Helper methods
+
+        namespace internal {
+            constexpr size_t OPERATOR_GRAIN = 64;
+
+            template <typename T>
+            void prepare_output(Vector<T>& y, size_t size) {
+                if (y.size() != size) {
+                    y = Vector<T>(size, core::uninitialized);
+                }
+            }
+        }
+
+        // Constructors
+
+        template <typename T>
+        LinearOperator<T>::LinearOperator() : _rows(0), _cols(0) {}
+
+        template <typename T>
+        LinearOperator<T>::LinearOperator(
+            size_t rows,
+            size_t cols,
+            std::function<void(const Vector<T>&, Vector<T>&)> apply,
+            std::function<void(const Vector<T>&, Vector<T>&)> apply_transpose
+        ) : _rows(rows),
+            _cols(cols),
+            _apply(std::move(apply)),
+            _apply_transpose(std::move(apply_transpose)) {}
+
+        // Getters
+
+        template <typename T>
+        size_t LinearOperator<T>::rows() const noexcept {
+            return _rows;
+        }
+
+        template <typename T>
+        size_t LinearOperator<T>::cols() const noexcept {
+            return _cols;
+        }
+
+        template <typename T>
+        bool LinearOperator<T>::has_transpose() const noexcept {
+            return static_cast<bool>(_apply_transpose);
+        }
+
+        // Apply methods
+
+        template <typename T>
+        void LinearOperator<T>::apply(const Vector<T>& x, Vector<T>& y) const {
+            if (!_apply) {
+                throw std::logic_error(
+                    "LinearOperator::apply(): Operator is not initialized"
+                );
+            }
+
+            if (x.size() != _cols) {
+                throw std::invalid_argument(
+                    "LinearOperator::apply(): Vector size must equal operator columns"
+                );
+            }
+
+            if (&x == &y) {
+                throw std::invalid_argument(
+                    "LinearOperator::apply(): Output must not alias the input"
+                );
+            }
+
+            internal::prepare_output(y, _rows);
+
+            _apply(x, y);
+        }
+
+        template <typename T>
+        Vector<T> LinearOperator<T>::apply(const Vector<T>& x) const {
+            Vector<T> result;
+
+            apply(x, result);
+
+            return result;
+        }
+
+        template <typename T>
+        void LinearOperator<T>::apply_transpose(const Vector<T>& x, Vector<T>& y) const {
+            if (!_apply_transpose) {
+                throw std::logic_error(
+                    "LinearOperator::apply_transpose(): Operator has no transpose"
+                );
+            }
+
+            if (x.size() != _rows) {
+                throw std::invalid_argument(
+                    "LinearOperator::apply_transpose(): Vector size must equal operator rows"
+                );
+            }
+
+            if (&x == &y) {
+                throw std::invalid_argument(
+                    "LinearOperator::apply_transpose(): Output must not alias the input"
+                );
+            }
+
+            internal::prepare_output(y, _cols);
+
+            _apply_transpose(x, y);
+        }
+
+        template <typename T>
+        Vector<T> LinearOperator<T>::apply_transpose(const Vector<T>& x) const {
+            Vector<T> result;
+
+            apply_transpose(x, result);
+
+            return result;
+        }
+
+        template <typename T>
+        LinearOperator<T> LinearOperator<T>::transpose() const {
+            return LinearOperator(_cols, _rows, _apply_transpose, _apply);
+        }
+
+        // Static methods
+
+        template <typename T>
+        template <typename Allocator, typename Layout>
+        LinearOperator<T> LinearOperator<T>::from_matrix(
+            const Matrix<T, Allocator, Layout>& matrix
+        ) {
+            const Matrix<T, Allocator, Layout>* A = &matrix;
+
+            return LinearOperator(
+                matrix.rows(), matrix.cols(),
+                [A](const Vector<T>& x, Vector<T>& y) {
+                    // view() is row-major only; other layouts go through
+                    // the layout-aware Matrix * Vector kernels
+
+                    if constexpr (std::is_same_v<Layout, core::RowMajor>) {
+                        multiply(A->view(), x.view(), y.view());
+                    } else {
+                        y = (*A) * x;
+                    }
+                },
+                [A](const Vector<T>& x, Vector<T>& y) {
+                    if constexpr (std::is_same_v<Layout, core::RowMajor>) {
+                        // Row-wise axpy, so the matrix is read in order
+
+                        std::fill(y.data(), y.data() + y.size(), T(0));
+
+                        for (size_t i = 0; i < A->rows(); i++) {
+                            T value = x[i];
+
+                            for (size_t j = 0; j < A->cols(); j++) {
+                                y[j] += (*A)(i, j) * value;
+                            }
+                        }
+                    } else {
+                        y = x * (*A);
+                    }
+                }
+            );
+        }
+
+        template <typename T>
+        LinearOperator<T> LinearOperator<T>::from_sparse(
+            const SparseMatrix<T>& matrix,
+            size_t threads
+        ) {
+            const SparseMatrix<T>* A = &matrix;
+
+            return LinearOperator(
+                matrix.rows(), matrix.cols(),
+                [A, threads](const Vector<T>& x, Vector<T>& y) {
+                    spmv(T(1), *A, x.view(), T(0), y.view(), threads);
+                },
+                [A](const Vector<T>& x, Vector<T>& y) {
+                    const std::vector<size_t>& row_ptr = A->row_ptr();
+                    const std::vector<size_t>& col_indices = A->col_indices();
+                    const std::vector<T>& values = A->values();
+
+                    std::fill(y.data(), y.data() + y.size(), T(0));
+
+                    for (size_t i = 0; i < A->rows(); i++) {
+                        T value = x[i];
+
+                        for (size_t k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+                            y[col_indices[k]] += values[k] * value;
+                        }
+                    }
+                }
+            );
+        }
+
+        template <typename T>
+        template <typename Entry>
+        LinearOperator<T> LinearOperator<T>::from_entries(
+            size_t rows,
+            size_t cols,
+            const Entry& entry,
+            size_t threads
+        ) {
+            return LinearOperator(
+                rows, cols,
+                [entry, rows, cols, threads](const Vector<T>& x, Vector<T>& y) {
+                    utils::parallel_for(
+                        0, rows,
+                        [&](size_t first, size_t last) {
+                            for (size_t i = first; i < last; i++) {
+                                T sum = T(0);
+
+                                for (size_t j = 0; j < cols; j++) {
+                                    sum += static_cast<T>(entry(i, j)) * x[j];
+                                }
+
+                                y[i] = sum;
+                            }
+                        },
+                        threads, internal::OPERATOR_GRAIN
+                    );
+                },
+                [entry, rows, cols, threads](const Vector<T>& x, Vector<T>& y) {
+                    utils::parallel_for(
+                        0, cols,
+                        [&](size_t first, size_t last) {
+                            for (size_t j = first; j < last; j++) {
+                                T sum = T(0);
+
+                                for (size_t i = 0; i < rows; i++) {
+                                    sum += static_cast<T>(entry(i, j)) * x[i];
+                                }
+
+                                y[j] = sum;
+                            }
+                        },
+                        threads, internal::OPERATOR_GRAIN
+                    );
+                }
+            );
+        }
+    }
+}
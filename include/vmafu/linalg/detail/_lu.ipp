@@ -0,0 +1,336 @@
+// linalg/detail/_lu.ipp
+
+
+namespace vmafu {
+    namespace linalg {
+        // Helper methods
+
+        namespace internal {
+            // Unblocked LU of the panel rows [k, n) x columns [k, k + kb)
+            // of a row-major n x n matrix. Pivot rows are exchanged over
+            // the full width, so the rest of the matrix is permuted too
+
+            template <typename T>
+            void factor_panel(
+                T* a,
+                size_t n,
+                size_t k,
+                size_t kb,
+                std::vector<size_t>& pivots,
+                bool& singular
+            ) {
+                for (size_t j = k; j < k + kb; j++) {
+                    size_t pivot = j;
+                    T largest = std::abs(a[j * n + j]);
+
+                    for (size_t i = j + 1; i < n; i++) {
+                        T value = std::abs(a[i * n + j]);
+
+                        if (value > largest) {
+                            largest = value;
+                            pivot = i;
+                        }
+                    }
+
+                    pivots[j] = pivot;
+
+                    if (largest == T(0)) {
+                        singular = true;
+                        continue;
+                    }
+
+                    if (pivot != j) {
+                        std::swap_ranges(a + j * n, a + (j + 1) * n, a + pivot * n);
+                    }
+
+                    T inverse = T(1) / a[j * n + j];
+
+                    const T* pivot_row = a + j * n;
+
+                    for (size_t i = j + 1; i < n; i++) {
+                        T* row = a + i * n;
+
+                        T factor = row[j] * inverse;
+                        row[j] = factor;
+
+                        for (size_t c = j + 1; c < k + kb; c++) {
+                            row[c] -= factor * pivot_row[c];
+                        }
+                    }
+                }
+            }
+
+            // Rows [k, k + kb) x columns [k + kb, n) := L11^-1 of the same
+            // rows ( unit lower triangular )
+
+            template <typename T>
+            void solve_unit_lower_rows(T* a, size_t n, size_t k, size_t kb) {
+                for (size_t i = k + 1; i < k + kb; i++) {
+                    T* row = a + i * n;
+
+                    for (size_t m = k; m < i; m++) {
+                        T factor = row[m];
+                        const T* source = a + m * n;
+
+                        for (size_t c = k + kb; c < n; c++) {
+                            row[c] -= factor * source[c];
+                        }
+                    }
+                }
+            }
+
+            template <typename T>
+            void check_factors(
+                const LUDecomposition<T>& decomposition,
+                size_t rhs_rows
+            ) {
+                if (decomposition.singular) {
+                    throw std::runtime_error("lu::solve: Matrix is singular");
+                }
+
+                if (rhs_rows != decomposition.factors.rows()) {
+                    throw std::invalid_argument(
+                        "lu::solve: Right-hand side rows must equal matrix size"
+                    );
+                }
+            }
+        }
+
+        // Factor extraction methods
+
+        template <typename T>
+        Matrix<T> LUDecomposition<T>::lower() const {
+            size_t n = factors.rows();
+
+            Matrix<T> result(n, n, T(0));
+
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < i; j++) {
+                    result(i, j) = factors(i, j);
+                }
+
+                result(i, i) = T(1);
+            }
+
+            return result;
+        }
+
+        template <typename T>
+        Matrix<T> LUDecomposition<T>::upper() const {
+            size_t n = factors.rows();
+
+            Matrix<T> result(n, n, T(0));
+
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = i; j < n; j++) {
+                    result(i, j) = factors(i, j);
+                }
+            }
+
+            return result;
+        }
+
+        template <typename T>
+        int LUDecomposition<T>::permutation_sign() const noexcept {
+            int sign = 1;
+
+            for (size_t i = 0; i < pivots.size(); i++) {
+                if (pivots[i] != i) {
+                    sign = -sign;
+                }
+            }
+
+            return sign;
+        }
+
+        // Factorization
+
+        template <typename T, typename Allocator, typename Layout>
+        LUDecomposition<T> lu(
+            const Matrix<T, Allocator, Layout>& matrix,
+            size_t block_size
+        ) {
+            if (matrix.rows() != matrix.cols()) {
+                throw std::invalid_argument("lu::lu: Matrix must be square");
+            }
+
+            size_t n = matrix.rows();
+            size_t nb = block_size == 0 ? n : block_size;
+
+            LUDecomposition<T> result;
+
+            result.factors = Matrix<T>(n, n, core::uninitialized);
+            result.pivots.assign(n, 0);
+
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < n; j++) {
+                    result.factors(i, j) = matrix(i, j);
+                }
+            }
+
+            T* a = result.factors.data();
+
+            for (size_t k = 0; k < n; k += nb) {
+                size_t kb = std::min(nb, n - k);
+
+                internal::factor_panel(a, n, k, kb, result.pivots, result.singular);
+
+                if (k + kb < n) {
+                    size_t rest = n - k - kb;
+
+                    internal::solve_unit_lower_rows(a, n, k, kb);
+
+                    // A22 -= L21 * U12
+
+                    gemm(
+                        T(-1),
+                        result.factors.block(k + kb, k, rest, kb),
+                        result.factors.block(k, k + kb, kb, rest),
+                        T(1),
+                        result.factors.block(k + kb, k + kb, rest, rest)
+                    );
+                }
+            }
+
+            return result;
+        }
+
+        // Solve methods
+
+        template <typename T>
+        Vector<T> solve(
+            const LUDecomposition<T>& decomposition,
+            const Vector<T>& rhs
+        ) {
+            internal::check_factors(decomposition, rhs.size());
+
+            size_t n = rhs.size();
+
+            const T* a = decomposition.factors.data();
+
+            Vector<T> x(rhs);
+
+            for (size_t i = 0; i < n; i++) {
+                if (decomposition.pivots[i] != i) {
+                    std::swap(x[i], x[decomposition.pivots[i]]);
+                }
+            }
+
+            for (size_t i = 1; i < n; i++) {
+                T value = x[i];
+                const T* row = a + i * n;
+
+                for (size_t j = 0; j < i; j++) {
+                    value -= row[j] * x[j];
+                }
+
+                x[i] = value;
+            }
+
+            for (size_t i = n; i-- > 0;) {
+                T value = x[i];
+                const T* row = a + i * n;
+
+                for (size_t j = i + 1; j < n; j++) {
+                    value -= row[j] * x[j];
+                }
+
+                x[i] = value / row[i];
+            }
+
+            return x;
+        }
+
+        template <typename T>
+        Matrix<T> solve(
+            const LUDecomposition<T>& decomposition,
+            const Matrix<T>& rhs
+        ) {
+            internal::check_factors(decomposition, rhs.rows());
+
+            size_t n = rhs.rows();
+            size_t m = rhs.cols();
+
+            const T* a = decomposition.factors.data();
+
+            Matrix<T> x(rhs);
+
+            T* b = x.data();
+
+            // Whole right-hand side rows at a time, so every inner loop is
+            // contiguous
+
+            for (size_t i = 0; i < n; i++) {
+                size_t pivot = decomposition.pivots[i];
+
+                if (pivot != i) {
+                    std::swap_ranges(b + i * m, b + (i + 1) * m, b + pivot * m);
+                }
+            }
+
+            for (size_t i = 1; i < n; i++) {
+                T* target = b + i * m;
+
+                for (size_t j = 0; j < i; j++) {
+                    T factor = a[i * n + j];
+                    const T* source = b + j * m;
+
+                    for (size_t c = 0; c < m; c++) {
+                        target[c] -= factor * source[c];
+                    }
+                }
+            }
+
+            for (size_t i = n; i-- > 0;) {
+                T* target = b + i * m;
+
+                for (size_t j = i + 1; j < n; j++) {
+                    T factor = a[i * n + j];
+                    const T* source = b + j * m;
+
+                    for (size_t c = 0; c < m; c++) {
+                        target[c] -= factor * source[c];
+                    }
+                }
+
+                T inverse = T(1) / a[i * n + i];
+
+                for (size_t c = 0; c < m; c++) {
+                    target[c] *= inverse;
+                }
+            }
+
+            return x;
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        Vector<T> solve(
+            const Matrix<T, Allocator, Layout>& matrix,
+            const Vector<T>& rhs
+        ) {
+            return solve(lu(matrix), rhs);
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T> solve(
+            const Matrix<T, Allocator, Layout>& matrix,
+            const Matrix<T>& rhs
+        ) {
+            return solve(lu(matrix), rhs);
+        }
+
+        // Inverse methods
+
+        template <typename T>
+        Matrix<T> inverse(const LUDecomposition<T>& decomposition) {
+            return solve(
+                decomposition, Matrix<T>::identity(decomposition.factors.rows())
+            );
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T> inverse(const Matrix<T, Allocator, Layout>& matrix) {
+            return inverse(lu(matrix));
+        }
+    }
+}
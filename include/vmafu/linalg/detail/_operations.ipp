@@ -3,377 +3,428 @@
 
 namespace vmafu {
     namespace linalg {
-        // Vector-Vector operations
+        // Layout kernels
 
-        template <typename T>
-        Vector<T> operator+(const Vector<T>& lhs, const Vector<T>& rhs) {
-            if (lhs.size() != rhs.size()) {
-                throw std::invalid_argument(
-                    "operations::operator+: Vector sizes must match"
-                );
-            }
-
-            Vector<T> result(lhs.size());
-            for (size_t i = 0; i < lhs.size(); i++) {
-                result[i] = lhs[i] + rhs[i];
-            }
+        namespace internal {
+            // Column-major GEMM: j-k-i order walks lhs and result columns
+            // contiguously
 
-            return result;
-        }
+            template <typename T, typename Allocator>
+            void multiply(
+                const Matrix<T, Allocator, core::ColumnMajor>& lhs,
+                const Matrix<T, Allocator, core::ColumnMajor>& rhs,
+                Matrix<T, Allocator, core::ColumnMajor>& result
+            ) {
+                size_t m = lhs.rows();
 
-        template <typename T>
-        Vector<T> operator-(const Vector<T>& lhs, const Vector<T>& rhs) {
-            if (lhs.size() != rhs.size()) {
-                throw std::invalid_argument(
-                    "operations::operator-: Vector sizes must match"
-                );
-            }
+                for (size_t j = 0; j < rhs.cols(); j++) {
+                    T* result_col = result.data() + j * m;
 
-            Vector<T> result(lhs.size());
-            for (size_t i = 0; i < lhs.size(); i++) {
-                result[i] = lhs[i] - rhs[i];
-            }
+                    std::fill(result_col, result_col + m, T());
 
-            return result;
-        }
+                    for (size_t k = 0; k < lhs.cols(); k++) {
+                        const T scale = rhs(k, j);
+                        const T* lhs_col = lhs.data() + k * m;
 
-        template <typename T>
-        Vector<T> operator-(const Vector<T>& vector) {
-            Vector<T> result(vector.size());
-            for (size_t i = 0; i < vector.size(); i++) {
-                result[i] = -vector[i];
+                        for (size_t i = 0; i < m; i++) {
+                            result_col[i] += scale * lhs_col[i];
+                        }
+                    }
+                }
             }
 
-            return result;
-        }
+            // Tiled GEMM: each (tile_i, tile_k) x (tile_k, tile_j) product
+            // works on three contiguous TILE x TILE blocks; edge tiles are
+            // bounded so the padding is never read
 
-        //  Vector-Scalar operations
+            template <typename T, typename Allocator, size_t TileSize>
+            void multiply(
+                const Matrix<T, Allocator, core::TileMajor<TileSize>>& lhs,
+                const Matrix<T, Allocator, core::TileMajor<TileSize>>& rhs,
+                Matrix<T, Allocator, core::TileMajor<TileSize>>& result
+            ) {
+                using Tiles = core::TileMajor<TileSize>;
 
-        template <typename T>
-        Vector<T> operator*(const Vector<T>& vector, T scalar) {
-            Vector<T> result(vector.size());
-            for (size_t i = 0; i < vector.size(); i++) {
-                result[i] = vector[i] * scalar;
-            }
-
-            return result;
-        }
+                size_t tile_rows = Tiles::tile_count(lhs.rows());
+                size_t tile_inner = Tiles::tile_count(lhs.cols());
+                size_t tile_cols = Tiles::tile_count(rhs.cols());
 
-        template <typename T>
-        Vector<T> operator*(T scalar, const Vector<T>& vector) {
-            return vector * scalar;
-        }
+                for (size_t ti = 0; ti < tile_rows; ti++) {
+                    size_t height = std::min(TileSize, lhs.rows() - ti * TileSize);
 
-        template <typename T>
-        Vector<T> operator/(const Vector<T>& vector, T scalar) {
-            VMAFU_IF_CONSTEXPR(VMAFU_IS_FLOATING_POINT_V(T)) {
-                if (std::abs(scalar) < 1e-10) {
-                    throw std::invalid_argument(
-                        "operations::operator/: Division by zero"
-                    );
-                }
-            } else {
-                if (scalar == T{0}) {
-                    throw std::invalid_argument(
-                        "operations::operator/: Division by zero"
-                    );
-                }
-            }
+                    for (size_t tj = 0; tj < tile_cols; tj++) {
+                        size_t width = std::min(TileSize, rhs.cols() - tj * TileSize);
 
-            Vector<T> result(vector.size());
-            for (size_t i = 0; i < vector.size(); i++) {
-                result[i] = vector[i] / scalar;
-            }
+                        T* c = result.data() + Tiles::tile_offset(ti, tj, result.cols());
 
-            return result;
-        }
+                        std::fill(c, c + Tiles::TILE_ELEMENTS, T());
 
-        template <typename T>
-        Vector<T> operator+(const Vector<T>& vector, T scalar) {
-            Vector<T> result(vector.size());
-            for (size_t i = 0; i < vector.size(); i++) {
-                result[i] = vector[i] + scalar;
-            }
+                        for (size_t tk = 0; tk < tile_inner; tk++) {
+                            size_t depth = std::min(TileSize, lhs.cols() - tk * TileSize);
 
-            return result;
-        }
+                            const T* a = lhs.data() + Tiles::tile_offset(ti, tk, lhs.cols());
+                            const T* b = rhs.data() + Tiles::tile_offset(tk, tj, rhs.cols());
 
-        template <typename T>
-        Vector<T> operator+(T scalar, const Vector<T>& vector) {
-            return vector + scalar;
-        }
+                            for (size_t i = 0; i < height; i++) {
+                                for (size_t k = 0; k < depth; k++) {
+                                    const T scale = a[i * TileSize + k];
 
-        template <typename T>
-        Vector<T> operator-(const Vector<T>& vector, T scalar) {
-            Vector<T> result(vector.size());
-            for (size_t i = 0; i < vector.size(); i++) {
-                result[i] = vector[i] - scalar;
+                                    for (size_t j = 0; j < width; j++) {
+                                        c[i * TileSize + j] += scale * b[k * TileSize + j];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
             }
 
-            return result;
-        }
+            // A layout without a kernel above fails here at compile time
+            // instead of silently copying through RowMajor
 
-        template <typename T>
-        Vector<T> operator-(T scalar, const Vector<T>& vector) {
-            Vector<T> result(vector.size());
-            for (size_t i = 0; i < vector.size(); i++) {
-                result[i] = scalar - vector[i];
+            template <typename T, typename Allocator, typename Layout>
+            void multiply(
+                const Matrix<T, Allocator, Layout>&,
+                const Matrix<T, Allocator, Layout>&,
+                Matrix<T, Allocator, Layout>&
+            ) {
+                static_assert(
+                    sizeof(Layout) == 0,
+                    "linalg::operator*: No matrix product kernel for this storage layout"
+                );
             }
-
-            return result;
         }
 
-        //  Matrix-Matrix operations
+        // Matrix multiplication
 
-        template <typename T>
-        Matrix<T> operator+(const Matrix<T>& lhs, const Matrix<T>& rhs) {
-            if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T, Allocator, Layout> operator*(
+            const Matrix<T, Allocator, Layout>& lhs,
+            const Matrix<T, Allocator, Layout>& rhs
+        ) {
+            if (lhs.cols() != rhs.rows()) {
                 throw std::invalid_argument(
-                    "operations::operator+: Matrix dimensions must match"
+                    "operations::operator*: Incompatible dimensions for matrix multiplication"
                 );
             }
 
-            Matrix<T> result(lhs.rows(), lhs.cols());
-            for (size_t i = 0; i < lhs.size(); i++) {
-                result[i] = lhs[i] + rhs[i];
+            Matrix<T, Allocator, Layout> result(lhs.rows(), rhs.cols(), uninitialized);
+
+            VMAFU_IF_CONSTEXPR (VMAFU_IS_SAME_V(Layout, core::RowMajor)) {
+                multiply(lhs.view(), rhs.view(), result.view());
+            } else {
+                internal::multiply(lhs, rhs, result);
             }
 
             return result;
         }
 
-        template <typename T>
-        Matrix<T> operator-(const Matrix<T>& lhs, const Matrix<T>& rhs) {
-            if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
+        // Matrix-Vector operations
+
+        template <typename T, typename Allocator, typename Layout>
+        Vector<T> operator*(
+            const Matrix<T, Allocator, Layout>& matrix,
+            const Vector<T>& vector
+        ) {
+            if (matrix.cols() != vector.size()) {
                 throw std::invalid_argument(
-                    "operations::operator-: Matrix dimensions must match"
+                    "operations::operator*: Matrix cols must match vector size"
                 );
             }
 
-            Matrix<T> result(lhs.rows(), lhs.cols());
-            for (size_t i = 0; i < lhs.size(); i++) {
-                result[i] = lhs[i] - rhs[i];
-            }
+            VMAFU_IF_CONSTEXPR (VMAFU_IS_SAME_V(Layout, core::RowMajor)) {
+                Vector<T> result(matrix.rows(), uninitialized);
 
-            return result;
-        }
+                multiply(matrix.view(), vector.view(), result.view());
 
-        template <typename T>
-        Matrix<T> operator-(const Matrix<T>& matrix) {
-            Matrix<T> result(matrix.rows(), matrix.cols());
-            for (size_t i = 0; i < matrix.size(); i++) {
-                result[i] = -matrix[i];
-            }
+                return result;
+            } else VMAFU_IF_CONSTEXPR (VMAFU_IS_SAME_V(Layout, core::ColumnMajor)) {
+                // Column axpy: result += vector[j] * column j
 
-            return result;
-        }
+                Vector<T> result(matrix.rows());
 
-        template <typename T>
-        Matrix<T> operator*(const Matrix<T>& lhs, const Matrix<T>& rhs) {
-            if (lhs.cols() != rhs.rows()) {
-                throw std::invalid_argument(
-                    "operations::operator*: Incompatible dimensions for matrix multiplication"
-                );
-            }
+                for (size_t j = 0; j < matrix.cols(); j++) {
+                    const T scale = vector[j];
+                    const T* column = matrix.data() + j * matrix.rows();
 
-            Matrix<T> result(lhs.rows(), rhs.cols());
+                    for (size_t i = 0; i < matrix.rows(); i++) {
+                        result[i] += scale * column[i];
+                    }
+                }
 
-            // Простая реализация O(n^3)
+                return result;
+            } else {
+                Vector<T> result(matrix.rows());
 
-            for (size_t i = 0; i < lhs.rows(); i++) {
-                for (size_t j = 0; j < rhs.cols(); j++) {
-                    T sum = T();
-                    for (size_t k = 0; k < lhs.cols(); k++) {
-                        sum += lhs(i, k) * rhs(k, j);
+                for (size_t i = 0; i < matrix.rows(); i++) {
+                    for (size_t j = 0; j < matrix.cols(); j++) {
+                        result[i] += matrix(i, j) * vector[j];
                     }
-
-                    result(i, j) = sum;
                 }
-            }
 
-            return result;
+                return result;
+            }
         }
 
-        // Matrix-Scalar operations
-
-        template <typename T>
-        Matrix<T> operator*(const Matrix<T>& matrix, T scalar) {
-            Matrix<T> result(matrix.rows(), matrix.cols());
-            for (size_t i = 0; i < matrix.size(); i++) {
-                result[i] = matrix[i] * scalar;
+        template <typename T, typename Allocator, typename Layout>
+        Vector<T> operator*(
+            const Vector<T>& vector,
+            const Matrix<T, Allocator, Layout>& matrix
+        ) {
+            if (vector.size() != matrix.rows()) {
+                throw std::invalid_argument(
+                    "operations::operator*: Vector size must match matrix rows"
+                );
             }
 
-            return result;
-        }
+            VMAFU_IF_CONSTEXPR (VMAFU_IS_SAME_V(Layout, core::ColumnMajor)) {
+                // Column dot: result[j] = column j . vector
 
-        template <typename T>
-        Matrix<T> operator*(T scalar, const Matrix<T>& matrix) {
-            return matrix * scalar;
-        }
+                Vector<T> result(matrix.cols(), uninitialized);
 
-        template <typename T>
-        Matrix<T> operator/(const Matrix<T>& matrix, T scalar) {
-            VMAFU_IF_CONSTEXPR(VMAFU_IS_FLOATING_POINT_V(T)) {
-                if (std::abs(scalar) < 1e-10) {
-                    throw std::invalid_argument(
-                        "operations::operator/: Division by zero"
+                for (size_t j = 0; j < matrix.cols(); j++) {
+                    result[j] = dot(
+                        core::ConstVectorView<T>(
+                            matrix.data() + j * matrix.rows(), matrix.rows()
+                        ),
+                        vector.view()
                     );
                 }
+
+                return result;
             } else {
-                if (scalar == T{0}) {
-                    throw std::invalid_argument(
-                        "operations::operator/: Division by zero"
-                    );
-                }
-            }
+                // Row axpy: result += vector[i] * row i
 
-            Matrix<T> result(matrix.rows(), matrix.cols());
-            for (size_t i = 0; i < matrix.size(); i++) {
-                result[i] = matrix[i] / scalar;
-            }
+                Vector<T> result(matrix.cols());
 
-            return result;
-        }
+                for (size_t i = 0; i < matrix.rows(); i++) {
+                    const T scale = vector[i];
 
-        template <typename T>
-        Matrix<T> operator+(const Matrix<T>& matrix, T scalar) {
-            Matrix<T> result(matrix.rows(), matrix.cols());
-            for (size_t i = 0; i < matrix.size(); i++) {
-                result[i] = matrix[i] + scalar;
-            }
+                    for (size_t j = 0; j < matrix.cols(); j++) {
+                        result[j] += scale * matrix(i, j);
+                    }
+                }
 
-            return result;
+                return result;
+            }
         }
 
-        template <typename T>
-        Matrix<T> operator+(T scalar, const Matrix<T>& matrix) {
-            return matrix + scalar;
+        // Products with expression operands
+
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_product_pair<L, R>::value))*
+        >
+        auto operator*(const L& lhs, const R& rhs) -> decltype(eval(lhs) * eval(rhs)) {
+            return eval(lhs) * eval(rhs);
         }
 
-        template <typename T>
-        Matrix<T> operator-(const Matrix<T>& matrix, T scalar) {
-            Matrix<T> result(matrix.rows(), matrix.cols());
-            for (size_t i = 0; i < matrix.size(); i++) {
-                result[i] = matrix[i] - scalar;
+        // View operations ( results must not overlap the operands )
+
+        template <typename A, typename B, typename C>
+        void multiply(
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs,
+            const core::MatrixView<C>& result
+        ) {
+            if (
+                lhs.cols() != rhs.rows() || \
+                result.rows() != lhs.rows() || result.cols() != rhs.cols()
+            ) {
+                throw std::invalid_argument(
+                    "operations::multiply: Incompatible dimensions for matrix multiplication"
+                );
             }
 
-            return result;
+            gemm(
+                std::remove_const_t<C>(1), lhs, rhs, std::remove_const_t<C>(0), result
+            );
         }
 
-        template <typename T>
-        Matrix<T> operator-(T scalar, const Matrix<T>& matrix) {
-            Matrix<T> result(matrix.rows(), matrix.cols());
-            for (size_t i = 0; i < matrix.size(); i++) {
-                result[i] = scalar - matrix[i];
+        template <typename A, typename B, typename C>
+        void multiply(
+            const core::MatrixView<A>& matrix,
+            const core::VectorView<B>& vector,
+            const core::VectorView<C>& result
+        ) {
+            if (matrix.cols() != vector.size() || result.size() != matrix.rows()) {
+                throw std::invalid_argument(
+                    "operations::multiply: Matrix cols must match vector size"
+                );
             }
 
-            return result;
+            gemv(
+                std::remove_const_t<C>(1), matrix, vector, std::remove_const_t<C>(0), result
+            );
         }
 
-        // Matrix-Vector operations
-
-        template <typename T>
-        Vector<T> operator*(const Matrix<T>& matrix, const Vector<T>& vector) {
-            if (matrix.cols() != vector.size()) {
+        template <typename A, typename B>
+        Matrix<std::remove_const_t<A>> operator+(
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs
+        ) {
+            if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
                 throw std::invalid_argument(
-                    "operations::operator*: Matrix cols must match vector size"
+                    "operations::operator+: Matrix dimensions must match"
                 );
             }
 
-            Vector<T> result(matrix.rows());
-            for (size_t i = 0; i < matrix.rows(); i++) {
-                T sum = T();
-                for (size_t j = 0; j < matrix.cols(); j++) {
-                    sum += matrix(i, j) * vector[j];
+            Matrix<std::remove_const_t<A>> result(lhs.rows(), lhs.cols(), uninitialized);
+            for (size_t i = 0; i < lhs.rows(); i++) {
+                for (size_t j = 0; j < lhs.cols(); j++) {
+                    result(i, j) = lhs(i, j) + rhs(i, j);
                 }
-
-                result[i] = sum;
             }
 
             return result;
         }
 
-        template <typename T>
-        Vector<T> operator*(const Vector<T>& vector, const Matrix<T>& matrix) {
-            if (vector.size() != matrix.rows()) {
+        template <typename A, typename B>
+        Matrix<std::remove_const_t<A>> operator-(
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs
+        ) {
+            if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
                 throw std::invalid_argument(
-                    "operations::operator*: Vector size must match matrix rows"
+                    "operations::operator-: Matrix dimensions must match"
                 );
             }
 
-            Vector<T> result(matrix.cols());
-            for (size_t j = 0; j < matrix.cols(); j++) {
-                T sum = T();
-                for (size_t i = 0; i < matrix.rows(); i++) {
-                    sum += vector[i] * matrix(i, j);
+            Matrix<std::remove_const_t<A>> result(lhs.rows(), lhs.cols(), uninitialized);
+            for (size_t i = 0; i < lhs.rows(); i++) {
+                for (size_t j = 0; j < lhs.cols(); j++) {
+                    result(i, j) = lhs(i, j) - rhs(i, j);
                 }
-
-                result[j] = sum;
             }
 
             return result;
         }
 
-        // Comparison operations
+        template <typename A, typename B>
+        Matrix<std::remove_const_t<A>> operator*(
+            const core::MatrixView<A>& lhs,
+            const core::MatrixView<B>& rhs
+        ) {
+            Matrix<std::remove_const_t<A>> result(lhs.rows(), rhs.cols(), uninitialized);
 
-        template <typename T>
-        bool operator==(const Vector<T>& lhs, const Vector<T>& rhs) {
+            multiply(lhs, rhs, result.view());
+
+            return result;
+        }
+
+        template <typename A, typename B>
+        Vector<std::remove_const_t<A>> operator*(
+            const core::MatrixView<A>& matrix,
+            const core::VectorView<B>& vector
+        ) {
+            Vector<std::remove_const_t<A>> result(matrix.rows(), uninitialized);
+
+            multiply(matrix, vector, result.view());
+
+            return result;
+        }
+
+        template <typename A, typename B>
+        std::remove_const_t<A> dot(
+            const core::VectorView<A>& lhs,
+            const core::VectorView<B>& rhs
+        ) {
             if (lhs.size() != rhs.size()) {
                 throw std::invalid_argument(
-                    "operations::operator==: Vector sizes must match"
+                    "operations::dot: Vector sizes must match"
                 );
             }
 
-            VMAFU_IF_CONSTEXPR(VMAFU_IS_FLOATING_POINT_V(T)) {
-                constexpr T epsilon = T(1e-10);
-                for (size_t i = 0; i < lhs.size(); i++) {
-                    if (std::abs(lhs[i] - rhs[i]) > epsilon) {
-                        return false;
-                    }
-                }
-            } else {
-                for (size_t i = 0; i < lhs.size(); i++) {
-                    if (lhs[i] != rhs[i]) {
-                        return false;
-                    }
-                }
+            std::remove_const_t<A> sum = std::remove_const_t<A>();
+            for (size_t i = 0; i < lhs.size(); i++) {
+                sum += lhs[i] * rhs[i];
             }
 
-            return true;
+            return sum;
         }
 
-        template <typename T>
-        bool operator!=(const Vector<T>& lhs, const Vector<T>& rhs) {
-            return !(lhs == rhs);
-        }
+        // Comparison operations
 
-        template <typename T>
-        bool operator==(const Matrix<T>& lhs, const Matrix<T>& rhs) {
-            if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
-                throw std::invalid_argument(
-                    "operations::operator==: Matrix sizes must match"
-                );
+        namespace internal {
+            template <typename T>
+            bool nearly_equal(const T& lhs, const T& rhs) {
+                VMAFU_IF_CONSTEXPR(VMAFU_IS_FLOATING_POINT_V(T)) {
+                    constexpr T epsilon = T(1e-10);
+
+                    return !(std::abs(lhs - rhs) > epsilon);
+                } else {
+                    return lhs == rhs;
+                }
             }
 
-            VMAFU_IF_CONSTEXPR(VMAFU_IS_FLOATING_POINT_V(T)) {
-                constexpr T epsilon = T(1e-10);
+            template <typename L, typename R>
+            bool equal(const L& lhs, const R& rhs, std::true_type) {
+                if (lhs.size() != rhs.size()) {
+                    throw std::invalid_argument(
+                        "operations::operator==: Vector sizes must match"
+                    );
+                }
+
                 for (size_t i = 0; i < lhs.size(); i++) {
-                    if (std::abs(lhs[i] - rhs[i]) > epsilon) {
+                    if (!nearly_equal<operand_value_t<const L&>>(lhs[i], rhs[i])) {
                         return false;
                     }
                 }
-            } else {
-                for (size_t i = 0; i < lhs.size(); i++) {
-                    if (lhs[i] != rhs[i]) {
-                        return false;
+
+                return true;
+            }
+
+            template <typename L, typename R>
+            bool equal(const L& lhs, const R& rhs, std::false_type) {
+                if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
+                    throw std::invalid_argument(
+                        "operations::operator==: Matrix sizes must match"
+                    );
+                }
+
+                using Layout = typename operand_t<const L&>::layout_type;
+
+                VMAFU_IF_CONSTEXPR (
+                    VMAFU_IS_SAME_V(Layout, typename operand_t<const R&>::layout_type) && \
+                    !core::is_tiled<Layout>::value
+                ) {
+                    for (size_t i = 0; i < lhs.size(); i++) {
+                        if (!nearly_equal<operand_value_t<const L&>>(lhs[i], rhs[i])) {
+                            return false;
+                        }
+                    }
+                } else {
+                    for (size_t i = 0; i < lhs.rows(); i++) {
+                        for (size_t j = 0; j < lhs.cols(); j++) {
+                            if (!nearly_equal<operand_value_t<const L&>>(lhs(i, j), rhs(i, j))) {
+                                return false;
+                            }
+                        }
                     }
                 }
+
+                return true;
             }
+        }
 
-            return true;
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_elementwise_pair<L, R>::value))*
+        >
+        bool operator==(const L& lhs, const R& rhs) {
+            return internal::equal(
+                as_operand(lhs), as_operand(rhs), is_vector_operand<L>()
+            );
         }
 
-        template <typename T>
-        bool operator!=(const Matrix<T>& lhs, const Matrix<T>& rhs) {
+        template <
+            typename L,
+            typename R,
+            VMAFU_ENABLE_IF_T((is_elementwise_pair<L, R>::value))*
+        >
+        bool operator!=(const L& lhs, const R& rhs) {
             return !(lhs == rhs);
         }
     }
@@ -0,0 +1,330 @@
+// linalg/detail/_sparse.ipp
+
+
+namespace vmafu {
+    namespace linalg {
+        // Helper methods
+
+        namespace internal {
+            // Average number of nonzeros per thread before a kernel is split
+
+            constexpr size_t SPARSE_GRAIN = 16384;
+
+            template <typename T>
+            size_t row_grain(const SparseMatrix<T>& matrix) noexcept {
+                size_t chunks = std::max<size_t>(matrix.nnz() / SPARSE_GRAIN, 1);
+
+                return std::max<size_t>(matrix.rows() / chunks, 1);
+            }
+
+            // Row of A times x with four independent accumulators, so the
+            // gathered products are not serialized on one add chain
+
+            template <typename T, typename B>
+            T row_dot(
+                const T* values,
+                const size_t* col_indices,
+                size_t first,
+                size_t last,
+                const core::VectorView<B>& x
+            ) {
+                T sum_0 = T();
+                T sum_1 = T();
+                T sum_2 = T();
+                T sum_3 = T();
+
+                size_t k = first;
+
+                for (; k + 4 <= last; k += 4) {
+                    sum_0 += values[k] * x[col_indices[k]];
+                    sum_1 += values[k + 1] * x[col_indices[k + 1]];
+                    sum_2 += values[k + 2] * x[col_indices[k + 2]];
+                    sum_3 += values[k + 3] * x[col_indices[k + 3]];
+                }
+
+                for (; k < last; k++) {
+                    sum_0 += values[k] * x[col_indices[k]];
+                }
+
+                return (sum_0 + sum_1) + (sum_2 + sum_3);
+            }
+
+            // Row-by-row merge of two CSR matrices with the same shape;
+            // entries present on one side only are combined with zero
+
+            template <typename T, typename Operation>
+            SparseMatrix<T> merge(
+                const SparseMatrix<T>& lhs,
+                const SparseMatrix<T>& rhs,
+                Operation operation
+            ) {
+                const std::vector<size_t>& lhs_ptr = lhs.row_ptr();
+                const std::vector<size_t>& rhs_ptr = rhs.row_ptr();
+                const std::vector<size_t>& lhs_cols = lhs.col_indices();
+                const std::vector<size_t>& rhs_cols = rhs.col_indices();
+                const std::vector<T>& lhs_values = lhs.values();
+                const std::vector<T>& rhs_values = rhs.values();
+
+                std::vector<size_t> row_ptr(lhs.rows() + 1, 0);
+                std::vector<size_t> col_indices;
+                std::vector<T> values;
+
+                col_indices.reserve(lhs.nnz() + rhs.nnz());
+                values.reserve(lhs.nnz() + rhs.nnz());
+
+                for (size_t i = 0; i < lhs.rows(); i++) {
+                    size_t a = lhs_ptr[i];
+                    size_t b = rhs_ptr[i];
+
+                    while (a < lhs_ptr[i + 1] || b < rhs_ptr[i + 1]) {
+                        bool take_lhs = b == rhs_ptr[i + 1] || (
+                            a < lhs_ptr[i + 1] && lhs_cols[a] < rhs_cols[b]
+                        );
+                        bool take_rhs = a == lhs_ptr[i + 1] || (
+                            b < rhs_ptr[i + 1] && rhs_cols[b] < lhs_cols[a]
+                        );
+
+                        if (take_lhs) {
+                            col_indices.push_back(lhs_cols[a]);
+                            values.push_back(operation(lhs_values[a], T()));
+                            a++;
+                        } else if (take_rhs) {
+                            col_indices.push_back(rhs_cols[b]);
+                            values.push_back(operation(T(), rhs_values[b]));
+                            b++;
+                        } else {
+                            col_indices.push_back(lhs_cols[a]);
+                            values.push_back(
+                                operation(lhs_values[a], rhs_values[b])
+                            );
+                            a++;
+                            b++;
+                        }
+                    }
+
+                    row_ptr[i + 1] = values.size();
+                }
+
+                return SparseMatrix<T>(
+                    lhs.rows(), lhs.cols(),
+                    std::move(row_ptr),
+                    std::move(col_indices),
+                    std::move(values)
+                );
+            }
+        }
+
+        // Sparse matrix-vector product
+
+        template <typename T, typename B>
+        void spmv(
+            const typename core::VectorView<T>::value_type& alpha,
+            const SparseMatrix<T>& matrix,
+            const core::VectorView<B>& x,
+            const typename core::VectorView<T>::value_type& beta,
+            const core::VectorView<T>& y,
+            size_t threads
+        ) {
+            if (x.size() != matrix.cols() || y.size() != matrix.rows()) {
+                throw std::invalid_argument(
+                    "sparse::spmv: Incompatible dimensions"
+                );
+            }
+
+            const size_t* row_ptr = matrix.row_ptr().data();
+            const size_t* col_indices = matrix.col_indices().data();
+            const T* values = matrix.values().data();
+
+            utils::parallel_for(
+                0, matrix.rows(),
+                [&](size_t first, size_t last) {
+                    for (size_t i = first; i < last; i++) {
+                        T sum = internal::row_dot(
+                            values, col_indices, row_ptr[i], row_ptr[i + 1], x
+                        );
+
+                        y[i] = beta == T(0) ? alpha * sum : alpha * sum + beta * y[i];
+                    }
+                },
+                threads, internal::row_grain(matrix)
+            );
+        }
+
+        template <typename T, typename AllocatorX, typename AllocatorY>
+        void spmv(
+            const typename Vector<T, AllocatorY>::value_type& alpha,
+            const SparseMatrix<T>& matrix,
+            const Vector<T, AllocatorX>& x,
+            const typename Vector<T, AllocatorY>::value_type& beta,
+            Vector<T, AllocatorY>& y,
+            size_t threads
+        ) {
+            spmv(alpha, matrix, x.view(), beta, y.view(), threads);
+        }
+
+        // Sparse matrix-dense matrix product
+
+        template <typename T, typename B>
+        void spmm(
+            const typename core::MatrixView<T>::value_type& alpha,
+            const SparseMatrix<T>& matrix,
+            const core::MatrixView<B>& dense,
+            const typename core::MatrixView<T>::value_type& beta,
+            const core::MatrixView<T>& result,
+            size_t threads
+        ) {
+            if (
+                dense.rows() != matrix.cols() || \
+                result.rows() != matrix.rows() || \
+                result.cols() != dense.cols()
+            ) {
+                throw std::invalid_argument(
+                    "sparse::spmm: Incompatible dimensions"
+                );
+            }
+
+            const size_t* row_ptr = matrix.row_ptr().data();
+            const size_t* col_indices = matrix.col_indices().data();
+            const T* values = matrix.values().data();
+
+            size_t cols = dense.cols();
+            size_t grain = std::max<size_t>(
+                internal::row_grain(matrix) / std::max<size_t>(cols, 1), 1
+            );
+
+            // Row i of C accumulates a_ik * ( row k of B ): contiguous
+            // axpys over the dense rows, which the compiler vectorizes
+
+            utils::parallel_for(
+                0, matrix.rows(),
+                [&](size_t first, size_t last) {
+                    for (size_t i = first; i < last; i++) {
+                        core::VectorView<T> target = result.row(i);
+
+                        internal::scale(beta, target);
+
+                        T* output = target.data();
+
+                        for (size_t k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+                            const T scale = alpha * values[k];
+                            const B* input = &dense(col_indices[k], 0);
+
+                            for (size_t j = 0; j < cols; j++) {
+                                output[j] += scale * input[j];
+                            }
+                        }
+                    }
+                },
+                threads, grain
+            );
+        }
+
+        template <typename T, typename AllocatorB, typename AllocatorC>
+        void spmm(
+            const typename Matrix<T, AllocatorC>::value_type& alpha,
+            const SparseMatrix<T>& matrix,
+            const Matrix<T, AllocatorB>& dense,
+            const typename Matrix<T, AllocatorC>::value_type& beta,
+            Matrix<T, AllocatorC>& result,
+            size_t threads
+        ) {
+            spmm(alpha, matrix, dense.view(), beta, result.view(), threads);
+        }
+
+        // Sparse operators
+
+        template <typename T, typename Allocator>
+        Vector<T> operator*(
+            const SparseMatrix<T>& matrix,
+            const Vector<T, Allocator>& vector
+        ) {
+            if (matrix.cols() != vector.size()) {
+                throw std::invalid_argument(
+                    "sparse::operator*: Incompatible dimensions for sparse matrix-vector multiplication"
+                );
+            }
+
+            Vector<T> result(matrix.rows(), core::uninitialized);
+
+            spmv(T(1), matrix, vector.view(), T(0), result.view());
+
+            return result;
+        }
+
+        template <typename T, typename Allocator, typename Layout>
+        Matrix<T> operator*(
+            const SparseMatrix<T>& matrix,
+            const Matrix<T, Allocator, Layout>& dense
+        ) {
+            if (matrix.cols() != dense.rows()) {
+                throw std::invalid_argument(
+                    "sparse::operator*: Incompatible dimensions for sparse matrix multiplication"
+                );
+            }
+
+            Matrix<T> result(matrix.rows(), dense.cols(), core::uninitialized);
+
+            VMAFU_IF_CONSTEXPR (VMAFU_IS_SAME_V(Layout, core::RowMajor)) {
+                spmm(T(1), matrix, dense.view(), T(0), result.view());
+            } else {
+                Matrix<T> row_major(dense);
+
+                spmm(T(1), matrix, row_major.view(), T(0), result.view());
+            }
+
+            return result;
+        }
+
+        template <typename T>
+        SparseMatrix<T> operator+(
+            const SparseMatrix<T>& lhs,
+            const SparseMatrix<T>& rhs
+        ) {
+            if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
+                throw std::invalid_argument(
+                    "sparse::operator+: Matrix dimensions must match"
+                );
+            }
+
+            return internal::merge(lhs, rhs, std::plus<T>());
+        }
+
+        template <typename T>
+        SparseMatrix<T> operator-(
+            const SparseMatrix<T>& lhs,
+            const SparseMatrix<T>& rhs
+        ) {
+            if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
+                throw std::invalid_argument(
+                    "sparse::operator-: Matrix dimensions must match"
+                );
+            }
+
+            return internal::merge(lhs, rhs, std::minus<T>());
+        }
+
+        template <typename T>
+        SparseMatrix<T> operator-(const SparseMatrix<T>& matrix) {
+            return matrix * T(-1);
+        }
+
+        template <typename T>
+        SparseMatrix<T> operator*(
+            const SparseMatrix<T>& matrix,
+            const typename SparseMatrix<T>::value_type& scalar
+        ) {
+            SparseMatrix<T> result(matrix);
+            result *= scalar;
+
+            return result;
+        }
+
+        template <typename T>
+        SparseMatrix<T> operator*(
+            const typename SparseMatrix<T>::value_type& scalar,
+            const SparseMatrix<T>& matrix
+        ) {
+            return matrix * scalar;
+        }
+    }
+}
@@ -5,6 +5,9 @@
 
 
 #include "_operations.hpp"
+#include "_linear_operator.hpp"
+#include "_lu.hpp"
+#include "_determinants.hpp"
 
 
 #include "_linalg.hpp"
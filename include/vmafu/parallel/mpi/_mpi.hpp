@@ -15,6 +15,7 @@
 #include "distribution/_distribution.hpp"
 #include "containers/_VectorMPI.hpp"
 #include "containers/_MatrixMPI.hpp"
+#include "fileio/_fileio.hpp"
 #include "utils/_timing.hpp"
 
 
@@ -37,6 +38,18 @@ namespace vmafu {
                 const communication::Communicator& comm = communication::world()
             );
 
+            // Reads through the given format, e.g. CsvFormat::create(';',
+            // true, true) for a ';'-delimited CSV with a header row
+
+            template <typename T>
+            containers::MatrixMPI<T> load_matrix(
+                const std::string& filename,
+                const vmafu::io::FormatPtr& format,
+                distribution::MatrixDistributionType dist_type = distribution::MatrixDistributionType::BLOCK_ROWS,
+                int root = 0,
+                const communication::Communicator& comm = communication::world()
+            );
+
             template <typename T>
             void save_vector(
                 const std::string& filename,
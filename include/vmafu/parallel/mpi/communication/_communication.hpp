@@ -122,6 +122,25 @@ namespace vmafu {
                             int tag = MPI_ANY_TAG
                         ) const;
 
+                        // Non-blocking P-to-P MPI methods ( buffers must stay
+                        // alive until the request completes )
+
+                        template <typename T>
+                        MPI_Request isend(
+                            const T* data,
+                            int count,
+                            int dest,
+                            int tag = 0
+                        ) const;
+
+                        template <typename T>
+                        MPI_Request irecv(
+                            T* data,
+                            int count,
+                            int source = MPI_ANY_SOURCE,
+                            int tag = MPI_ANY_TAG
+                        ) const;
+
                         // Collective MPI methods
 
                         void barrier() const;
@@ -155,6 +174,28 @@ namespace vmafu {
                             MPI_Op op
                         ) const;
 
+                        // Non-blocking allreduce ( both buffers must stay
+                        // alive until the request completes )
+
+                        template <typename T>
+                        MPI_Request iallreduce(
+                            const T* sendbuf,
+                            T* recvbuf,
+                            int count,
+                            MPI_Op op
+                        ) const;
+
+                        template <typename T>
+                        T exscan(T value, MPI_Op op) const;
+
+                        template <typename T>
+                        void exscan(
+                            const T* sendbuf,
+                            T* recvbuf,
+                            int count,
+                            MPI_Op op
+                        ) const;
+
                         template <typename T>
                         void allgather(
                             const T* sendbuf,
@@ -171,6 +212,23 @@ namespace vmafu {
                             const int* displs
                         ) const;
 
+                        template <typename T>
+                        void alltoall(
+                            const T* sendbuf,
+                            T* recvbuf,
+                            int count
+                        ) const;
+
+                        template <typename T>
+                        void alltoallv(
+                            const T* sendbuf,
+                            const int* sendcounts,
+                            const int* sdispls,
+                            T* recvbuf,
+                            const int* recvcounts,
+                            const int* rdispls
+                        ) const;
+
                         // Distribution methods
 
                         template <typename T>
@@ -219,6 +277,9 @@ namespace vmafu {
                         template <typename T>
                         static MPI_Datatype mpi_type();
 
+                        static void wait(MPI_Request& request);
+                        static void wait_all(std::vector<MPI_Request>& requests);
+
                         static Communicator duplicate(
                             const Communicator& other
                         );
@@ -234,6 +234,56 @@ namespace vmafu {
                     return value;
                 }
 
+                // Non-blocking P-to-P MPI methods
+
+                template <typename T>
+                MPI_Request Communicator::isend(
+                    const T* data,
+                    int count,
+                    int dest,
+                    int tag
+                ) const {
+                    MPI_Request request = MPI_REQUEST_NULL;
+
+                    if (is_valid()) {
+                        MPI_Isend(
+                            data,
+                            count,
+                            mpi_type<T>(),
+                            dest,
+                            tag,
+                            _comm,
+                            &request
+                        );
+                    }
+
+                    return request;
+                }
+
+                template <typename T>
+                MPI_Request Communicator::irecv(
+                    T* data,
+                    int count,
+                    int source,
+                    int tag
+                ) const {
+                    MPI_Request request = MPI_REQUEST_NULL;
+
+                    if (is_valid()) {
+                        MPI_Irecv(
+                            data,
+                            count,
+                            mpi_type<T>(),
+                            source,
+                            tag,
+                            _comm,
+                            &request
+                        );
+                    }
+
+                    return request;
+                }
+
                 // Collective MPI methods
 
                 void Communicator::barrier() const {
@@ -339,6 +389,77 @@ namespace vmafu {
                     }
                 }
 
+                template <typename T>
+                MPI_Request Communicator::iallreduce(
+                    const T* sendbuf,
+                    T* recvbuf,
+                    int count,
+                    MPI_Op op
+                ) const {
+                    MPI_Request request = MPI_REQUEST_NULL;
+
+                    if (is_valid()) {
+                        MPI_Iallreduce(
+                            sendbuf,
+                            recvbuf,
+                            count,
+                            mpi_type<T>(),
+                            op,
+                            _comm,
+                            &request
+                        );
+                    }
+
+                    return request;
+                }
+
+                template <typename T>
+                T Communicator::exscan(T value, MPI_Op op) const {
+                    T result = T();
+
+                    if (is_valid()) {
+                        MPI_Exscan(
+                            &value,
+                            &result,
+                            1,
+                            mpi_type<T>(),
+                            op,
+                            _comm
+                        );
+
+                        if (_rank == 0) {
+                            result = T();
+                        }
+                    }
+
+                    return result;
+                }
+
+                template <typename T>
+                void Communicator::exscan(
+                    const T* sendbuf,
+                    T* recvbuf,
+                    int count,
+                    MPI_Op op
+                ) const {
+                    if (is_valid()) {
+                        MPI_Exscan(
+                            sendbuf,
+                            recvbuf,
+                            count,
+                            mpi_type<T>(),
+                            op,
+                            _comm
+                        );
+
+                        if (_rank == 0) {
+                            for (int i = 0; i < count; i++) {
+                                recvbuf[i] = T();
+                            }
+                        }
+                    }
+                }
+
                 template <typename T>
                 void Communicator::allgather(
                     const T* sendbuf,
@@ -380,6 +501,49 @@ namespace vmafu {
                     }
                 }
 
+                template <typename T>
+                void Communicator::alltoall(
+                    const T* sendbuf,
+                    T* recvbuf,
+                    int count
+                ) const {
+                    if (is_valid()) {
+                        MPI_Alltoall(
+                            sendbuf,
+                            count,
+                            mpi_type<T>(),
+                            recvbuf,
+                            count,
+                            mpi_type<T>(),
+                            _comm
+                        );
+                    }
+                }
+
+                template <typename T>
+                void Communicator::alltoallv(
+                    const T* sendbuf,
+                    const int* sendcounts,
+                    const int* sdispls,
+                    T* recvbuf,
+                    const int* recvcounts,
+                    const int* rdispls
+                ) const {
+                    if (is_valid()) {
+                        MPI_Alltoallv(
+                            sendbuf,
+                            sendcounts,
+                            sdispls,
+                            mpi_type<T>(),
+                            recvbuf,
+                            recvcounts,
+                            rdispls,
+                            mpi_type<T>(),
+                            _comm
+                        );
+                    }
+                }
+
                 // Distribution methods
 
                 template <typename T>
@@ -544,6 +708,22 @@ namespace vmafu {
                     }
                 }
 
+                void Communicator::wait(MPI_Request& request) {
+                    if (request != MPI_REQUEST_NULL) {
+                        MPI_Wait(&request, MPI_STATUS_IGNORE);
+                    }
+                }
+
+                void Communicator::wait_all(std::vector<MPI_Request>& requests) {
+                    if (!requests.empty()) {
+                        MPI_Waitall(
+                            static_cast<int>(requests.size()),
+                            requests.data(),
+                            MPI_STATUSES_IGNORE
+                        );
+                    }
+                }
+
                 Communicator Communicator::duplicate(
                     const Communicator& other
                 ) {
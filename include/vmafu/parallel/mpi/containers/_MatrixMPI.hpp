@@ -5,8 +5,10 @@
 
 
 #include <string>
+#include <cstdint>
 
 #include "../../../core/_Matrix.hpp"
+#include "../../../utils/_random.hpp"
 
 #include "../communication/communication.hpp"
 #include "../distribution/distribution.hpp"
@@ -42,6 +44,10 @@ namespace vmafu {
                         );
 
                     public:
+                        // Types
+
+                        using value_type = T;
+
                         // Constructors
 
                         MatrixMPI();
@@ -56,6 +62,7 @@ namespace vmafu {
 
                         // Getters
 
+                        vmafu::core::Matrix<T>& local_matrix() noexcept;
                         const vmafu::core::Matrix<T>& local_matrix() const noexcept;
                         const distribution::MatrixDistributionInfo& distribution_info() const noexcept;
                         const communication::Communicator& communicator() const noexcept;
@@ -71,12 +78,42 @@ namespace vmafu {
                         void set_local_matrix(
                             const vmafu::core::Matrix<T>& matrix
                         );
+                        void set_local_matrix(
+                            vmafu::core::Matrix<T>&& matrix
+                        );
                         void set_dist_info(
                             const distribution::MatrixDistributionInfo& dist_info
                         );
                         void set_comm(
                             const communication::Communicator& comm
                         );
+
+                        // Static methods ( local generation, no scatter )
+
+                        // Each rank evaluates func( i, j ) for its own block
+                        // only; i, j are global indices, as in
+                        // Matrix::from_function
+
+                        template <typename Func>
+                        static MatrixMPI from_function(
+                            size_t rows,
+                            size_t cols,
+                            const Func& func,
+                            distribution::MatrixDistributionType dist_type = distribution::MatrixDistributionType::BLOCK_ROWS,
+                            const communication::Communicator& comm = communication::world()
+                        );
+
+                        // Uniform [0, 1) elements from a Philox4x32 stream
+                        // indexed by the global element index, so the result
+                        // is identical for any number of ranks
+
+                        static MatrixMPI random(
+                            size_t rows,
+                            size_t cols,
+                            std::uint64_t seed,
+                            distribution::MatrixDistributionType dist_type = distribution::MatrixDistributionType::BLOCK_ROWS,
+                            const communication::Communicator& comm = communication::world()
+                        );
                 };
             }
         }
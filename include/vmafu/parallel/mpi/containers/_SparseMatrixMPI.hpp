@@ -0,0 +1,144 @@
+// parallel/mpi/containers/_SparseMatrixMPI.hpp
+
+
+#pragma once
+
+
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+
+#include "../../../core/_Vector.hpp"
+#include "../../../core/_SparseMatrix.hpp"
+#include "../../../linalg/_sparse.hpp"
+
+#include "../communication/communication.hpp"
+#include "../distribution/distribution.hpp"
+
+#include "_VectorMPI.hpp"
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace containers {
+                // Row-block distributed CSR matrix. x is distributed in
+                // BLOCK over the columns; the x entries each rank needs from
+                // its neighbours ( the halo ) are found once at setup, so a
+                // product only moves those entries
+
+                template <typename T>
+                class SparseMatrixMPI {
+                    private:
+                        vmafu::core::SparseMatrix<T> _local_matrix;
+                        distribution::VectorDistributionInfo _dist_info;
+                        distribution::VectorDistributionInfo _col_info;
+                        communication::Communicator _comm;
+
+                        // Local rows split by column ownership: _diagonal
+                        // reads the owned part of x ( local indices ),
+                        // _off_diagonal reads the halo ( compact indices )
+
+                        vmafu::core::SparseMatrix<T> _diagonal;
+                        vmafu::core::SparseMatrix<T> _off_diagonal;
+
+                        // Halo exchange pattern
+
+                        std::vector<size_t> _halo_columns;
+
+                        std::vector<int> _recv_ranks;
+                        std::vector<int> _recv_counts;
+                        std::vector<int> _recv_displs;
+
+                        std::vector<int> _send_ranks;
+                        std::vector<int> _send_counts;
+                        std::vector<int> _send_displs;
+                        std::vector<size_t> _send_indices;
+
+                        mutable std::vector<T> _send_buffer;
+                        mutable std::vector<T> _halo_buffer;
+
+                        // One request per neighbour, reused by every product
+
+                        mutable std::vector<MPI_Request> _requests;
+
+                        // Helper method
+
+                        void _setup();
+
+                    public:
+                        // Constants
+
+                        static constexpr int HALO_TAG = 46;
+
+                        // Constructors
+
+                        SparseMatrixMPI();
+                        SparseMatrixMPI(const communication::Communicator& comm);
+
+                        SparseMatrixMPI(
+                            const vmafu::core::SparseMatrix<T>& global_matrix,
+                            distribution::VectorDistributionInfo row_info,
+                            int root = 0,
+                            const communication::Communicator& comm = communication::world()
+                        );
+
+                        // Getters
+
+                        const vmafu::core::SparseMatrix<T>& local_matrix() const noexcept;
+                        const distribution::VectorDistributionInfo& distribution_info() const noexcept;
+                        const distribution::VectorDistributionInfo& column_info() const noexcept;
+                        const communication::Communicator& communicator() const noexcept;
+
+                        size_t local_rows() const noexcept;
+
+                        size_t global_rows() const noexcept;
+                        size_t global_cols() const noexcept;
+
+                        size_t local_nnz() const noexcept;
+                        size_t halo_size() const noexcept;
+
+                        // Product methods
+
+                        // y = A * x; the halo exchange is in flight while the
+                        // diagonal block is multiplied
+
+                        void multiply(
+                            const VectorMPI<T>& x,
+                            VectorMPI<T>& y
+                        ) const;
+
+                        VectorMPI<T> multiply(const VectorMPI<T>& x) const;
+
+                        // y = A^T x, x in the row distribution, y in the
+                        // column distribution; the halo exchange runs in
+                        // reverse and is in flight while the diagonal block
+                        // is applied
+
+                        void multiply_transpose(
+                            const VectorMPI<T>& x,
+                            VectorMPI<T>& y
+                        ) const;
+
+                        VectorMPI<T> multiply_transpose(const VectorMPI<T>& x) const;
+
+                        // Static methods
+
+                        // Rows [row_info.offset, row_info.offset +
+                        // row_info.local_size) with global column indices,
+                        // e.g. from fileio::read_sparse_rows
+
+                        static SparseMatrixMPI from_local(
+                            vmafu::core::SparseMatrix<T> local_matrix,
+                            const distribution::VectorDistributionInfo& row_info,
+                            const communication::Communicator& comm = communication::world()
+                        );
+                };
+            }
+        }
+    }
+}
+
+
+#include "detail/_SparseMatrixMPI.ipp"
@@ -5,8 +5,10 @@
 
 
 #include <string>
+#include <cstdint>
 
 #include "../../../core/_Vector.hpp"
+#include "../../../utils/_random.hpp"
 
 #include "../communication/communication.hpp"
 #include "../distribution/distribution.hpp"
@@ -42,6 +44,10 @@ namespace vmafu {
                         );
 
                     public:
+                        // Types
+
+                        using value_type = T;
+
                         // Constructors
 
                         VectorMPI();
@@ -56,6 +62,7 @@ namespace vmafu {
 
                         // Getters
 
+                        vmafu::core::Vector<T>& local_vector() noexcept;
                         const vmafu::core::Vector<T>& local_vector() const noexcept;
                         const distribution::VectorDistributionInfo& distribution_info() const noexcept;
                         const communication::Communicator& communicator() const noexcept;
@@ -68,12 +75,32 @@ namespace vmafu {
                         void set_local_vector(
                             const vmafu::core::Vector<T>& vector
                         );
+                        void set_local_vector(
+                            vmafu::core::Vector<T>&& vector
+                        );
                         void set_dist_info(
                             const distribution::VectorDistributionInfo& dist_info
                         );
                         void set_comm(
                             const communication::Communicator& comm
                         );
+
+                        // Static methods ( local generation, no scatter )
+
+                        template <typename Func>
+                        static VectorMPI from_function(
+                            size_t size,
+                            const Func& func,
+                            distribution::VectorDistributionType dist_type = distribution::VectorDistributionType::BLOCK,
+                            const communication::Communicator& comm = communication::world()
+                        );
+
+                        static VectorMPI random(
+                            size_t size,
+                            std::uint64_t seed,
+                            distribution::VectorDistributionType dist_type = distribution::VectorDistributionType::BLOCK,
+                            const communication::Communicator& comm = communication::world()
+                        );
                 };
             }
         }
@@ -6,3 +6,4 @@
 
 #include "_VectorMPI.hpp"
 #include "_MatrixMPI.hpp"
+#include "_SparseMatrixMPI.hpp"
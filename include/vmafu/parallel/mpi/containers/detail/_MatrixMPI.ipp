@@ -45,6 +45,11 @@ namespace vmafu {
 
                 // Getters
 
+                template <typename T>
+                vmafu::core::Matrix<T>& MatrixMPI<T>::local_matrix() noexcept {
+                    return _local_matrix;
+                }
+
                 template <typename T>
                 const vmafu::core::Matrix<T>& MatrixMPI<T>::local_matrix() const noexcept {
                     return _local_matrix;
@@ -89,6 +94,13 @@ namespace vmafu {
                     _local_matrix = matrix;
                 }
 
+                template <typename T>
+                void MatrixMPI<T>::set_local_matrix(
+                    vmafu::core::Matrix<T>&& matrix
+                ) {
+                    _local_matrix = std::move(matrix);
+                }
+
                 template <typename T>
                 void MatrixMPI<T>::set_dist_info(
                     const distribution::MatrixDistributionInfo& dist_info
@@ -102,6 +114,80 @@ namespace vmafu {
                 ) {
                     _comm = comm;
                 }
+
+                // Static methods
+
+                template <typename T>
+                template <typename Func>
+                MatrixMPI<T> MatrixMPI<T>::from_function(
+                    size_t rows,
+                    size_t cols,
+                    const Func& func,
+                    distribution::MatrixDistributionType dist_type,
+                    const communication::Communicator& comm
+                ) {
+                    MatrixMPI result(comm);
+
+                    result._dist_info = distribution::matrix_distribution_info(
+                        dist_type, rows, cols, comm
+                    );
+                    result._local_matrix = vmafu::core::Matrix<T>(
+                        result._dist_info.local_rows,
+                        result._dist_info.local_cols,
+                        vmafu::core::uninitialized
+                    );
+
+                    const distribution::MatrixDistributionInfo& info = result._dist_info;
+
+                    for (size_t i = 0; i < info.local_rows; i++) {
+                        const T x = static_cast<T>(info.row_offset + i);
+
+                        for (size_t j = 0; j < info.local_cols; j++) {
+                            result._local_matrix(i, j) = func(
+                                x, static_cast<T>(info.col_offset + j)
+                            );
+                        }
+                    }
+
+                    return result;
+                }
+
+                template <typename T>
+                MatrixMPI<T> MatrixMPI<T>::random(
+                    size_t rows,
+                    size_t cols,
+                    std::uint64_t seed,
+                    distribution::MatrixDistributionType dist_type,
+                    const communication::Communicator& comm
+                ) {
+                    MatrixMPI result(comm);
+
+                    result._dist_info = distribution::matrix_distribution_info(
+                        dist_type, rows, cols, comm
+                    );
+                    result._local_matrix = vmafu::core::Matrix<T>(
+                        result._dist_info.local_rows,
+                        result._dist_info.local_cols,
+                        vmafu::core::uninitialized
+                    );
+
+                    const distribution::MatrixDistributionInfo& info = result._dist_info;
+                    const vmafu::utils::Philox4x32 generator(seed);
+
+                    for (size_t i = 0; i < info.local_rows; i++) {
+                        std::uint64_t row_index = static_cast<std::uint64_t>(
+                            info.row_offset + i
+                        ) * cols + info.col_offset;
+
+                        for (size_t j = 0; j < info.local_cols; j++) {
+                            result._local_matrix(i, j) = generator.uniform<T>(
+                                row_index + j
+                            );
+                        }
+                    }
+
+                    return result;
+                }
             }
         }
     }
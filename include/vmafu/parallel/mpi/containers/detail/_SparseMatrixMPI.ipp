@@ -0,0 +1,584 @@
+// parallel/mpi/containers/detail/_SparseMatrixMPI.ipp
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace containers {
+                // Helper method
+
+                template <typename T>
+                void SparseMatrixMPI<T>::_setup() {
+                    int comm_size = _comm.size();
+
+                    size_t rows = _local_matrix.rows();
+                    size_t cols = _local_matrix.cols();
+
+                    _col_info = distribution::vector_distribution_info(
+                        distribution::VectorDistributionType::BLOCK, cols, _comm
+                    );
+
+                    std::vector<size_t> col_offsets(comm_size + 1);
+
+                    _comm.allgather(&_col_info.offset, col_offsets.data(), 1);
+                    col_offsets[comm_size] = cols;
+
+                    size_t first = _col_info.offset;
+                    size_t last = first + _col_info.local_size;
+
+                    const std::vector<size_t>& row_ptr = _local_matrix.row_ptr();
+                    const std::vector<size_t>& col_indices = _local_matrix.col_indices();
+                    const std::vector<T>& values = _local_matrix.values();
+
+                    // Halo columns: sorted unique remote columns, which also
+                    // groups them by owner rank
+
+                    _halo_columns.clear();
+
+                    for (size_t col : col_indices) {
+                        if (col < first || col >= last) {
+                            _halo_columns.push_back(col);
+                        }
+                    }
+
+                    std::sort(_halo_columns.begin(), _halo_columns.end());
+                    _halo_columns.erase(
+                        std::unique(_halo_columns.begin(), _halo_columns.end()),
+                        _halo_columns.end()
+                    );
+
+                    // Split the local rows into the diagonal and halo blocks
+
+                    std::vector<size_t> diagonal_ptr(rows + 1, 0);
+                    std::vector<size_t> diagonal_cols;
+                    std::vector<T> diagonal_values;
+
+                    std::vector<size_t> halo_ptr(rows + 1, 0);
+                    std::vector<size_t> halo_cols;
+                    std::vector<T> halo_values;
+
+                    for (size_t i = 0; i < rows; i++) {
+                        for (size_t k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+                            size_t col = col_indices[k];
+
+                            if (col >= first && col < last) {
+                                diagonal_cols.push_back(col - first);
+                                diagonal_values.push_back(values[k]);
+                            } else {
+                                halo_cols.push_back(static_cast<size_t>(
+                                    std::lower_bound(
+                                        _halo_columns.begin(), _halo_columns.end(), col
+                                    ) - _halo_columns.begin()
+                                ));
+                                halo_values.push_back(values[k]);
+                            }
+                        }
+
+                        diagonal_ptr[i + 1] = diagonal_values.size();
+                        halo_ptr[i + 1] = halo_values.size();
+                    }
+
+                    _diagonal = vmafu::core::SparseMatrix<T>(
+                        rows, _col_info.local_size,
+                        std::move(diagonal_ptr),
+                        std::move(diagonal_cols),
+                        std::move(diagonal_values)
+                    );
+                    _off_diagonal = vmafu::core::SparseMatrix<T>(
+                        rows, _halo_columns.size(),
+                        std::move(halo_ptr),
+                        std::move(halo_cols),
+                        std::move(halo_values)
+                    );
+
+                    // Receive pattern: how many halo entries come from
+                    // each owner
+
+                    std::vector<int> request_counts(comm_size, 0);
+
+                    for (size_t col : _halo_columns) {
+                        int owner = static_cast<int>(
+                            std::upper_bound(
+                                col_offsets.begin(), col_offsets.end(), col
+                            ) - col_offsets.begin()
+                        ) - 1;
+
+                        request_counts[owner]++;
+                    }
+
+                    // Send pattern: every owner learns which of its entries
+                    // are requested ( one-time all-to-all at setup )
+
+                    std::vector<int> provide_counts(comm_size);
+
+                    _comm.alltoall(request_counts.data(), provide_counts.data(), 1);
+
+                    // Counts and displacements are int: check both sides of
+                    // the exchange before building them
+
+                    size_t provide_total = 0;
+
+                    for (int count : provide_counts) {
+                        provide_total += static_cast<size_t>(count);
+                    }
+
+                    int too_large = (
+                        _halo_columns.size() > INT_MAX || provide_total > INT_MAX
+                    ) ? 1 : 0;
+
+                    if (_comm.allreduce(too_large, MPI_MAX) != 0) {
+                        throw std::invalid_argument(
+                            "SparseMatrixMPI::_setup(): Halo exchange exceeds MPI count limits"
+                        );
+                    }
+
+                    std::vector<int> request_displs(comm_size, 0);
+                    std::vector<int> provide_displs(comm_size, 0);
+
+                    for (int r = 1; r < comm_size; r++) {
+                        request_displs[r] = request_displs[r - 1] + request_counts[r - 1];
+                        provide_displs[r] = provide_displs[r - 1] + provide_counts[r - 1];
+                    }
+
+                    size_t provided = static_cast<size_t>(
+                        provide_displs[comm_size - 1] + provide_counts[comm_size - 1]
+                    );
+
+                    _send_indices.assign(provided, 0);
+
+                    _comm.alltoallv(
+                        _halo_columns.data(), request_counts.data(), request_displs.data(),
+                        _send_indices.data(), provide_counts.data(), provide_displs.data()
+                    );
+
+                    for (size_t& index : _send_indices) {
+                        index -= first;
+                    }
+
+                    _recv_ranks.clear();
+                    _recv_counts.clear();
+                    _recv_displs.clear();
+
+                    _send_ranks.clear();
+                    _send_counts.clear();
+                    _send_displs.clear();
+
+                    for (int r = 0; r < comm_size; r++) {
+                        if (request_counts[r] > 0) {
+                            _recv_ranks.push_back(r);
+                            _recv_counts.push_back(request_counts[r]);
+                            _recv_displs.push_back(request_displs[r]);
+                        }
+
+                        if (provide_counts[r] > 0) {
+                            _send_ranks.push_back(r);
+                            _send_counts.push_back(provide_counts[r]);
+                            _send_displs.push_back(provide_displs[r]);
+                        }
+                    }
+
+                    _send_buffer.assign(provided, T());
+                    _halo_buffer.assign(_halo_columns.size(), T());
+
+                    _requests.assign(
+                        _recv_ranks.size() + _send_ranks.size(), MPI_REQUEST_NULL
+                    );
+                }
+
+                // Constructors
+
+                template <typename T>
+                SparseMatrixMPI<T>::SparseMatrixMPI() : _comm(communication::world()) {}
+
+                template <typename T>
+                SparseMatrixMPI<T>::SparseMatrixMPI(
+                    const communication::Communicator& comm
+                ) : _comm(comm) {}
+
+                template <typename T>
+                SparseMatrixMPI<T>::SparseMatrixMPI(
+                    const vmafu::core::SparseMatrix<T>& global_matrix,
+                    distribution::VectorDistributionInfo row_info,
+                    int root,
+                    const communication::Communicator& comm
+                ) : _dist_info(row_info), _comm(comm) {
+                    int comm_size = _comm.size();
+
+                    // Shape and nnz are known on the root only; every rank
+                    // checks its own distribution against them
+
+                    unsigned long long shape[3] = {0, 0, 0};
+
+                    if (_comm.rank() == root) {
+                        shape[0] = global_matrix.nnz();
+                        shape[1] = global_matrix.rows();
+                        shape[2] = global_matrix.cols();
+                    }
+
+                    _comm.broadcast(shape, 3, root);
+
+                    std::vector<size_t> offsets(comm_size);
+                    std::vector<size_t> sizes(comm_size);
+
+                    _comm.allgather(&_dist_info.offset, offsets.data(), 1);
+                    _comm.allgather(&_dist_info.local_size, sizes.data(), 1);
+
+                    int mismatch = _dist_info.global_size != shape[1] ? 1 : 0;
+
+                    for (int r = 0; r < comm_size; r++) {
+                        if (offsets[r] + sizes[r] > shape[1]) {
+                            mismatch = 1;
+                        }
+                    }
+
+                    if (_comm.allreduce(mismatch, MPI_MAX) != 0) {
+                        throw std::invalid_argument(
+                            "SparseMatrixMPI::SparseMatrixMPI(): Global matrix dimensions do not match distribution"
+                        );
+                    }
+
+                    // Row and nnz counts / displacements go through int
+
+                    if (shape[1] >= INT_MAX || shape[0] > INT_MAX) {
+                        throw std::invalid_argument(
+                            "SparseMatrixMPI::SparseMatrixMPI(): Matrix exceeds MPI count limits"
+                        );
+                    }
+
+                    std::vector<int> row_counts(comm_size);
+                    std::vector<int> row_displs(comm_size);
+                    std::vector<int> nnz_counts(comm_size, 0);
+                    std::vector<int> nnz_displs(comm_size, 0);
+
+                    for (int r = 0; r < comm_size; r++) {
+                        row_counts[r] = static_cast<int>(sizes[r]);
+                        row_displs[r] = static_cast<int>(offsets[r]);
+                    }
+
+                    if (_comm.rank() == root) {
+                        const std::vector<size_t>& row_ptr = global_matrix.row_ptr();
+
+                        for (int r = 0; r < comm_size; r++) {
+                            nnz_displs[r] = static_cast<int>(row_ptr[offsets[r]]);
+                            nnz_counts[r] = static_cast<int>(
+                                row_ptr[offsets[r] + sizes[r]] - row_ptr[offsets[r]]
+                            );
+                        }
+                    }
+
+                    int local_nnz = 0;
+
+                    _comm.scatter(nnz_counts.data(), &local_nnz, 1, root);
+
+                    size_t local_rows = _dist_info.local_size;
+
+                    std::vector<size_t> row_ptr(local_rows + 1, 0);
+                    std::vector<size_t> col_indices(static_cast<size_t>(local_nnz));
+                    std::vector<T> values(static_cast<size_t>(local_nnz));
+
+                    _comm.scatterv(
+                        global_matrix.row_ptr().data(), row_counts.data(), row_displs.data(),
+                        row_ptr.data(), static_cast<int>(local_rows), root
+                    );
+                    _comm.scatterv(
+                        global_matrix.col_indices().data(), nnz_counts.data(), nnz_displs.data(),
+                        col_indices.data(), local_nnz, root
+                    );
+                    _comm.scatterv(
+                        global_matrix.values().data(), nnz_counts.data(), nnz_displs.data(),
+                        values.data(), local_nnz, root
+                    );
+
+                    // Rebase the received row_ptr slice to start at zero
+
+                    size_t base = local_rows > 0 ? row_ptr[0] : 0;
+
+                    for (size_t i = 0; i < local_rows; i++) {
+                        row_ptr[i] -= base;
+                    }
+
+                    row_ptr[local_rows] = static_cast<size_t>(local_nnz);
+
+                    _local_matrix = vmafu::core::SparseMatrix<T>(
+                        local_rows, static_cast<size_t>(shape[2]),
+                        std::move(row_ptr),
+                        std::move(col_indices),
+                        std::move(values)
+                    );
+
+                    _setup();
+                }
+
+                // Getters
+
+                template <typename T>
+                const vmafu::core::SparseMatrix<T>& SparseMatrixMPI<T>::local_matrix() const noexcept {
+                    return _local_matrix;
+                }
+
+                template <typename T>
+                const distribution::VectorDistributionInfo& SparseMatrixMPI<T>::distribution_info() const noexcept {
+                    return _dist_info;
+                }
+
+                template <typename T>
+                const distribution::VectorDistributionInfo& SparseMatrixMPI<T>::column_info() const noexcept {
+                    return _col_info;
+                }
+
+                template <typename T>
+                const communication::Communicator& SparseMatrixMPI<T>::communicator() const noexcept {
+                    return _comm;
+                }
+
+                template <typename T>
+                size_t SparseMatrixMPI<T>::local_rows() const noexcept {
+                    return _local_matrix.rows();
+                }
+
+                template <typename T>
+                size_t SparseMatrixMPI<T>::global_rows() const noexcept {
+                    return _dist_info.global_size;
+                }
+
+                template <typename T>
+                size_t SparseMatrixMPI<T>::global_cols() const noexcept {
+                    return _col_info.global_size;
+                }
+
+                template <typename T>
+                size_t SparseMatrixMPI<T>::local_nnz() const noexcept {
+                    return _local_matrix.nnz();
+                }
+
+                template <typename T>
+                size_t SparseMatrixMPI<T>::halo_size() const noexcept {
+                    return _halo_columns.size();
+                }
+
+                // Product methods
+
+                template <typename T>
+                void SparseMatrixMPI<T>::multiply(
+                    const VectorMPI<T>& x,
+                    VectorMPI<T>& y
+                ) const {
+                    if (&x == &y) {
+                        throw std::invalid_argument(
+                            "SparseMatrixMPI::multiply(): Output must not alias the input"
+                        );
+                    }
+
+                    if (
+                        x.global_size() != _col_info.global_size || \
+                        x.local_size() != _col_info.local_size
+                    ) {
+                        throw std::invalid_argument(
+                            "SparseMatrixMPI::multiply(): Vector distribution does not match matrix columns"
+                        );
+                    }
+
+                    if (
+                        y.global_size() != _dist_info.global_size || \
+                        y.local_size() != _dist_info.local_size
+                    ) {
+                        y.set_comm(_comm);
+                        y.set_dist_info(_dist_info);
+                        y.set_local_vector(vmafu::core::Vector<T>(
+                            _dist_info.local_size, vmafu::core::uninitialized
+                        ));
+                    }
+
+                    // Post the halo receives, pack and send the requested
+                    // owned entries, then multiply the diagonal block while
+                    // the messages are in flight
+
+                    size_t request = 0;
+
+                    for (size_t n = 0; n < _recv_ranks.size(); n++) {
+                        _requests[request++] = _comm.irecv(
+                            _halo_buffer.data() + _recv_displs[n],
+                            _recv_counts[n], _recv_ranks[n], HALO_TAG
+                        );
+                    }
+
+                    const T* x_local = x.local_vector().data();
+
+                    for (size_t k = 0; k < _send_indices.size(); k++) {
+                        _send_buffer[k] = x_local[_send_indices[k]];
+                    }
+
+                    for (size_t n = 0; n < _send_ranks.size(); n++) {
+                        _requests[request++] = _comm.isend(
+                            _send_buffer.data() + _send_displs[n],
+                            _send_counts[n], _send_ranks[n], HALO_TAG
+                        );
+                    }
+
+                    // One thread per rank: ranks already occupy the cores
+
+                    vmafu::linalg::spmv(
+                        T(1), _diagonal, x.local_vector().view(),
+                        T(0), y.local_vector().view(), 1
+                    );
+
+                    communication::Communicator::wait_all(_requests);
+
+                    if (_off_diagonal.nnz() > 0) {
+                        vmafu::linalg::spmv(
+                            T(1), _off_diagonal,
+                            vmafu::core::ConstVectorView<T>(
+                                _halo_buffer.data(), _halo_buffer.size()
+                            ),
+                            T(1), y.local_vector().view(), 1
+                        );
+                    }
+                }
+
+                template <typename T>
+                VectorMPI<T> SparseMatrixMPI<T>::multiply(
+                    const VectorMPI<T>& x
+                ) const {
+                    VectorMPI<T> result(_comm);
+
+                    multiply(x, result);
+
+                    return result;
+                }
+
+                template <typename T>
+                void SparseMatrixMPI<T>::multiply_transpose(
+                    const VectorMPI<T>& x,
+                    VectorMPI<T>& y
+                ) const {
+                    if (&x == &y) {
+                        throw std::invalid_argument(
+                            "SparseMatrixMPI::multiply_transpose(): Output must not alias the input"
+                        );
+                    }
+
+                    if (
+                        x.global_size() != _dist_info.global_size || \
+                        x.local_size() != _dist_info.local_size
+                    ) {
+                        throw std::invalid_argument(
+                            "SparseMatrixMPI::multiply_transpose(): Vector distribution does not match matrix rows"
+                        );
+                    }
+
+                    if (
+                        y.global_size() != _col_info.global_size || \
+                        y.local_size() != _col_info.local_size
+                    ) {
+                        y.set_comm(_comm);
+                        y.set_dist_info(_col_info);
+                        y.set_local_vector(vmafu::core::Vector<T>(
+                            _col_info.local_size, vmafu::core::uninitialized
+                        ));
+                    }
+
+                    const T* x_local = x.local_vector().data();
+                    T* y_local = y.local_vector().data();
+
+                    // Contributions to halo columns go back to their owners:
+                    // the receive pattern of multiply() becomes the send
+                    // pattern and vice versa
+
+                    std::fill(_halo_buffer.begin(), _halo_buffer.end(), T(0));
+
+                    const std::vector<size_t>& off_row_ptr = _off_diagonal.row_ptr();
+                    const std::vector<size_t>& off_col_indices = _off_diagonal.col_indices();
+                    const std::vector<T>& off_values = _off_diagonal.values();
+
+                    for (size_t i = 0; i < _off_diagonal.rows(); i++) {
+                        for (size_t k = off_row_ptr[i]; k < off_row_ptr[i + 1]; k++) {
+                            _halo_buffer[off_col_indices[k]] += off_values[k] * x_local[i];
+                        }
+                    }
+
+                    size_t request = 0;
+
+                    for (size_t n = 0; n < _send_ranks.size(); n++) {
+                        _requests[request++] = _comm.irecv(
+                            _send_buffer.data() + _send_displs[n],
+                            _send_counts[n], _send_ranks[n], HALO_TAG
+                        );
+                    }
+
+                    for (size_t n = 0; n < _recv_ranks.size(); n++) {
+                        _requests[request++] = _comm.isend(
+                            _halo_buffer.data() + _recv_displs[n],
+                            _recv_counts[n], _recv_ranks[n], HALO_TAG
+                        );
+                    }
+
+                    std::fill(y_local, y_local + _col_info.local_size, T(0));
+
+                    const std::vector<size_t>& row_ptr = _diagonal.row_ptr();
+                    const std::vector<size_t>& col_indices = _diagonal.col_indices();
+                    const std::vector<T>& values = _diagonal.values();
+
+                    for (size_t i = 0; i < _diagonal.rows(); i++) {
+                        for (size_t k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+                            y_local[col_indices[k]] += values[k] * x_local[i];
+                        }
+                    }
+
+                    communication::Communicator::wait_all(_requests);
+
+                    for (size_t k = 0; k < _send_indices.size(); k++) {
+                        y_local[_send_indices[k]] += _send_buffer[k];
+                    }
+                }
+
+                template <typename T>
+                VectorMPI<T> SparseMatrixMPI<T>::multiply_transpose(
+                    const VectorMPI<T>& x
+                ) const {
+                    VectorMPI<T> result(_comm);
+
+                    multiply_transpose(x, result);
+
+                    return result;
+                }
+
+                // Static methods
+
+                template <typename T>
+                SparseMatrixMPI<T> SparseMatrixMPI<T>::from_local(
+                    vmafu::core::SparseMatrix<T> local_matrix,
+                    const distribution::VectorDistributionInfo& row_info,
+                    const communication::Communicator& comm
+                ) {
+                    // Checked collectively, so every rank throws together
+
+                    int bad_rows = local_matrix.rows() != row_info.local_size ? 1 : 0;
+
+                    if (comm.allreduce(bad_rows, MPI_MAX) != 0) {
+                        throw std::invalid_argument(
+                            "SparseMatrixMPI::from_local(): Local rows do not match distribution"
+                        );
+                    }
+
+                    size_t max_cols = comm.allreduce(local_matrix.cols(), MPI_MAX);
+                    size_t min_cols = comm.allreduce(local_matrix.cols(), MPI_MIN);
+
+                    if (max_cols != min_cols) {
+                        throw std::invalid_argument(
+                            "SparseMatrixMPI::from_local(): Column counts differ between ranks"
+                        );
+                    }
+
+                    SparseMatrixMPI result(comm);
+
+                    result._local_matrix = std::move(local_matrix);
+                    result._dist_info = row_info;
+
+                    result._setup();
+
+                    return result;
+                }
+            }
+        }
+    }
+}
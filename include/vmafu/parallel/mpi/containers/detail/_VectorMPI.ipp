@@ -42,6 +42,11 @@ namespace vmafu {
 
                 // Getters
 
+                template <typename T>
+                Vector<T>& VectorMPI<T>::local_vector() noexcept {
+                    return _local_vector;
+                }
+
                 template <typename T>
                 const Vector<T>& VectorMPI<T>::local_vector() const noexcept {
                     return _local_vector;
@@ -74,6 +79,13 @@ namespace vmafu {
                     _local_vector = vector;
                 }
 
+                template <typename T>
+                void VectorMPI<T>::set_local_vector(
+                    vmafu::core::Vector<T>&& vector
+                ) {
+                    _local_vector = std::move(vector);
+                }
+
                 template <typename T>
                 void VectorMPI<T>::set_dist_info(const distribution::VectorDistributionInfo& dist_info) {
                     _dist_info = dist_info;
@@ -83,6 +95,66 @@ namespace vmafu {
                 void VectorMPI<T>::set_comm(const communication::Communicator& comm) {
                     _comm = comm;
                 }
+
+                // Static methods
+
+                template <typename T>
+                template <typename Func>
+                VectorMPI<T> VectorMPI<T>::from_function(
+                    size_t size,
+                    const Func& func,
+                    distribution::VectorDistributionType dist_type,
+                    const communication::Communicator& comm
+                ) {
+                    VectorMPI result(comm);
+
+                    result._dist_info = distribution::vector_distribution_info(
+                        dist_type, size, comm
+                    );
+                    result._local_vector = vmafu::core::Vector<T>(
+                        result._dist_info.local_size,
+                        vmafu::core::uninitialized
+                    );
+
+                    const distribution::VectorDistributionInfo& info = result._dist_info;
+
+                    for (size_t i = 0; i < info.local_size; i++) {
+                        result._local_vector[i] = func(
+                            static_cast<T>(info.offset + i)
+                        );
+                    }
+
+                    return result;
+                }
+
+                template <typename T>
+                VectorMPI<T> VectorMPI<T>::random(
+                    size_t size,
+                    std::uint64_t seed,
+                    distribution::VectorDistributionType dist_type,
+                    const communication::Communicator& comm
+                ) {
+                    VectorMPI result(comm);
+
+                    result._dist_info = distribution::vector_distribution_info(
+                        dist_type, size, comm
+                    );
+                    result._local_vector = vmafu::core::Vector<T>(
+                        result._dist_info.local_size,
+                        vmafu::core::uninitialized
+                    );
+
+                    const distribution::VectorDistributionInfo& info = result._dist_info;
+                    const vmafu::utils::Philox4x32 generator(seed);
+
+                    for (size_t i = 0; i < info.local_size; i++) {
+                        result._local_vector[i] = generator.uniform<T>(
+                            info.offset + i
+                        );
+                    }
+
+                    return result;
+                }
             }
         }
     }
@@ -11,6 +11,26 @@ namespace vmafu {
                 int root,
                 const communication::Communicator& comm
             ) {
+                if (fileio::is_manifest(filename)) {
+                    return fileio::read_vector_sharded<T>(
+                        filename, dist_type, root, comm
+                    );
+                }
+
+                if (
+                    std::dynamic_pointer_cast<vmafu::io::formats::IBinaryFormat>(
+                        vmafu::io::create_format(filename)
+                    )
+                ) {
+                    return fileio::read_vector<T>(filename, dist_type, root, comm);
+                }
+
+                if (fileio::has_index(filename, root, comm)) {
+                    return fileio::read_vector_indexed<T>(
+                        filename, dist_type, root, comm
+                    );
+                }
+
                 vmafu::core::Vector<T> global_vector;
 
                 if (comm.rank() == root) {
@@ -40,26 +60,51 @@ namespace vmafu {
                 int root,
                 const communication::Communicator& comm
             ) {
-                vmafu::core::Matrix<T> global_matrix;
+                return load_matrix<T>(
+                    filename, vmafu::io::create_format(filename), dist_type, root, comm
+                );
+            }
 
-                if (comm.rank() == root) {
-                    global_matrix = io::load_matrix<T>(filename);
+            template <typename T>
+            containers::MatrixMPI<T> load_matrix(
+                const std::string& filename,
+                const vmafu::io::FormatPtr& format,
+                distribution::MatrixDistributionType dist_type,
+                int root,
+                const communication::Communicator& comm
+            ) {
+                auto csv = std::dynamic_pointer_cast<vmafu::io::formats::CsvFormat>(format);
+
+                if (csv) {
+                    return fileio::read_matrix_csv<T>(
+                        filename, dist_type,
+                        csv->parser().delimiter(), csv->parser().has_header(),
+                        root, comm
+                    );
                 }
 
-                size_t dims[2] = {0, 0};
-                if (comm.rank() == root) {
-                    dims[0] = global_matrix.rows();
-                    dims[1] = global_matrix.cols();
+                if (fileio::is_manifest(filename)) {
+                    return fileio::read_matrix_sharded<T>(
+                        filename, dist_type, root, comm
+                    );
                 }
 
-                comm.broadcast(dims, 2, root);
+                if (
+                    std::dynamic_pointer_cast<vmafu::io::formats::MatrixMarketFormat>(format)
+                ) {
+                    return fileio::read_matrix_market<T>(
+                        filename, dist_type, root, comm
+                    );
+                }
 
-                auto dist_info = distribution::matrix_distribution_info(
-                    dist_type, dims[0], dims[1], comm
-                );
+                if (
+                    std::dynamic_pointer_cast<vmafu::io::formats::IBinaryFormat>(format)
+                ) {
+                    return fileio::read_matrix<T>(filename, dist_type, root, comm);
+                }
 
-                return containers::MatrixMPI<T>(
-                    global_matrix, dist_info, root, comm
+                return fileio::stream_matrix<T>(
+                    filename, dist_type, 1024, root, comm
                 );
             }
 
@@ -70,6 +115,22 @@ namespace vmafu {
                 int root,
                 const communication::Communicator& comm
             ) {
+                if (fileio::is_manifest(filename)) {
+                    fileio::write_vector_sharded(filename, vector, root, comm);
+
+                    return;
+                }
+
+                if (
+                    std::dynamic_pointer_cast<vmafu::io::formats::BinaryFormat>(
+                        vmafu::io::create_format(filename)
+                    )
+                ) {
+                    fileio::write_vector(filename, vector, root, comm);
+
+                    return;
+                }
+
                 vmafu::core::Vector<T> global_vector;
 
                 distribution::gather(
@@ -89,6 +150,22 @@ namespace vmafu {
                 int root,
                 const communication::Communicator& comm 
             ) {
+                if (fileio::is_manifest(filename)) {
+                    fileio::write_matrix_sharded(filename, matrix, root, comm);
+
+                    return;
+                }
+
+                if (
+                    std::dynamic_pointer_cast<vmafu::io::formats::BinaryFormat>(
+                        vmafu::io::create_format(filename)
+                    )
+                ) {
+                    fileio::write_matrix(filename, matrix, root, comm);
+
+                    return;
+                }
+
                 vmafu::core::Matrix<T> global_matrix;
 
                 distribution::gather(
@@ -6,6 +6,8 @@
 
 #include <cmath>
 #include <vector>
+#include <climits>
+#include <algorithm>
 #include <stdexcept>
 
 #include "../../../core/_Vector.hpp"
@@ -136,6 +138,26 @@ namespace vmafu {
                     int root = 0,
                     const communication::Communicator& comm = communication::world()
                 );
+
+                // Redistribution methods
+
+                template <typename T>
+                inline void redistribute(
+                    const VectorDistributionInfo& source_info,
+                    const vmafu::core::Vector<T>& source,
+                    const VectorDistributionInfo& target_info,
+                    vmafu::core::Vector<T>& target,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                inline void redistribute(
+                    const MatrixDistributionInfo& source_info,
+                    const vmafu::core::Matrix<T>& source,
+                    const MatrixDistributionInfo& target_info,
+                    vmafu::core::Matrix<T>& target,
+                    const communication::Communicator& comm = communication::world()
+                );
             }
         }
     }
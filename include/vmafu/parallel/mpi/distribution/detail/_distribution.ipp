@@ -267,7 +267,7 @@ namespace vmafu {
                         }
                     }
 
-                    local = vmafu::core::Vector<T>(info.local_size);
+                    local = vmafu::core::Vector<T>(info.local_size, vmafu::core::uninitialized);
 
                     vmafu::core::Vector<size_t> all_local_sizes(comm_size);
                     vmafu::core::Vector<size_t> all_offsets(comm_size);
@@ -330,7 +330,7 @@ namespace vmafu {
                     }
 
                     local = vmafu::core::Matrix<T>(
-                        info.local_rows, info.local_cols
+                        info.local_rows, info.local_cols, vmafu::core::uninitialized
                     );
 
                     vmafu::core::Vector<size_t> all_local_rows(comm_size);
@@ -406,39 +406,35 @@ namespace vmafu {
                         if (comm_rank == root) {
                             for (int dest = 0; dest < comm_size; dest++) {
                                 if (dest == comm_rank) {
-                                    for (size_t i = 0; i < info.local_rows; i++) {
-                                        for (size_t j = 0; j < info.local_cols; j++) {
-                                            auto globals = info.local_to_global(i, j);
-                                            local(i, j) = global(globals.first, globals.second);
-                                        }
-                                    }
+                                    local.view().copy_from(
+                                        global.block(
+                                            info.row_offset, info.col_offset,
+                                            info.local_rows, info.local_cols
+                                        )
+                                    );
                                 } else if (sendcounts[dest] > 0) {
-                                    vmafu::core::Vector<T> send_buffer(sendcounts[dest]);
+                                    vmafu::core::Vector<T> send_buffer(sendcounts[dest], vmafu::core::uninitialized);
 
                                     size_t rows = all_local_rows[dest];
                                     size_t cols = all_local_cols[dest];
-                                    size_t row_start = all_row_offsets[dest];
-                                    size_t col_start = all_col_offsets[dest];
 
-                                    for (size_t i = 0; i < rows; i++) {
-                                        for (size_t j = 0; j < cols; j++) {
-                                            send_buffer[i * cols + j] = global(row_start + i, col_start + j);
-                                        }
-                                    }
+                                    vmafu::core::MatrixView<T>(
+                                        send_buffer.data(), rows, cols
+                                    ).copy_from(
+                                        global.block(
+                                            all_row_offsets[dest], all_col_offsets[dest],
+                                            rows, cols
+                                        )
+                                    );
 
                                     comm.send(send_buffer.data(), sendcounts[dest], dest, 0);
                                 }
                             }
                         } else if (sendcounts[comm_rank] > 0) {
-                            vmafu::core::Vector<T> recv_buffer(sendcounts[comm_rank]);
+                            // local is a dense local_rows x local_cols block,
+                            // so the packed block lands in it directly
 
-                            comm.recv(recv_buffer.data(), sendcounts[comm_rank], root, 0);
-
-                            for (size_t i = 0; i < info.local_rows; i++) {
-                                for (size_t j = 0; j < info.local_cols; j++) {
-                                    local(i, j) = recv_buffer[i * info.local_cols + j];
-                                }
-                            }
+                            comm.recv(local.data(), sendcounts[comm_rank], root, 0);
                         }
                     } else if (info.type == MatrixDistributionType::BLOCK_COLS) {
                         if (comm_rank == root) {
@@ -447,18 +443,17 @@ namespace vmafu {
                                 size_t local_cols = all_local_cols[dest];
 
                                 if (dest == comm_rank) {
-                                    for (size_t i = 0; i < info.global_rows; i++) {
-                                        for (size_t j = 0; j < local_cols; j++) {
-                                            local(i, j) = global(i, col_start + j);
-                                        }
-                                    }
+                                    local.view().copy_from(
+                                        global.block(0, col_start, info.global_rows, local_cols)
+                                    );
                                 } else {
-                                    vmafu::core::Vector<T> send_buffer(info.global_rows * local_cols);
-                                    for (size_t i = 0; i < info.global_rows; i++) {
-                                        for (size_t j = 0; j < local_cols; j++) {
-                                            send_buffer[i * local_cols + j] = global(i, col_start + j);
-                                        }
-                                    }
+                                    vmafu::core::Vector<T> send_buffer(info.global_rows * local_cols, vmafu::core::uninitialized);
+
+                                    vmafu::core::MatrixView<T>(
+                                        send_buffer.data(), info.global_rows, local_cols
+                                    ).copy_from(
+                                        global.block(0, col_start, info.global_rows, local_cols)
+                                    );
 
                                     comm.send(
                                         send_buffer.data(), static_cast<int>(send_buffer.size()),
@@ -467,20 +462,10 @@ namespace vmafu {
                                 }
                             }
                         } else {
-                            size_t local_cols = info.local_cols;
-
-                            vmafu::core::Vector<T> recv_buffer(info.global_rows * local_cols);
-
                             comm.recv(
-                                recv_buffer.data(), static_cast<int>(recv_buffer.size()),
+                                local.data(), static_cast<int>(local.size()),
                                 root, 0
                             );
-                            
-                            for (size_t i = 0; i < info.global_rows; i++) {
-                                for (size_t j = 0; j < local_cols; j++) {
-                                    local(i, j) = recv_buffer[i * local_cols + j];
-                                }
-                            }
                         }
                     } else {
                         comm.scatterv(
@@ -540,7 +525,7 @@ namespace vmafu {
                     }
 
                     if (comm_rank == root) {
-                        global = vmafu::core::Vector<T>(info.global_size);
+                        global = vmafu::core::Vector<T>(info.global_size, vmafu::core::uninitialized);
                     }
 
                     comm.gatherv(
@@ -642,56 +627,45 @@ namespace vmafu {
 
                     if (info.type == MatrixDistributionType::BLOCK_2D) {
                         if (comm_rank == root) {
-                            global = Matrix<T>(info.global_rows, info.global_cols);
+                            global = Matrix<T>(
+                                info.global_rows, info.global_cols, vmafu::core::uninitialized
+                            );
 
-                            for (size_t i = 0; i < info.local_rows; i++) {
-                                for (size_t j = 0; j < info.local_cols; j++) {
-                                    auto globals = info.local_to_global(i, j);
-                                    global(globals.first, globals.second) = local(i, j);
-                                }
-                            }
+                            global.block(
+                                info.row_offset, info.col_offset,
+                                info.local_rows, info.local_cols
+                            ).copy_from(local.view());
 
                             for (int src = 0; src < comm_size; src++) {
                                 if (src != comm_rank && gather_recvcounts[src] > 0) {
-                                    vmafu::core::Vector<T> recv_buffer(gather_recvcounts[src]);
+                                    vmafu::core::Vector<T> recv_buffer(gather_recvcounts[src], vmafu::core::uninitialized);
 
                                     comm.recv(recv_buffer.data(), gather_recvcounts[src], src, 0);
 
                                     size_t rows = all_local_rows[src];
                                     size_t cols = all_local_cols[src];
-                                    size_t row_start = all_row_offsets[src];
-                                    size_t col_start = all_col_offsets[src];
-
-                                    for (size_t i = 0; i < rows; i++) {
-                                        for (size_t j = 0; j < cols; j++) {
-                                            global(row_start + i, col_start + j) = recv_buffer[i * cols + j];
-                                        }
-                                    }
-                                }
-                            }
-                        } else if (gather_recvcounts[comm_rank] > 0) {
-                            vmafu::core::Vector<T> send_buffer(gather_recvcounts[comm_rank]);
 
-                            for (size_t i = 0; i < info.local_rows; i++) {
-                                for (size_t j = 0; j < info.local_cols; j++) {
-                                    send_buffer[i * info.local_cols + j] = local(i, j);
+                                    global.block(
+                                        all_row_offsets[src], all_col_offsets[src], rows, cols
+                                    ).copy_from(
+                                        vmafu::core::ConstMatrixView<T>(
+                                            recv_buffer.data(), rows, cols
+                                        )
+                                    );
                                 }
                             }
-
-                            comm.send(send_buffer.data(), gather_recvcounts[comm_rank], root, 0);
+                        } else if (gather_recvcounts[comm_rank] > 0) {
+                            comm.send(local.data(), gather_recvcounts[comm_rank], root, 0);
                         }
                     } else if (info.type == MatrixDistributionType::BLOCK_COLS) {
                         if (comm_rank == root) {
-                            global = Matrix<T>(info.global_rows, info.global_cols);
+                            global = Matrix<T>(
+                                info.global_rows, info.global_cols, vmafu::core::uninitialized
+                            );
 
-                            size_t col_start = info.col_offset;
-                            size_t local_cols = info.local_cols;
-
-                            for (size_t i = 0; i < info.global_rows; i++) {
-                                for (size_t j = 0; j < local_cols; j++) {
-                                    global(i, col_start + j) = local(i, j);
-                                }
-                            }
+                            global.block(
+                                0, info.col_offset, info.global_rows, info.local_cols
+                            ).copy_from(local.view());
 
                             for (int src = 0; src < comm_size; src++) {
                                 if (src != comm_rank) {
@@ -702,15 +676,17 @@ namespace vmafu {
                                         info.global_rows * src_local_cols
                                     );
 
-                                    vmafu::core::Vector<T> recv_buffer(recv_count);
+                                    vmafu::core::Vector<T> recv_buffer(recv_count, vmafu::core::uninitialized);
 
                                     comm.recv(recv_buffer.data(), recv_count, src, 0);
 
-                                    for (size_t i = 0; i < info.global_rows; i++) {
-                                        for (size_t j = 0; j < src_local_cols; j++) {
-                                            global(i, src_col_start + j) = recv_buffer[i * src_local_cols + j];
-                                        }
-                                    }
+                                    global.block(
+                                        0, src_col_start, info.global_rows, src_local_cols
+                                    ).copy_from(
+                                        vmafu::core::ConstMatrixView<T>(
+                                            recv_buffer.data(), info.global_rows, src_local_cols
+                                        )
+                                    );
                                 }
                             }
                         } else {
@@ -718,19 +694,13 @@ namespace vmafu {
                                 info.global_rows * info.local_cols
                             );
 
-                            vmafu::core::Vector<T> send_buffer(send_count);
-
-                            for (size_t i = 0; i < info.global_rows; i++) {
-                                for (size_t j = 0; j < info.local_cols; j++) {
-                                    send_buffer[i * info.local_cols + j] = local(i, j);
-                                }
-                            }
-
-                            comm.send(send_buffer.data(), send_count, root, 0);
+                            comm.send(local.data(), send_count, root, 0);
                         }
                     } else {
                         if (comm_rank == root) {
-                            global = Matrix<T>(info.global_rows, info.global_cols);
+                            global = Matrix<T>(
+                                info.global_rows, info.global_cols, vmafu::core::uninitialized
+                            );
                         }
 
                         comm.gatherv(
@@ -743,6 +713,221 @@ namespace vmafu {
                         );
                     }
                 }
+
+                // Redistribution methods
+
+                template <typename T>
+                void redistribute(
+                    const VectorDistributionInfo& source_info,
+                    const vmafu::core::Vector<T>& source,
+                    const VectorDistributionInfo& target_info,
+                    vmafu::core::Vector<T>& target,
+                    const communication::Communicator& comm
+                ) {
+                    int comm_size = comm.size();
+
+                    if (source_info.global_size != target_info.global_size) {
+                        throw std::invalid_argument(
+                            "distribution::redistribute(): Source and target sizes do not match"
+                        );
+                    }
+
+                    size_t local_ranges[4] = {
+                        source_info.offset, source_info.local_size,
+                        target_info.offset, target_info.local_size
+                    };
+
+                    vmafu::core::Vector<size_t> all_ranges(4 * comm_size);
+
+                    comm.allgather(local_ranges, all_ranges.data(), 4);
+
+                    vmafu::core::Vector<int> sendcounts(comm_size);
+                    vmafu::core::Vector<int> sdispls(comm_size);
+                    vmafu::core::Vector<int> recvcounts(comm_size);
+                    vmafu::core::Vector<int> rdispls(comm_size);
+
+                    size_t send_total = 0;
+                    size_t recv_total = 0;
+
+                    for (int p = 0; p < comm_size; p++) {
+                        size_t send_begin = std::max(
+                            source_info.offset, all_ranges[4 * p + 2]
+                        );
+                        size_t send_end = std::min(
+                            source_info.offset + source_info.local_size,
+                            all_ranges[4 * p + 2] + all_ranges[4 * p + 3]
+                        );
+
+                        size_t recv_begin = std::max(
+                            all_ranges[4 * p], target_info.offset
+                        );
+                        size_t recv_end = std::min(
+                            all_ranges[4 * p] + all_ranges[4 * p + 1],
+                            target_info.offset + target_info.local_size
+                        );
+
+                        size_t send_count = send_end > send_begin ? send_end - send_begin : 0;
+                        size_t recv_count = recv_end > recv_begin ? recv_end - recv_begin : 0;
+
+                        if (send_total + send_count > INT_MAX || recv_total + recv_count > INT_MAX) {
+                            throw std::invalid_argument(
+                                "distribution::redistribute(): Block exceeds MPI count limits"
+                            );
+                        }
+
+                        sendcounts[p] = static_cast<int>(send_count);
+                        sdispls[p] = static_cast<int>(
+                            send_count > 0 ? send_begin - source_info.offset : 0
+                        );
+
+                        recvcounts[p] = static_cast<int>(recv_count);
+                        rdispls[p] = static_cast<int>(
+                            recv_count > 0 ? recv_begin - target_info.offset : 0
+                        );
+
+                        send_total += send_count;
+                        recv_total += recv_count;
+                    }
+
+                    target = vmafu::core::Vector<T>(target_info.local_size, vmafu::core::uninitialized);
+
+                    comm.alltoallv(
+                        source.data(), sendcounts.data(), sdispls.data(),
+                        target.data(), recvcounts.data(), rdispls.data()
+                    );
+                }
+
+                template <typename T>
+                void redistribute(
+                    const MatrixDistributionInfo& source_info,
+                    const vmafu::core::Matrix<T>& source,
+                    const MatrixDistributionInfo& target_info,
+                    vmafu::core::Matrix<T>& target,
+                    const communication::Communicator& comm
+                ) {
+                    int comm_size = comm.size();
+
+                    if (
+                        source_info.global_rows != target_info.global_rows ||
+                        source_info.global_cols != target_info.global_cols
+                    ) {
+                        throw std::invalid_argument(
+                            "distribution::redistribute(): Source and target dimensions do not match"
+                        );
+                    }
+
+                    size_t local_blocks[8] = {
+                        source_info.row_offset, source_info.col_offset,
+                        source_info.local_rows, source_info.local_cols,
+                        target_info.row_offset, target_info.col_offset,
+                        target_info.local_rows, target_info.local_cols
+                    };
+
+                    vmafu::core::Vector<size_t> all_blocks(8 * comm_size);
+
+                    comm.allgather(local_blocks, all_blocks.data(), 8);
+
+                    auto overlap = [](
+                        const size_t* a, const size_t* b, size_t* result
+                    ) {
+                        result[0] = std::max(a[0], b[0]);
+                        result[1] = std::max(a[1], b[1]);
+
+                        size_t row_end = std::min(a[0] + a[2], b[0] + b[2]);
+                        size_t col_end = std::min(a[1] + a[3], b[1] + b[3]);
+
+                        result[2] = row_end > result[0] ? row_end - result[0] : 0;
+                        result[3] = col_end > result[1] ? col_end - result[1] : 0;
+
+                        return result[2] * result[3];
+                    };
+
+                    vmafu::core::Vector<int> sendcounts(comm_size);
+                    vmafu::core::Vector<int> sdispls(comm_size);
+                    vmafu::core::Vector<int> recvcounts(comm_size);
+                    vmafu::core::Vector<int> rdispls(comm_size);
+
+                    size_t send_total = 0;
+                    size_t recv_total = 0;
+
+                    size_t region[4];
+
+                    for (int p = 0; p < comm_size; p++) {
+                        size_t send_count = overlap(
+                            local_blocks, &all_blocks[8 * p + 4], region
+                        );
+                        size_t recv_count = overlap(
+                            &all_blocks[8 * p], local_blocks + 4, region
+                        );
+
+                        if (send_total + send_count > INT_MAX || recv_total + recv_count > INT_MAX) {
+                            throw std::invalid_argument(
+                                "distribution::redistribute(): Block exceeds MPI count limits"
+                            );
+                        }
+
+                        sendcounts[p] = static_cast<int>(send_count);
+                        sdispls[p] = static_cast<int>(send_total);
+
+                        recvcounts[p] = static_cast<int>(recv_count);
+                        rdispls[p] = static_cast<int>(recv_total);
+
+                        send_total += send_count;
+                        recv_total += recv_count;
+                    }
+
+                    vmafu::core::Vector<T> send_buffer(send_total, vmafu::core::uninitialized);
+                    vmafu::core::Vector<T> recv_buffer(recv_total, vmafu::core::uninitialized);
+
+                    size_t position = 0;
+
+                    for (int p = 0; p < comm_size; p++) {
+                        if (overlap(local_blocks, &all_blocks[8 * p + 4], region) == 0) {
+                            continue;
+                        }
+
+                        for (size_t i = region[0]; i < region[0] + region[2]; i++) {
+                            const T* row = &source(
+                                i - source_info.row_offset,
+                                region[1] - source_info.col_offset
+                            );
+
+                            std::copy(row, row + region[3], &send_buffer[position]);
+
+                            position += region[3];
+                        }
+                    }
+
+                    comm.alltoallv(
+                        send_buffer.data(), sendcounts.data(), sdispls.data(),
+                        recv_buffer.data(), recvcounts.data(), rdispls.data()
+                    );
+
+                    target = vmafu::core::Matrix<T>(
+                        target_info.local_rows, target_info.local_cols, vmafu::core::uninitialized
+                    );
+
+                    position = 0;
+
+                    for (int p = 0; p < comm_size; p++) {
+                        if (overlap(&all_blocks[8 * p], local_blocks + 4, region) == 0) {
+                            continue;
+                        }
+
+                        for (size_t i = region[0]; i < region[0] + region[2]; i++) {
+                            std::copy(
+                                &recv_buffer[position],
+                                &recv_buffer[position] + region[3],
+                                &target(
+                                    i - target_info.row_offset,
+                                    region[1] - target_info.col_offset
+                                )
+                            );
+
+                            position += region[3];
+                        }
+                    }
+                }
             }
         }
     }
@@ -0,0 +1,410 @@
+// parallel/mpi/fileio/_fileio.hpp
+
+
+#pragma once
+
+
+#include <mpi.h>
+#include <string>
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <filesystem>
+#include <tuple>
+
+#include "../../../core/_Vector.hpp"
+#include "../../../core/_Matrix.hpp"
+#include "../../../core/_SparseMatrix.hpp"
+#include "../../../io/_io.hpp"
+
+#include "../communication/_communication.hpp"
+#include "../distribution/_distribution.hpp"
+#include "../containers/_VectorMPI.hpp"
+#include "../containers/_MatrixMPI.hpp"
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace fileio {
+                // Shard structs
+
+                struct ShardInfo {
+                    size_t row_offset;
+                    size_t col_offset;
+
+                    size_t rows;
+                    size_t cols;
+
+                    std::string filename;
+                };
+
+                struct Manifest {
+                    std::string kind;
+                    std::string distribution;
+
+                    io::formats::DataType dtype;
+
+                    size_t rows;
+                    size_t cols;
+
+                    std::vector<ShardInfo> shards;
+                };
+
+                // Helper methods
+
+                inline MPI_Datatype mpi_type(io::formats::DataType dtype);
+
+                inline MPI_Datatype block_filetype(
+                    const distribution::MatrixDistributionInfo& info,
+                    MPI_Datatype etype
+                );
+
+                inline MPI_File open(
+                    const std::string& filename,
+                    int amode,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                inline void close(MPI_File& file);
+
+                inline std::string distribution_name(
+                    distribution::MatrixDistributionType type
+                );
+
+                inline std::string distribution_name(
+                    distribution::VectorDistributionType type
+                );
+
+                inline bool is_manifest(const std::string& filename);
+
+                inline distribution::MatrixDistributionInfo row_block_info(
+                    size_t rows,
+                    size_t cols,
+                    size_t local_rows,
+                    size_t row_offset,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                inline size_t read_bytes(
+                    MPI_File file,
+                    size_t offset,
+                    size_t count,
+                    char* buffer
+                );
+
+                // Header methods
+
+                inline io::formats::ArrayInfo read_info(
+                    const std::string& filename,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                // Collective read methods ( binary formats )
+
+                template <typename T>
+                inline void read_block(
+                    MPI_File file,
+                    const io::formats::ArrayInfo& array_info,
+                    const distribution::MatrixDistributionInfo& dist_info,
+                    vmafu::core::Matrix<T>& local
+                );
+
+                template <typename T>
+                inline void read_block(
+                    MPI_File file,
+                    const io::formats::ArrayInfo& array_info,
+                    const distribution::VectorDistributionInfo& dist_info,
+                    vmafu::core::Vector<T>& local
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> read_matrix(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type = distribution::MatrixDistributionType::BLOCK_ROWS,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> read_vector(
+                    const std::string& filename,
+                    distribution::VectorDistributionType dist_type = distribution::VectorDistributionType::BLOCK,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                // Collective write methods ( binary formats )
+
+                template <typename T>
+                inline void write_block(
+                    MPI_File file,
+                    const io::formats::ArrayInfo& array_info,
+                    const distribution::MatrixDistributionInfo& dist_info,
+                    const vmafu::core::Matrix<T>& local
+                );
+
+                template <typename T>
+                inline void write_block(
+                    MPI_File file,
+                    const io::formats::ArrayInfo& array_info,
+                    const distribution::VectorDistributionInfo& dist_info,
+                    const vmafu::core::Vector<T>& local
+                );
+
+                template <typename T>
+                void write_matrix(
+                    const std::string& filename,
+                    const containers::MatrixMPI<T>& matrix,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                void write_vector(
+                    const std::string& filename,
+                    const containers::VectorMPI<T>& vector,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                // Distributed read methods ( text formats )
+
+                inline std::string read_line_range(
+                    const std::string& filename,
+                    size_t& line_start,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                inline bool has_index(
+                    const std::string& filename,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> read_vector_indexed(
+                    const std::string& filename,
+                    distribution::VectorDistributionType dist_type = distribution::VectorDistributionType::BLOCK,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> read_matrix_csv(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type = distribution::MatrixDistributionType::BLOCK_ROWS,
+                    char delimiter = ',',
+                    bool has_header = false,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                // Distributed read methods ( sparse formats )
+
+                template <typename T>
+                vmafu::core::SparseMatrix<T> read_sparse_rows(
+                    const std::string& filename,
+                    distribution::VectorDistributionInfo& row_info,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> read_matrix_market(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type = distribution::MatrixDistributionType::BLOCK_ROWS,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                // Streaming read methods ( root-only text input )
+
+                template <typename T>
+                containers::MatrixMPI<T> stream_matrix(
+                    std::istream& stream,
+                    const io::FormatPtr& format,
+                    const io::ParserPtr& parser,
+                    distribution::MatrixDistributionType dist_type = distribution::MatrixDistributionType::BLOCK_ROWS,
+                    size_t block_rows = 1024,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> stream_matrix(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type = distribution::MatrixDistributionType::BLOCK_ROWS,
+                    size_t block_rows = 1024,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                // Manifest methods ( sharded mode )
+
+                inline void write_manifest(
+                    const std::string& filename,
+                    const Manifest& manifest
+                );
+
+                inline Manifest read_manifest(
+                    const std::string& filename,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                inline std::string shard_filename(
+                    const std::string& manifest_filename,
+                    int rank
+                );
+
+                template <typename T>
+                inline void read_region(
+                    const std::string& manifest_filename,
+                    const Manifest& manifest,
+                    size_t row_offset,
+                    size_t col_offset,
+                    vmafu::core::Matrix<T>& local
+                );
+
+                // Sharded write / read methods
+
+                template <typename T>
+                void write_matrix_sharded(
+                    const std::string& filename,
+                    const containers::MatrixMPI<T>& matrix,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                void write_vector_sharded(
+                    const std::string& filename,
+                    const containers::VectorMPI<T>& vector,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> read_matrix_sharded(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type = distribution::MatrixDistributionType::BLOCK_ROWS,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> read_vector_sharded(
+                    const std::string& filename,
+                    distribution::VectorDistributionType dist_type = distribution::VectorDistributionType::BLOCK,
+                    int root = 0,
+                    const communication::Communicator& comm = communication::world()
+                );
+
+                // Checkpoint helper methods
+
+                inline distribution::MatrixDistributionType matrix_distribution_type(
+                    const std::string& name
+                );
+
+                inline distribution::VectorDistributionType vector_distribution_type(
+                    const std::string& name
+                );
+
+                inline std::string checkpoint_filename(
+                    const std::string& directory,
+                    size_t index,
+                    const std::string& suffix
+                );
+
+                inline void write_dist_info(
+                    const std::string& filename,
+                    const distribution::MatrixDistributionInfo& info
+                );
+
+                inline void write_dist_info(
+                    const std::string& filename,
+                    const distribution::VectorDistributionInfo& info
+                );
+
+                inline void read_dist_info(
+                    const std::string& filename,
+                    distribution::MatrixDistributionInfo& info
+                );
+
+                inline void read_dist_info(
+                    const std::string& filename,
+                    distribution::VectorDistributionInfo& info
+                );
+
+                template <typename T>
+                void check_dtype(size_t index, const std::string& dtype);
+
+                inline void check_restored(
+                    int failed,
+                    const std::string& error,
+                    size_t index,
+                    const communication::Communicator& comm
+                );
+
+                template <typename T>
+                void checkpoint_object(
+                    const std::string& directory,
+                    size_t index,
+                    const containers::MatrixMPI<T>& matrix,
+                    std::ostream& entries
+                );
+
+                template <typename T>
+                void checkpoint_object(
+                    const std::string& directory,
+                    size_t index,
+                    const containers::VectorMPI<T>& vector,
+                    std::ostream& entries
+                );
+
+                template <typename T>
+                void restore_object(
+                    const std::string& directory,
+                    size_t index,
+                    const std::string& kind,
+                    const std::string& dtype,
+                    int saved_ranks,
+                    containers::MatrixMPI<T>& matrix
+                );
+
+                template <typename T>
+                void restore_object(
+                    const std::string& directory,
+                    size_t index,
+                    const std::string& kind,
+                    const std::string& dtype,
+                    int saved_ranks,
+                    containers::VectorMPI<T>& vector
+                );
+
+                // Checkpoint / restart methods
+
+                template <typename... Objects>
+                void checkpoint(
+                    const std::string& directory,
+                    const Objects&... objects
+                );
+
+                template <typename... Objects>
+                void restore(
+                    const std::string& directory,
+                    Objects&... objects
+                );
+            }
+        }
+    }
+}
+
+
+#include "detail/_fileio.ipp"
@@ -0,0 +1,2539 @@
+// parallel/mpi/fileio/detail/_fileio.ipp
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace fileio {
+                // Helper methods
+
+                MPI_Datatype mpi_type(io::formats::DataType dtype) {
+                    switch (dtype) {
+                        case io::formats::DataType::INT32: {
+                            return MPI_INT32_T;
+                        }
+                        case io::formats::DataType::INT64: {
+                            return MPI_INT64_T;
+                        }
+                        case io::formats::DataType::FLOAT32: {
+                            return MPI_FLOAT;
+                        }
+                        case io::formats::DataType::FLOAT64: {
+                            return MPI_DOUBLE;
+                        }
+                        default: {
+                            throw std::invalid_argument(
+                                "fileio::mpi_type(): Unknown data type"
+                            );
+                        }
+                    }
+                }
+
+                MPI_Datatype block_filetype(
+                    const distribution::MatrixDistributionInfo& info,
+                    MPI_Datatype etype
+                ) {
+                    if (
+                        info.global_rows > INT_MAX || info.global_cols > INT_MAX
+                    ) {
+                        throw std::invalid_argument(
+                            "fileio::block_filetype(): Matrix dimensions exceed MPI limits"
+                        );
+                    }
+
+                    int sizes[2] = {
+                        static_cast<int>(info.global_rows),
+                        static_cast<int>(info.global_cols)
+                    };
+                    int subsizes[2] = {
+                        static_cast<int>(info.local_rows),
+                        static_cast<int>(info.local_cols)
+                    };
+                    int starts[2] = {
+                        static_cast<int>(info.row_offset),
+                        static_cast<int>(info.col_offset)
+                    };
+
+                    MPI_Datatype filetype;
+
+                    MPI_Type_create_subarray(
+                        2, sizes, subsizes, starts, MPI_ORDER_C, etype, &filetype
+                    );
+                    MPI_Type_commit(&filetype);
+
+                    return filetype;
+                }
+
+                MPI_File open(
+                    const std::string& filename,
+                    int amode,
+                    const communication::Communicator& comm
+                ) {
+                    MPI_File file;
+
+                    int error = MPI_File_open(
+                        comm.get(), filename.c_str(), amode, MPI_INFO_NULL, &file
+                    );
+
+                    if (error != MPI_SUCCESS) {
+                        throw std::runtime_error(
+                            "fileio::open(): Cannot open file: " + filename
+                        );
+                    }
+
+                    return file;
+                }
+
+                void close(MPI_File& file) {
+                    if (file != MPI_FILE_NULL) {
+                        MPI_File_close(&file);
+                    }
+                }
+
+                std::string distribution_name(
+                    distribution::MatrixDistributionType type
+                ) {
+                    switch (type) {
+                        case distribution::MatrixDistributionType::BLOCK_ROWS: {
+                            return "BLOCK_ROWS";
+                        }
+                        case distribution::MatrixDistributionType::BLOCK_COLS: {
+                            return "BLOCK_COLS";
+                        }
+                        case distribution::MatrixDistributionType::BLOCK_2D: {
+                            return "BLOCK_2D";
+                        }
+                        case distribution::MatrixDistributionType::CYCLIC_ROWS: {
+                            return "CYCLIC_ROWS";
+                        }
+                        case distribution::MatrixDistributionType::CYCLIC_COLS: {
+                            return "CYCLIC_COLS";
+                        }
+                        default: {
+                            return "UNKNOWN";
+                        }
+                    }
+                }
+
+                std::string distribution_name(
+                    distribution::VectorDistributionType type
+                ) {
+                    switch (type) {
+                        case distribution::VectorDistributionType::BLOCK: {
+                            return "BLOCK";
+                        }
+                        case distribution::VectorDistributionType::CYCLIC: {
+                            return "CYCLIC";
+                        }
+                        default: {
+                            return "UNKNOWN";
+                        }
+                    }
+                }
+
+                bool is_manifest(const std::string& filename) {
+                    size_t dot_pos = filename.find_last_of('.');
+
+                    if (dot_pos == std::string::npos) {
+                        return false;
+                    }
+
+                    std::string ext = filename.substr(dot_pos);
+
+                    return ext == ".manifest" || ext == ".MANIFEST";
+                }
+
+                distribution::MatrixDistributionInfo row_block_info(
+                    size_t rows,
+                    size_t cols,
+                    size_t local_rows,
+                    size_t row_offset,
+                    const communication::Communicator& comm
+                ) {
+                    distribution::MatrixDistributionInfo info;
+
+                    info.type = distribution::MatrixDistributionType::BLOCK_ROWS;
+                    info.global_rows = rows;
+                    info.global_cols = cols;
+                    info.local_rows = local_rows;
+                    info.local_cols = cols;
+                    info.row_offset = row_offset;
+                    info.col_offset = 0;
+                    info.grid_rows = comm.size();
+                    info.grid_cols = 1;
+                    info.grid_row = comm.rank();
+                    info.grid_col = 0;
+
+                    return info;
+                }
+
+                size_t read_bytes(
+                    MPI_File file,
+                    size_t offset,
+                    size_t count,
+                    char* buffer
+                ) {
+                    const size_t max_chunk = static_cast<size_t>(INT_MAX) / 2;
+
+                    size_t total = 0;
+
+                    while (total < count) {
+                        int chunk = static_cast<int>(
+                            std::min(max_chunk, count - total)
+                        );
+
+                        MPI_Status status;
+
+                        MPI_File_read_at(
+                            file, static_cast<MPI_Offset>(offset + total),
+                            buffer + total, chunk, MPI_CHAR, &status
+                        );
+
+                        int received = 0;
+                        MPI_Get_count(&status, MPI_CHAR, &received);
+
+                        if (received <= 0) {
+                            break;
+                        }
+
+                        total += static_cast<size_t>(received);
+                    }
+
+                    return total;
+                }
+
+                // Header methods
+
+                io::formats::ArrayInfo read_info(
+                    const std::string& filename,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    unsigned long long fields[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+                    if (comm.rank() == root) {
+                        auto format = std::dynamic_pointer_cast<io::formats::IBinaryFormat>(
+                            io::create_format(filename)
+                        );
+
+                        if (format) {
+                            try {
+                                io::formats::ArrayInfo info = format->read_info(filename);
+
+                                fields[0] = 1;
+                                fields[1] = static_cast<unsigned long long>(info.dtype);
+                                fields[2] = info.rows;
+                                fields[3] = info.cols;
+                                fields[4] = info.data_offset;
+                                fields[5] = info.fortran_order ? 1 : 0;
+                                fields[6] = info.big_endian ? 1 : 0;
+                                fields[7] = info.contiguous ? 1 : 0;
+                            } catch (...) {
+                                fields[0] = 0;
+                            }
+                        }
+                    }
+
+                    comm.broadcast(fields, 8, root);
+
+                    if (fields[0] == 0) {
+                        throw std::runtime_error(
+                            "fileio::read_info(): Cannot read binary header: " + filename
+                        );
+                    }
+
+                    io::formats::ArrayInfo info;
+
+                    info.dtype = static_cast<io::formats::DataType>(fields[1]);
+                    info.rows = static_cast<size_t>(fields[2]);
+                    info.cols = static_cast<size_t>(fields[3]);
+                    info.data_offset = static_cast<size_t>(fields[4]);
+                    info.fortran_order = fields[5] != 0;
+                    info.big_endian = fields[6] != 0;
+                    info.contiguous = fields[7] != 0;
+
+                    return info;
+                }
+
+                // Collective read methods ( binary formats )
+
+                template <typename T>
+                void read_block(
+                    MPI_File file,
+                    const io::formats::ArrayInfo& array_info,
+                    const distribution::MatrixDistributionInfo& dist_info,
+                    vmafu::core::Matrix<T>& local
+                ) {
+                    size_t local_count = dist_info.local_rows * dist_info.local_cols;
+
+                    if (local_count > INT_MAX) {
+                        throw std::invalid_argument(
+                            "fileio::read_block(): Local block exceeds MPI count limits"
+                        );
+                    }
+
+                    MPI_Datatype etype = mpi_type(array_info.dtype);
+                    MPI_Datatype filetype = etype;
+
+                    if (local_count > 0) {
+                        filetype = block_filetype(dist_info, etype);
+                    }
+
+                    MPI_File_set_view(
+                        file, static_cast<MPI_Offset>(array_info.data_offset),
+                        etype, filetype, "native", MPI_INFO_NULL
+                    );
+
+                    local = vmafu::core::Matrix<T>(
+                        dist_info.local_rows, dist_info.local_cols, vmafu::core::uninitialized
+                    );
+
+                    bool direct = (
+                        array_info.dtype == io::formats::data_type<T>() &&
+                        array_info.big_endian == io::formats::is_big_endian_host()
+                    );
+
+                    std::vector<char> buffer;
+                    void* target = local.data();
+
+                    if (!direct) {
+                        buffer.resize(
+                            local_count * io::formats::data_type_size(array_info.dtype)
+                        );
+                        target = buffer.data();
+                    }
+
+                    MPI_File_read_at_all(
+                        file, 0, target, static_cast<int>(local_count),
+                        etype, MPI_STATUS_IGNORE
+                    );
+
+                    if (!direct) {
+                        io::formats::convert_elements(
+                            buffer.data(), array_info, local_count, local.data()
+                        );
+                    }
+
+                    if (filetype != etype) {
+                        MPI_Type_free(&filetype);
+                    }
+                }
+
+                template <typename T>
+                void read_block(
+                    MPI_File file,
+                    const io::formats::ArrayInfo& array_info,
+                    const distribution::VectorDistributionInfo& dist_info,
+                    vmafu::core::Vector<T>& local
+                ) {
+                    if (dist_info.local_size > INT_MAX) {
+                        throw std::invalid_argument(
+                            "fileio::read_block(): Local block exceeds MPI count limits"
+                        );
+                    }
+
+                    MPI_Datatype etype = mpi_type(array_info.dtype);
+
+                    MPI_File_set_view(
+                        file, static_cast<MPI_Offset>(array_info.data_offset),
+                        etype, etype, "native", MPI_INFO_NULL
+                    );
+
+                    local = vmafu::core::Vector<T>(dist_info.local_size, vmafu::core::uninitialized);
+
+                    bool direct = (
+                        array_info.dtype == io::formats::data_type<T>() &&
+                        array_info.big_endian == io::formats::is_big_endian_host()
+                    );
+
+                    std::vector<char> buffer;
+                    void* target = local.data();
+
+                    if (!direct) {
+                        buffer.resize(
+                            dist_info.local_size * io::formats::data_type_size(array_info.dtype)
+                        );
+                        target = buffer.data();
+                    }
+
+                    MPI_File_read_at_all(
+                        file, static_cast<MPI_Offset>(dist_info.offset), target,
+                        static_cast<int>(dist_info.local_size), etype,
+                        MPI_STATUS_IGNORE
+                    );
+
+                    if (!direct) {
+                        io::formats::convert_elements(
+                            buffer.data(), array_info, dist_info.local_size,
+                            local.data()
+                        );
+                    }
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> read_matrix(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    io::formats::ArrayInfo array_info = read_info(
+                        filename, root, comm
+                    );
+
+                    auto dist_info = distribution::matrix_distribution_info(
+                        dist_type, array_info.rows, array_info.cols, comm
+                    );
+
+                    // Chunked payloads: every rank decodes only the chunks
+                    // covering its own row block
+
+                    if (!array_info.contiguous && !array_info.fortran_order) {
+                        auto rows_info = distribution::vector_distribution_info(
+                            distribution::VectorDistributionType::BLOCK,
+                            array_info.rows, comm
+                        );
+
+                        vmafu::core::Matrix<T> local;
+
+                        int failed = 0;
+                        std::string error;
+
+                        try {
+                            local = io::load_matrix_rows<T>(
+                                filename, rows_info.offset,
+                                rows_info.offset + rows_info.local_size
+                            );
+                        } catch (const std::exception& e) {
+                            failed = 1;
+                            error = e.what();
+                        }
+
+                        if (comm.allreduce(failed, MPI_MAX) != 0) {
+                            throw std::runtime_error(
+                                "fileio::read_matrix(): Failed to read " + filename + \
+                                (error.empty() ? std::string() : ": " + error)
+                            );
+                        }
+
+                        auto source_info = row_block_info(
+                            array_info.rows, array_info.cols,
+                            rows_info.local_size, rows_info.offset, comm
+                        );
+
+                        vmafu::core::Matrix<T> target;
+
+                        distribution::redistribute(
+                            source_info, local, dist_info, target, comm
+                        );
+
+                        containers::MatrixMPI<T> result(comm);
+
+                        result.set_local_matrix(std::move(target));
+                        result.set_dist_info(dist_info);
+
+                        return result;
+                    }
+
+                    if (array_info.fortran_order) {
+                        vmafu::core::Matrix<T> global_matrix;
+
+                        if (comm.rank() == root) {
+                            global_matrix = io::load_matrix<T>(filename);
+                        }
+
+                        return containers::MatrixMPI<T>(
+                            global_matrix, dist_info, root, comm
+                        );
+                    }
+
+                    MPI_File file = open(filename, MPI_MODE_RDONLY, comm);
+
+                    vmafu::core::Matrix<T> local;
+
+                    read_block(file, array_info, dist_info, local);
+
+                    close(file);
+
+                    containers::MatrixMPI<T> result(comm);
+
+                    result.set_local_matrix(std::move(local));
+                    result.set_dist_info(dist_info);
+
+                    return result;
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> read_vector(
+                    const std::string& filename,
+                    distribution::VectorDistributionType dist_type,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    io::formats::ArrayInfo array_info = read_info(
+                        filename, root, comm
+                    );
+
+                    if (array_info.rows > 1 && array_info.cols > 1) {
+                        throw std::runtime_error(
+                            "fileio::read_vector(): Binary array is not one-dimensional: " + filename
+                        );
+                    }
+
+                    auto dist_info = distribution::vector_distribution_info(
+                        dist_type, array_info.size(), comm
+                    );
+
+                    if (!array_info.contiguous) {
+                        vmafu::core::Vector<T> local;
+
+                        int failed = 0;
+                        std::string error;
+
+                        try {
+                            local = io::load_vector_range<T>(
+                                filename, dist_info.offset,
+                                dist_info.offset + dist_info.local_size
+                            );
+                        } catch (const std::exception& e) {
+                            failed = 1;
+                            error = e.what();
+                        }
+
+                        if (comm.allreduce(failed, MPI_MAX) != 0) {
+                            throw std::runtime_error(
+                                "fileio::read_vector(): Failed to read " + filename + \
+                                (error.empty() ? std::string() : ": " + error)
+                            );
+                        }
+
+                        containers::VectorMPI<T> result(comm);
+
+                        result.set_local_vector(std::move(local));
+                        result.set_dist_info(dist_info);
+
+                        return result;
+                    }
+
+                    MPI_File file = open(filename, MPI_MODE_RDONLY, comm);
+
+                    vmafu::core::Vector<T> local;
+
+                    read_block(file, array_info, dist_info, local);
+
+                    close(file);
+
+                    containers::VectorMPI<T> result(comm);
+
+                    result.set_local_vector(std::move(local));
+                    result.set_dist_info(dist_info);
+
+                    return result;
+                }
+
+                // Collective write methods ( binary formats )
+
+                template <typename T>
+                void write_block(
+                    MPI_File file,
+                    const io::formats::ArrayInfo& array_info,
+                    const distribution::MatrixDistributionInfo& dist_info,
+                    const vmafu::core::Matrix<T>& local
+                ) {
+                    size_t local_count = dist_info.local_rows * dist_info.local_cols;
+
+                    if (local_count > INT_MAX) {
+                        throw std::invalid_argument(
+                            "fileio::write_block(): Local block exceeds MPI count limits"
+                        );
+                    }
+
+                    MPI_Datatype etype = mpi_type(array_info.dtype);
+                    MPI_Datatype filetype = etype;
+
+                    if (local_count > 0) {
+                        filetype = block_filetype(dist_info, etype);
+                    }
+
+                    MPI_File_set_view(
+                        file, static_cast<MPI_Offset>(array_info.data_offset),
+                        etype, filetype, "native", MPI_INFO_NULL
+                    );
+
+                    std::vector<char> buffer;
+                    const void* source = local.data();
+
+                    if (array_info.dtype != io::formats::data_type<T>()) {
+                        buffer.resize(
+                            local_count * io::formats::data_type_size(array_info.dtype)
+                        );
+
+                        io::formats::convert_elements(
+                            local.data(), local_count, array_info, buffer.data()
+                        );
+
+                        source = buffer.data();
+                    }
+
+                    MPI_File_write_at_all(
+                        file, 0, source, static_cast<int>(local_count),
+                        etype, MPI_STATUS_IGNORE
+                    );
+
+                    if (filetype != etype) {
+                        MPI_Type_free(&filetype);
+                    }
+                }
+
+                template <typename T>
+                void write_block(
+                    MPI_File file,
+                    const io::formats::ArrayInfo& array_info,
+                    const distribution::VectorDistributionInfo& dist_info,
+                    const vmafu::core::Vector<T>& local
+                ) {
+                    if (dist_info.local_size > INT_MAX) {
+                        throw std::invalid_argument(
+                            "fileio::write_block(): Local block exceeds MPI count limits"
+                        );
+                    }
+
+                    MPI_Datatype etype = mpi_type(array_info.dtype);
+
+                    MPI_File_set_view(
+                        file, static_cast<MPI_Offset>(array_info.data_offset),
+                        etype, etype, "native", MPI_INFO_NULL
+                    );
+
+                    std::vector<char> buffer;
+                    const void* source = local.data();
+
+                    if (array_info.dtype != io::formats::data_type<T>()) {
+                        buffer.resize(
+                            dist_info.local_size * io::formats::data_type_size(array_info.dtype)
+                        );
+
+                        io::formats::convert_elements(
+                            local.data(), dist_info.local_size, array_info,
+                            buffer.data()
+                        );
+
+                        source = buffer.data();
+                    }
+
+                    MPI_File_write_at_all(
+                        file, static_cast<MPI_Offset>(dist_info.offset), source,
+                        static_cast<int>(dist_info.local_size), etype,
+                        MPI_STATUS_IGNORE
+                    );
+                }
+
+                template <typename T>
+                void write_matrix(
+                    const std::string& filename,
+                    const containers::MatrixMPI<T>& matrix,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    io::formats::ArrayInfo array_info;
+
+                    array_info.dtype = io::formats::data_type<T>();
+                    array_info.rows = matrix.global_rows();
+                    array_info.cols = matrix.global_cols();
+                    array_info.data_offset = io::formats::BinaryFormat::HEADER_SIZE;
+                    array_info.big_endian = io::formats::is_big_endian_host();
+
+                    if (array_info.dtype == io::formats::DataType::UNKNOWN) {
+                        throw std::invalid_argument(
+                            "fileio::write_matrix(): Element type is not supported by binary formats"
+                        );
+                    }
+
+                    MPI_File file = open(
+                        filename, MPI_MODE_CREATE | MPI_MODE_WRONLY, comm
+                    );
+
+                    MPI_File_set_size(file, 0);
+
+                    if (comm.rank() == root) {
+                        std::string header = io::formats::BinaryFormat::encode_header(
+                            array_info
+                        );
+
+                        MPI_File_write_at(
+                            file, 0, header.data(), static_cast<int>(header.size()),
+                            MPI_BYTE, MPI_STATUS_IGNORE
+                        );
+                    }
+
+                    write_block(
+                        file, array_info, matrix.distribution_info(),
+                        matrix.local_matrix()
+                    );
+
+                    close(file);
+                }
+
+                template <typename T>
+                void write_vector(
+                    const std::string& filename,
+                    const containers::VectorMPI<T>& vector,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    io::formats::ArrayInfo array_info;
+
+                    array_info.dtype = io::formats::data_type<T>();
+                    array_info.rows = 1;
+                    array_info.cols = vector.global_size();
+                    array_info.data_offset = io::formats::BinaryFormat::HEADER_SIZE;
+                    array_info.big_endian = io::formats::is_big_endian_host();
+
+                    if (array_info.dtype == io::formats::DataType::UNKNOWN) {
+                        throw std::invalid_argument(
+                            "fileio::write_vector(): Element type is not supported by binary formats"
+                        );
+                    }
+
+                    MPI_File file = open(
+                        filename, MPI_MODE_CREATE | MPI_MODE_WRONLY, comm
+                    );
+
+                    MPI_File_set_size(file, 0);
+
+                    if (comm.rank() == root) {
+                        std::string header = io::formats::BinaryFormat::encode_header(
+                            array_info
+                        );
+
+                        MPI_File_write_at(
+                            file, 0, header.data(), static_cast<int>(header.size()),
+                            MPI_BYTE, MPI_STATUS_IGNORE
+                        );
+                    }
+
+                    write_block(
+                        file, array_info, vector.distribution_info(),
+                        vector.local_vector()
+                    );
+
+                    close(file);
+                }
+
+                // Distributed read methods ( text formats )
+
+                std::string read_line_range(
+                    const std::string& filename,
+                    size_t& line_start,
+                    const communication::Communicator& comm
+                ) {
+                    int comm_rank = comm.rank();
+                    int comm_size = comm.size();
+
+                    MPI_File file = open(filename, MPI_MODE_RDONLY, comm);
+
+                    MPI_Offset file_size = 0;
+                    MPI_File_get_size(file, &file_size);
+
+                    size_t size = static_cast<size_t>(file_size);
+                    size_t block_size = size / comm_size;
+                    size_t remainder = size % comm_size;
+
+                    size_t begin = comm_rank * block_size + std::min<size_t>(
+                        comm_rank, remainder
+                    );
+                    size_t end = begin + block_size + (
+                        static_cast<size_t>(comm_rank) < remainder ? 1 : 0
+                    );
+
+                    // Lines belong to the rank holding their first byte
+
+                    size_t window_begin = begin > 0 ? begin - 1 : 0;
+
+                    std::string window(end - window_begin, '\0');
+                    window.resize(read_bytes(
+                        file, window_begin, window.size(), &window[0]
+                    ));
+
+                    size_t start = begin;
+
+                    if (begin > 0 && window[0] != '\n') {
+                        size_t newline = window.find('\n', 1);
+
+                        start = newline == std::string::npos ? \
+                            end : window_begin + newline + 1;
+                    }
+
+                    std::string text;
+
+                    if (start < end) {
+                        size_t stop = window.find('\n', end - 1 - window_begin);
+
+                        size_t position = window_begin + window.size();
+
+                        const size_t extend_size = 1 << 16;
+
+                        while (stop == std::string::npos && position < size) {
+                            size_t previous = window.size();
+
+                            window.resize(
+                                previous + std::min(extend_size, size - position)
+                            );
+                            window.resize(previous + read_bytes(
+                                file, position, window.size() - previous,
+                                &window[previous]
+                            ));
+
+                            if (window.size() == previous) {
+                                break;
+                            }
+
+                            position += window.size() - previous;
+                            stop = window.find('\n', previous);
+                        }
+
+                        if (stop == std::string::npos) {
+                            stop = window.size();
+                        }
+
+                        text = window.substr(
+                            start - window_begin, stop - (start - window_begin)
+                        );
+                    }
+
+                    close(file);
+
+                    line_start = start;
+
+                    return text;
+                }
+
+                bool has_index(
+                    const std::string& filename,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    int indexed = 0;
+
+                    if (comm.rank() == root) {
+                        indexed = io::RowIndex::exists(filename) ? 1 : 0;
+                    }
+
+                    return comm.broadcast_single(indexed, root) != 0;
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> read_vector_indexed(
+                    const std::string& filename,
+                    distribution::VectorDistributionType dist_type,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    unsigned long long size = 0;
+                    int usable = 0;
+
+                    if (comm.rank() == root) {
+                        try {
+                            io::RowIndex index = io::RowIndex::load(filename);
+
+                            if (!index.field_offsets().empty()) {
+                                size = index.cols();
+                                usable = 1;
+                            } else if (index.cols() == 1) {
+                                size = index.rows();
+                                usable = 1;
+                            }
+                        } catch (...) {
+                            usable = 0;
+                        }
+                    }
+
+                    if (comm.broadcast_single(usable, root) == 0) {
+                        throw std::runtime_error(
+                            "fileio::read_vector_indexed(): Index does not describe a vector: " + filename
+                        );
+                    }
+
+                    size = comm.broadcast_single(size, root);
+
+                    auto dist_info = distribution::vector_distribution_info(
+                        dist_type, static_cast<size_t>(size), comm
+                    );
+
+                    containers::VectorMPI<T> result(comm);
+
+                    result.set_local_vector(
+                        io::load_vector_range<T>(
+                            filename, dist_info.offset,
+                            dist_info.offset + dist_info.local_size
+                        )
+                    );
+                    result.set_dist_info(dist_info);
+
+                    return result;
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> read_matrix_csv(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type,
+                    char delimiter,
+                    bool has_header,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    vmafu::core::Matrix<T> local;
+
+                    bool indexed = has_index(filename, root, comm);
+
+                    int failed = 0;
+                    std::string error;
+
+                    try {
+                        std::string text;
+                        bool skip_header = false;
+
+                        if (indexed) {
+                            io::RowIndex index = io::RowIndex::load(filename);
+
+                            size_t header_rows = has_header ? 1 : 0;
+
+                            auto rows_info = distribution::vector_distribution_info(
+                                distribution::VectorDistributionType::BLOCK,
+                                index.rows() - std::min(index.rows(), header_rows),
+                                comm
+                            );
+
+                            if (rows_info.local_size > 0) {
+                                text = io::internal::read_row_range(
+                                    filename, header_rows + rows_info.offset,
+                                    header_rows + rows_info.offset + rows_info.local_size,
+                                    &index
+                                );
+                            }
+                        } else {
+                            size_t line_start = 0;
+
+                            text = read_line_range(filename, line_start, comm);
+                            skip_header = has_header && line_start == 0;
+                        }
+
+                        io::parsers::CsvParser parser(
+                            delimiter, true, skip_header
+                        );
+
+                        local = io::serializers::MatrixSerializer<T>().deserialize(
+                            parser.parse(text)
+                        );
+                    } catch (const std::exception& e) {
+                        failed = 1;
+                        error = e.what();
+                    }
+
+                    if (comm.allreduce(failed, MPI_MAX) != 0) {
+                        throw std::runtime_error(
+                            "fileio::read_matrix_csv(): Failed to parse " + filename + \
+                            (error.empty() ? std::string() : ": " + error)
+                        );
+                    }
+
+                    size_t local_rows = local.rows();
+                    size_t local_cols = local.cols();
+
+                    size_t row_offset = comm.exscan(local_rows, MPI_SUM);
+                    size_t rows = comm.allreduce(local_rows, MPI_SUM);
+
+                    size_t cols = comm.allreduce(local_cols, MPI_MAX);
+                    size_t min_cols = comm.allreduce(
+                        local_rows > 0 ? local_cols : cols, MPI_MIN
+                    );
+
+                    if (min_cols != cols) {
+                        throw std::runtime_error(
+                            "fileio::read_matrix_csv(): Inconsistent column count in " + filename
+                        );
+                    }
+
+                    auto source_info = row_block_info(
+                        rows, cols, local_rows, row_offset, comm
+                    );
+
+                    auto dist_info = distribution::matrix_distribution_info(
+                        dist_type, rows, cols, comm
+                    );
+
+                    vmafu::core::Matrix<T> target;
+
+                    distribution::redistribute(
+                        source_info, local, dist_info, target, comm
+                    );
+
+                    containers::MatrixMPI<T> result(comm);
+
+                    result.set_local_matrix(std::move(target));
+                    result.set_dist_info(dist_info);
+
+                    return result;
+                }
+
+                // Distributed read methods ( sparse formats )
+
+                template <typename T>
+                vmafu::core::SparseMatrix<T> read_sparse_rows(
+                    const std::string& filename,
+                    distribution::VectorDistributionInfo& row_info,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    int comm_size = comm.size();
+
+                    // The root decodes the header ( comments may be long )
+                    // and broadcasts it in compact form with the data offset
+
+                    io::MarketInfo info;
+                    std::string header;
+
+                    unsigned long long status[3] = {0, 0, 0};
+
+                    if (comm.rank() == root) {
+                        try {
+                            info = io::MatrixMarketFormat::read_info(filename);
+                            header = io::MatrixMarketFormat::encode_header(info);
+
+                            status[0] = 1;
+                            status[1] = info.data_offset;
+                        } catch (const std::exception& e) {
+                            header = e.what();
+                        }
+
+                        status[2] = header.size();
+                    }
+
+                    comm.broadcast(status, 3, root);
+
+                    header.resize(static_cast<size_t>(status[2]));
+
+                    if (!header.empty()) {
+                        comm.broadcast(&header[0], static_cast<int>(header.size()), root);
+                    }
+
+                    if (status[0] == 0) {
+                        throw std::runtime_error(
+                            "fileio::read_sparse_rows(): " + header
+                        );
+                    }
+
+                    if (comm.rank() != root) {
+                        std::istringstream iss(header);
+
+                        info = io::MatrixMarketFormat::decode_header(iss);
+                        info.data_offset = static_cast<size_t>(status[1]);
+                    }
+
+                    // Every rank parses the entry lines starting in its
+                    // byte range of the file
+
+                    std::vector<size_t> row_indices;
+                    std::vector<size_t> col_indices;
+                    std::vector<T> values;
+
+                    size_t count = 0;
+
+                    int failed = 0;
+                    std::string error;
+
+                    try {
+                        size_t line_start = 0;
+
+                        std::string text = read_line_range(filename, line_start, comm);
+
+                        size_t skip = line_start < info.data_offset ? \
+                            std::min(info.data_offset - line_start, text.size()) : 0;
+
+                        count = io::MatrixMarketFormat::parse_entries(
+                            text.data() + skip, text.data() + text.size(),
+                            info, row_indices, col_indices, values
+                        );
+                    } catch (const std::exception& e) {
+                        failed = 1;
+                        error = e.what();
+                    }
+
+                    if (comm.allreduce(failed, MPI_MAX) != 0) {
+                        throw std::runtime_error(
+                            "fileio::read_sparse_rows(): Failed to parse " + filename + \
+                            (error.empty() ? std::string() : ": " + error)
+                        );
+                    }
+
+                    if (comm.allreduce(count, MPI_SUM) != info.entries) {
+                        throw std::runtime_error(
+                            "fileio::read_sparse_rows(): Entry count does not match header in " + filename
+                        );
+                    }
+
+                    // Route every triple to the rank owning its row
+
+                    row_info = distribution::vector_distribution_info(
+                        distribution::VectorDistributionType::BLOCK, info.rows, comm
+                    );
+
+                    std::vector<size_t> offsets(comm_size + 1);
+
+                    comm.allgather(&row_info.offset, offsets.data(), 1);
+                    offsets[comm_size] = info.rows;
+
+                    std::vector<int> owners(values.size());
+                    std::vector<int> send_counts(comm_size, 0);
+
+                    for (size_t k = 0; k < values.size(); k++) {
+                        owners[k] = static_cast<int>(
+                            std::upper_bound(
+                                offsets.begin(), offsets.end(), row_indices[k]
+                            ) - offsets.begin()
+                        ) - 1;
+
+                        send_counts[owners[k]]++;
+                    }
+
+                    std::vector<int> recv_counts(comm_size);
+
+                    comm.alltoall(send_counts.data(), recv_counts.data(), 1);
+
+                    std::vector<int> send_displs(comm_size, 0);
+                    std::vector<int> recv_displs(comm_size, 0);
+
+                    for (int r = 1; r < comm_size; r++) {
+                        send_displs[r] = send_displs[r - 1] + send_counts[r - 1];
+                        recv_displs[r] = recv_displs[r - 1] + recv_counts[r - 1];
+                    }
+
+                    size_t received = static_cast<size_t>(
+                        recv_displs[comm_size - 1] + recv_counts[comm_size - 1]
+                    );
+
+                    std::vector<size_t> send_rows(values.size());
+                    std::vector<size_t> send_cols(values.size());
+                    std::vector<T> send_values(values.size());
+
+                    std::vector<int> next(send_displs);
+
+                    for (size_t k = 0; k < values.size(); k++) {
+                        int position = next[owners[k]]++;
+
+                        send_rows[position] = row_indices[k] - offsets[owners[k]];
+                        send_cols[position] = col_indices[k];
+                        send_values[position] = values[k];
+                    }
+
+                    std::vector<size_t>().swap(row_indices);
+                    std::vector<size_t>().swap(col_indices);
+                    std::vector<T>().swap(values);
+
+                    std::vector<size_t> local_rows(received);
+                    std::vector<size_t> local_cols(received);
+                    std::vector<T> local_values(received);
+
+                    comm.alltoallv(
+                        send_rows.data(), send_counts.data(), send_displs.data(),
+                        local_rows.data(), recv_counts.data(), recv_displs.data()
+                    );
+                    comm.alltoallv(
+                        send_cols.data(), send_counts.data(), send_displs.data(),
+                        local_cols.data(), recv_counts.data(), recv_displs.data()
+                    );
+                    comm.alltoallv(
+                        send_values.data(), send_counts.data(), send_displs.data(),
+                        local_values.data(), recv_counts.data(), recv_displs.data()
+                    );
+
+                    return vmafu::core::SparseMatrix<T>::from_triplets(
+                        row_info.local_size, info.cols,
+                        local_rows, local_cols, local_values
+                    );
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> read_matrix_market(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    distribution::VectorDistributionInfo row_info;
+
+                    vmafu::core::Matrix<T> local = read_sparse_rows<T>(
+                        filename, row_info, root, comm
+                    ).to_dense();
+
+                    auto source_info = row_block_info(
+                        row_info.global_size, local.cols(),
+                        row_info.local_size, row_info.offset, comm
+                    );
+
+                    auto dist_info = distribution::matrix_distribution_info(
+                        dist_type, row_info.global_size, local.cols(), comm
+                    );
+
+                    vmafu::core::Matrix<T> target;
+
+                    distribution::redistribute(
+                        source_info, local, dist_info, target, comm
+                    );
+
+                    containers::MatrixMPI<T> result(comm);
+
+                    result.set_local_matrix(std::move(target));
+                    result.set_dist_info(dist_info);
+
+                    return result;
+                }
+
+                // Streaming read methods ( root-only text input )
+
+                namespace internal {
+                    constexpr int STREAM_DATA_TAG = 1;
+                    constexpr int STREAM_END_TAG = 2;
+
+                    inline int staging_count(int comm_size) {
+                        return comm_size > 1 ? comm_size - 1 : 1;
+                    }
+
+                    inline int staging_rank(int index, int root, int comm_size) {
+                        if (comm_size == 1) {
+                            return root;
+                        }
+
+                        return index < root ? index : index + 1;
+                    }
+
+                    inline int staging_index(int rank, int root, int comm_size) {
+                        if (comm_size == 1) {
+                            return 0;
+                        }
+
+                        if (rank == root) {
+                            return -1;
+                        }
+
+                        return rank < root ? rank : rank - 1;
+                    }
+
+                    template <typename T>
+                    void place_staged_blocks(
+                        const std::vector<T>& staged,
+                        size_t rows,
+                        size_t cols,
+                        size_t block_rows,
+                        int root,
+                        const distribution::MatrixDistributionInfo& dist_info,
+                        vmafu::core::Matrix<T>& target,
+                        const communication::Communicator& comm
+                    ) {
+                        int comm_rank = comm.rank();
+                        int comm_size = comm.size();
+
+                        size_t local_rect[4] = {
+                            dist_info.row_offset, dist_info.col_offset,
+                            dist_info.local_rows, dist_info.local_cols
+                        };
+
+                        vmafu::core::Vector<size_t> all_rects(4 * comm_size);
+
+                        comm.allgather(local_rect, all_rects.data(), 4);
+
+                        int stagers = staging_count(comm_size);
+
+                        // Calls visit(block_begin, block_end, local_row) for
+                        // every row block staged on the given rank
+
+                        auto for_each_block = [&](int rank, auto&& visit) {
+                            int index = staging_index(rank, root, comm_size);
+
+                            if (index < 0) {
+                                return;
+                            }
+
+                            size_t local_row = 0;
+
+                            for (
+                                size_t k = index;
+                                k * block_rows < rows;
+                                k += stagers
+                            ) {
+                                size_t block_end = std::min(
+                                    (k + 1) * block_rows, rows
+                                );
+
+                                visit(k * block_rows, block_end, local_row);
+
+                                local_row += block_end - k * block_rows;
+                            }
+                        };
+
+                        vmafu::core::Vector<int> sendcounts(comm_size, 0);
+                        vmafu::core::Vector<int> sdispls(comm_size, 0);
+                        vmafu::core::Vector<int> recvcounts(comm_size, 0);
+                        vmafu::core::Vector<int> rdispls(comm_size, 0);
+
+                        std::vector<T> send_buffer;
+
+                        for (int p = 0; p < comm_size; p++) {
+                            const size_t* rect = &all_rects[4 * p];
+
+                            size_t before = send_buffer.size();
+
+                            for_each_block(comm_rank, [&](
+                                size_t block_begin, size_t block_end, size_t local_row
+                            ) {
+                                size_t r0 = std::max(block_begin, rect[0]);
+                                size_t r1 = std::min(block_end, rect[0] + rect[2]);
+
+                                for (size_t i = r0; i < r1; i++) {
+                                    const T* row = staged.data() + \
+                                        (local_row + i - block_begin) * cols + rect[1];
+
+                                    send_buffer.insert(
+                                        send_buffer.end(), row, row + rect[3]
+                                    );
+                                }
+                            });
+
+                            if (send_buffer.size() > INT_MAX) {
+                                throw std::invalid_argument(
+                                    "fileio::stream_matrix(): Block exceeds MPI count limits"
+                                );
+                            }
+
+                            sendcounts[p] = static_cast<int>(send_buffer.size() - before);
+                            sdispls[p] = static_cast<int>(before);
+                        }
+
+                        size_t recv_total = 0;
+
+                        for (int q = 0; q < comm_size; q++) {
+                            size_t count = 0;
+
+                            for_each_block(q, [&](
+                                size_t block_begin, size_t block_end, size_t
+                            ) {
+                                size_t r0 = std::max(block_begin, local_rect[0]);
+                                size_t r1 = std::min(
+                                    block_end, local_rect[0] + local_rect[2]
+                                );
+
+                                if (r1 > r0) {
+                                    count += (r1 - r0) * local_rect[3];
+                                }
+                            });
+
+                            if (recv_total + count > INT_MAX) {
+                                throw std::invalid_argument(
+                                    "fileio::stream_matrix(): Block exceeds MPI count limits"
+                                );
+                            }
+
+                            recvcounts[q] = static_cast<int>(count);
+                            rdispls[q] = static_cast<int>(recv_total);
+
+                            recv_total += count;
+                        }
+
+                        std::vector<T> recv_buffer(recv_total);
+
+                        comm.alltoallv(
+                            send_buffer.data(), sendcounts.data(), sdispls.data(),
+                            recv_buffer.data(), recvcounts.data(), rdispls.data()
+                        );
+
+                        target = vmafu::core::Matrix<T>(
+                            dist_info.local_rows, dist_info.local_cols, vmafu::core::uninitialized
+                        );
+
+                        size_t position = 0;
+
+                        for (int q = 0; q < comm_size; q++) {
+                            for_each_block(q, [&](
+                                size_t block_begin, size_t block_end, size_t
+                            ) {
+                                size_t r0 = std::max(block_begin, local_rect[0]);
+                                size_t r1 = std::min(
+                                    block_end, local_rect[0] + local_rect[2]
+                                );
+
+                                for (size_t i = r0; i < r1; i++) {
+                                    std::copy(
+                                        recv_buffer.data() + position,
+                                        recv_buffer.data() + position + local_rect[3],
+                                        &target(i - local_rect[0], 0)
+                                    );
+
+                                    position += local_rect[3];
+                                }
+                            });
+                        }
+                    }
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> stream_matrix(
+                    std::istream& stream,
+                    const io::FormatPtr& format,
+                    const io::ParserPtr& parser,
+                    distribution::MatrixDistributionType dist_type,
+                    size_t block_rows,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    int comm_rank = comm.rank();
+                    int comm_size = comm.size();
+
+                    if (block_rows == 0) {
+                        throw std::invalid_argument(
+                            "fileio::stream_matrix(): Block size must be positive"
+                        );
+                    }
+
+                    MPI_Datatype type = communication::Communicator::mpi_type<T>();
+
+                    int stagers = internal::staging_count(comm_size);
+
+                    std::vector<T> staged;
+
+                    unsigned long long status[3] = {1, 0, 0};
+
+                    if (comm_rank == root) {
+                        std::vector<T> buffers[2];
+                        MPI_Request requests[2] = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+
+                        int current = 0;
+
+                        size_t rows = 0;
+                        size_t cols = 0;
+                        size_t filled = 0;
+                        size_t block_index = 0;
+
+                        auto ship = [&]() {
+                            int dest = internal::staging_rank(
+                                static_cast<int>(block_index % stagers), root, comm_size
+                            );
+
+                            if (dest == root) {
+                                staged.insert(
+                                    staged.end(),
+                                    buffers[current].begin(), buffers[current].end()
+                                );
+                            } else {
+                                MPI_Isend(
+                                    buffers[current].data(),
+                                    static_cast<int>(buffers[current].size()),
+                                    type, dest, internal::STREAM_DATA_TAG,
+                                    comm.get(), &requests[current]
+                                );
+                            }
+
+                            block_index++;
+                            filled = 0;
+
+                            current ^= 1;
+
+                            MPI_Wait(&requests[current], MPI_STATUS_IGNORE);
+                            buffers[current].clear();
+                        };
+
+                        try {
+                            auto serializer = io::serializers::MatrixSerializer<T>();
+
+                            std::string chunk = format->read_chunk(stream, 1 << 16);
+
+                            while (!chunk.empty()) {
+                                vmafu::core::Matrix<T> parsed = serializer.deserialize(
+                                    parser->parse(chunk)
+                                );
+
+                                if (parsed.rows() > 0) {
+                                    if (cols == 0) {
+                                        cols = parsed.cols();
+
+                                        if (block_rows * cols > INT_MAX) {
+                                            throw std::invalid_argument(
+                                                "Block exceeds MPI count limits"
+                                            );
+                                        }
+                                    } else if (parsed.cols() != cols) {
+                                        throw std::runtime_error(
+                                            "Inconsistent column count near row " + \
+                                            std::to_string(rows)
+                                        );
+                                    }
+                                }
+
+                                for (size_t i = 0; i < parsed.rows(); i++) {
+                                    buffers[current].insert(
+                                        buffers[current].end(),
+                                        &parsed(i, 0), &parsed(i, 0) + cols
+                                    );
+
+                                    rows++;
+                                    filled++;
+
+                                    if (filled == block_rows) {
+                                        ship();
+                                    }
+                                }
+
+                                chunk = format->read_chunk(stream, 1 << 16);
+                            }
+
+                            if (filled > 0) {
+                                ship();
+                            }
+                        } catch (const std::exception&) {
+                            status[0] = 0;
+                        }
+
+                        MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+
+                        for (int index = 0; index < stagers; index++) {
+                            int dest = internal::staging_rank(index, root, comm_size);
+
+                            if (dest != root) {
+                                MPI_Send(
+                                    nullptr, 0, type, dest,
+                                    internal::STREAM_END_TAG, comm.get()
+                                );
+                            }
+                        }
+
+                        status[1] = rows;
+                        status[2] = cols;
+                    } else if (internal::staging_index(comm_rank, root, comm_size) >= 0) {
+                        while (true) {
+                            MPI_Status probe;
+                            MPI_Probe(root, MPI_ANY_TAG, comm.get(), &probe);
+
+                            if (probe.MPI_TAG == internal::STREAM_END_TAG) {
+                                MPI_Recv(
+                                    nullptr, 0, type, root,
+                                    internal::STREAM_END_TAG, comm.get(),
+                                    MPI_STATUS_IGNORE
+                                );
+
+                                break;
+                            }
+
+                            int count = 0;
+                            MPI_Get_count(&probe, type, &count);
+
+                            size_t previous = staged.size();
+                            staged.resize(previous + static_cast<size_t>(count));
+
+                            MPI_Recv(
+                                staged.data() + previous, count, type, root,
+                                internal::STREAM_DATA_TAG, comm.get(),
+                                MPI_STATUS_IGNORE
+                            );
+                        }
+                    }
+
+                    comm.broadcast(status, 3, root);
+
+                    if (status[0] == 0) {
+                        throw std::runtime_error(
+                            "fileio::stream_matrix(): Failed to parse input stream"
+                        );
+                    }
+
+                    size_t rows = static_cast<size_t>(status[1]);
+                    size_t cols = static_cast<size_t>(status[2]);
+
+                    auto dist_info = distribution::matrix_distribution_info(
+                        dist_type, rows, cols, comm
+                    );
+
+                    vmafu::core::Matrix<T> local;
+
+                    internal::place_staged_blocks(
+                        staged, rows, cols, block_rows, root, dist_info, local, comm
+                    );
+
+                    containers::MatrixMPI<T> result(comm);
+
+                    result.set_local_matrix(std::move(local));
+                    result.set_dist_info(dist_info);
+
+                    return result;
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> stream_matrix(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type,
+                    size_t block_rows,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    io::FormatPtr format = io::create_format(filename);
+
+                    if (std::dynamic_pointer_cast<io::formats::IBinaryFormat>(format)) {
+                        throw std::invalid_argument(
+                            "fileio::stream_matrix(): Binary files are read with fileio::read_matrix()"
+                        );
+                    }
+
+                    std::ifstream file;
+
+                    int opened = 1;
+
+                    if (comm.rank() == root) {
+                        file.open(filename);
+                        opened = file.is_open() ? 1 : 0;
+                    }
+
+                    if (comm.broadcast_single(opened, root) == 0) {
+                        throw std::runtime_error(
+                            "fileio::stream_matrix(): Cannot open file: " + filename
+                        );
+                    }
+
+                    return stream_matrix<T>(
+                        file, format, io::create_parser(filename),
+                        dist_type, block_rows, root, comm
+                    );
+                }
+
+                // Manifest methods ( sharded mode )
+
+                void write_manifest(
+                    const std::string& filename,
+                    const Manifest& manifest
+                ) {
+                    std::ofstream file(filename);
+                    if (!file.is_open()) {
+                        throw std::runtime_error(
+                            "fileio::write_manifest(): Cannot open file: " + filename
+                        );
+                    }
+
+                    file << "vmafu-manifest 1\n" \
+                         << "kind " << manifest.kind << "\n" \
+                         << "dtype " << io::formats::data_type_name(manifest.dtype) << "\n" \
+                         << "rows " << manifest.rows << "\n" \
+                         << "cols " << manifest.cols << "\n" \
+                         << "distribution " << manifest.distribution << "\n" \
+                         << "shards " << manifest.shards.size() << "\n";
+
+                    for (const auto& shard : manifest.shards) {
+                        file << shard.row_offset << " " << shard.col_offset << " " \
+                             << shard.rows << " " << shard.cols << " " \
+                             << shard.filename << "\n";
+                    }
+
+                    if (!file) {
+                        throw std::runtime_error(
+                            "fileio::write_manifest(): Failed to write file: " + filename
+                        );
+                    }
+                }
+
+                Manifest read_manifest(
+                    const std::string& filename,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    std::string content;
+                    unsigned long long length = 0;
+
+                    bool opened = true;
+
+                    if (comm.rank() == root) {
+                        std::ifstream file(filename);
+
+                        if (file.is_open()) {
+                            std::ostringstream oss;
+                            oss << file.rdbuf();
+
+                            content = oss.str();
+                            length = content.size();
+                        } else {
+                            opened = false;
+                        }
+                    }
+
+                    unsigned long long status[2] = {opened ? 1ULL : 0ULL, length};
+
+                    comm.broadcast(status, 2, root);
+
+                    if (status[0] == 0) {
+                        throw std::runtime_error(
+                            "fileio::read_manifest(): Cannot open file: " + filename
+                        );
+                    }
+
+                    content.resize(static_cast<size_t>(status[1]));
+
+                    if (!content.empty()) {
+                        comm.broadcast(&content[0], static_cast<int>(content.size()), root);
+                    }
+
+                    std::istringstream iss(content);
+
+                    Manifest manifest;
+
+                    std::string key;
+                    std::string dtype;
+                    int version = 0;
+                    size_t shard_count = 0;
+
+                    iss >> key >> version;
+                    if (key != "vmafu-manifest" || version != 1) {
+                        throw std::runtime_error(
+                            "fileio::read_manifest(): Not a vmafu manifest: " + filename
+                        );
+                    }
+
+                    iss >> key >> manifest.kind \
+                        >> key >> dtype \
+                        >> key >> manifest.rows \
+                        >> key >> manifest.cols \
+                        >> key >> manifest.distribution \
+                        >> key >> shard_count;
+
+                    manifest.dtype = io::formats::DataType::UNKNOWN;
+
+                    for (auto candidate : {
+                        io::formats::DataType::INT32, io::formats::DataType::INT64,
+                        io::formats::DataType::FLOAT32, io::formats::DataType::FLOAT64
+                    }) {
+                        if (io::formats::data_type_name(candidate) == dtype) {
+                            manifest.dtype = candidate;
+                        }
+                    }
+
+                    for (size_t i = 0; i < shard_count; i++) {
+                        ShardInfo shard;
+
+                        iss >> shard.row_offset >> shard.col_offset \
+                            >> shard.rows >> shard.cols >> shard.filename;
+
+                        manifest.shards.push_back(shard);
+                    }
+
+                    if (!iss) {
+                        throw std::runtime_error(
+                            "fileio::read_manifest(): Malformed manifest: " + filename
+                        );
+                    }
+
+                    return manifest;
+                }
+
+                std::string shard_filename(
+                    const std::string& manifest_filename,
+                    int rank
+                ) {
+                    std::string base = manifest_filename;
+
+                    size_t slash_pos = base.find_last_of("/\\");
+                    size_t dot_pos = base.find_last_of('.');
+
+                    if (
+                        dot_pos != std::string::npos &&
+                        (slash_pos == std::string::npos || dot_pos > slash_pos)
+                    ) {
+                        base = base.substr(0, dot_pos);
+                    }
+
+                    return base + "." + std::to_string(rank) + ".bin";
+                }
+
+                template <typename T>
+                void read_region(
+                    const std::string& manifest_filename,
+                    const Manifest& manifest,
+                    size_t row_offset,
+                    size_t col_offset,
+                    vmafu::core::Matrix<T>& local
+                ) {
+                    std::string directory;
+
+                    size_t slash_pos = manifest_filename.find_last_of("/\\");
+                    if (slash_pos != std::string::npos) {
+                        directory = manifest_filename.substr(0, slash_pos + 1);
+                    }
+
+                    size_t row_end = row_offset + local.rows();
+                    size_t col_end = col_offset + local.cols();
+
+                    std::vector<char> buffer;
+
+                    for (const auto& shard : manifest.shards) {
+                        size_t r0 = std::max(row_offset, shard.row_offset);
+                        size_t r1 = std::min(row_end, shard.row_offset + shard.rows);
+                        size_t c0 = std::max(col_offset, shard.col_offset);
+                        size_t c1 = std::min(col_end, shard.col_offset + shard.cols);
+
+                        if (r0 >= r1 || c0 >= c1) {
+                            continue;
+                        }
+
+                        std::string path = directory + shard.filename;
+
+                        std::ifstream file(path, std::ios::binary);
+                        if (!file.is_open()) {
+                            throw std::runtime_error(
+                                "fileio::read_region(): Cannot open shard: " + path
+                            );
+                        }
+
+                        char header[io::formats::BinaryFormat::HEADER_SIZE];
+                        file.read(header, io::formats::BinaryFormat::HEADER_SIZE);
+
+                        io::formats::ArrayInfo info = io::formats::BinaryFormat::decode_header(
+                            header
+                        );
+
+                        if (info.rows != shard.rows || info.cols != shard.cols) {
+                            throw std::runtime_error(
+                                "fileio::read_region(): Shard does not match manifest: " + path
+                            );
+                        }
+
+                        size_t element_size = io::formats::data_type_size(info.dtype);
+                        size_t width = c1 - c0;
+
+                        buffer.resize(width * element_size);
+
+                        for (size_t i = r0; i < r1; i++) {
+                            size_t position = info.data_offset + (
+                                (i - shard.row_offset) * shard.cols + (c0 - shard.col_offset)
+                            ) * element_size;
+
+                            file.seekg(static_cast<std::streamoff>(position));
+                            file.read(
+                                buffer.data(),
+                                static_cast<std::streamsize>(buffer.size())
+                            );
+
+                            if (!file) {
+                                throw std::runtime_error(
+                                    "fileio::read_region(): Unexpected end of shard: " + path
+                                );
+                            }
+
+                            io::formats::convert_elements(
+                                buffer.data(), info, width,
+                                &local(i - row_offset, c0 - col_offset)
+                            );
+                        }
+                    }
+                }
+
+                // Sharded write / read methods
+
+                template <typename T>
+                void write_matrix_sharded(
+                    const std::string& filename,
+                    const containers::MatrixMPI<T>& matrix,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    int comm_rank = comm.rank();
+                    int comm_size = comm.size();
+
+                    const auto& info = matrix.distribution_info();
+
+                    std::string shard = shard_filename(filename, comm_rank);
+
+                    vmafu::io::save_matrix(shard, matrix.local_matrix());
+
+                    size_t local_block[4] = {
+                        info.row_offset, info.col_offset,
+                        info.local_rows, info.local_cols
+                    };
+
+                    vmafu::core::Vector<size_t> all_blocks(4 * comm_size);
+
+                    comm.gather(local_block, all_blocks.data(), 4, root);
+
+                    if (comm_rank == root) {
+                        Manifest manifest;
+
+                        manifest.kind = "matrix";
+                        manifest.distribution = distribution_name(info.type);
+                        manifest.dtype = io::formats::data_type<T>();
+                        manifest.rows = info.global_rows;
+                        manifest.cols = info.global_cols;
+
+                        for (int p = 0; p < comm_size; p++) {
+                            std::string name = shard_filename(filename, p);
+
+                            size_t slash_pos = name.find_last_of("/\\");
+                            if (slash_pos != std::string::npos) {
+                                name = name.substr(slash_pos + 1);
+                            }
+
+                            manifest.shards.push_back({
+                                all_blocks[4 * p], all_blocks[4 * p + 1],
+                                all_blocks[4 * p + 2], all_blocks[4 * p + 3],
+                                name
+                            });
+                        }
+
+                        write_manifest(filename, manifest);
+                    }
+
+                    comm.barrier();
+                }
+
+                template <typename T>
+                void write_vector_sharded(
+                    const std::string& filename,
+                    const containers::VectorMPI<T>& vector,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    int comm_rank = comm.rank();
+                    int comm_size = comm.size();
+
+                    const auto& info = vector.distribution_info();
+
+                    std::string shard = shard_filename(filename, comm_rank);
+
+                    vmafu::io::save_vector(shard, vector.local_vector());
+
+                    size_t local_block[2] = {info.offset, info.local_size};
+
+                    vmafu::core::Vector<size_t> all_blocks(2 * comm_size);
+
+                    comm.gather(local_block, all_blocks.data(), 2, root);
+
+                    if (comm_rank == root) {
+                        Manifest manifest;
+
+                        manifest.kind = "vector";
+                        manifest.distribution = distribution_name(info.type);
+                        manifest.dtype = io::formats::data_type<T>();
+                        manifest.rows = 1;
+                        manifest.cols = info.global_size;
+
+                        for (int p = 0; p < comm_size; p++) {
+                            std::string name = shard_filename(filename, p);
+
+                            size_t slash_pos = name.find_last_of("/\\");
+                            if (slash_pos != std::string::npos) {
+                                name = name.substr(slash_pos + 1);
+                            }
+
+                            manifest.shards.push_back({
+                                0, all_blocks[2 * p], 1, all_blocks[2 * p + 1], name
+                            });
+                        }
+
+                        write_manifest(filename, manifest);
+                    }
+
+                    comm.barrier();
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> read_matrix_sharded(
+                    const std::string& filename,
+                    distribution::MatrixDistributionType dist_type,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    Manifest manifest = read_manifest(filename, root, comm);
+
+                    if (manifest.kind != "matrix") {
+                        throw std::runtime_error(
+                            "fileio::read_matrix_sharded(): Manifest does not describe a matrix: " + filename
+                        );
+                    }
+
+                    auto dist_info = distribution::matrix_distribution_info(
+                        dist_type, manifest.rows, manifest.cols, comm
+                    );
+
+                    vmafu::core::Matrix<T> local(
+                        dist_info.local_rows, dist_info.local_cols, vmafu::core::uninitialized
+                    );
+
+                    read_region(
+                        filename, manifest, dist_info.row_offset,
+                        dist_info.col_offset, local
+                    );
+
+                    containers::MatrixMPI<T> result(comm);
+
+                    result.set_local_matrix(std::move(local));
+                    result.set_dist_info(dist_info);
+
+                    return result;
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> read_vector_sharded(
+                    const std::string& filename,
+                    distribution::VectorDistributionType dist_type,
+                    int root,
+                    const communication::Communicator& comm
+                ) {
+                    Manifest manifest = read_manifest(filename, root, comm);
+
+                    if (manifest.kind != "vector") {
+                        throw std::runtime_error(
+                            "fileio::read_vector_sharded(): Manifest does not describe a vector: " + filename
+                        );
+                    }
+
+                    auto dist_info = distribution::vector_distribution_info(
+                        dist_type, manifest.cols, comm
+                    );
+
+                    vmafu::core::Matrix<T> row(1, dist_info.local_size, vmafu::core::uninitialized);
+
+                    read_region(filename, manifest, 0, dist_info.offset, row);
+
+                    vmafu::core::Vector<T> local(dist_info.local_size, vmafu::core::uninitialized);
+                    std::copy(row.begin(), row.end(), local.begin());
+
+                    containers::VectorMPI<T> result(comm);
+
+                    result.set_local_vector(std::move(local));
+                    result.set_dist_info(dist_info);
+
+                    return result;
+                }
+
+                // Checkpoint helper methods
+
+                distribution::MatrixDistributionType matrix_distribution_type(
+                    const std::string& name
+                ) {
+                    for (auto type : {
+                        distribution::MatrixDistributionType::BLOCK_ROWS,
+                        distribution::MatrixDistributionType::BLOCK_COLS,
+                        distribution::MatrixDistributionType::BLOCK_2D,
+                        distribution::MatrixDistributionType::CYCLIC_ROWS,
+                        distribution::MatrixDistributionType::CYCLIC_COLS
+                    }) {
+                        if (distribution_name(type) == name) {
+                            return type;
+                        }
+                    }
+
+                    throw std::runtime_error(
+                        "fileio::matrix_distribution_type(): Unknown distribution: " + name
+                    );
+                }
+
+                distribution::VectorDistributionType vector_distribution_type(
+                    const std::string& name
+                ) {
+                    for (auto type : {
+                        distribution::VectorDistributionType::BLOCK,
+                        distribution::VectorDistributionType::CYCLIC
+                    }) {
+                        if (distribution_name(type) == name) {
+                            return type;
+                        }
+                    }
+
+                    throw std::runtime_error(
+                        "fileio::vector_distribution_type(): Unknown distribution: " + name
+                    );
+                }
+
+                std::string checkpoint_filename(
+                    const std::string& directory,
+                    size_t index,
+                    const std::string& suffix
+                ) {
+                    return directory + "/object" + std::to_string(index) + suffix;
+                }
+
+                void write_dist_info(
+                    const std::string& filename,
+                    const distribution::MatrixDistributionInfo& info
+                ) {
+                    std::ofstream file(filename);
+                    if (!file.is_open()) {
+                        throw std::runtime_error(
+                            "fileio::write_dist_info(): Cannot open file: " + filename
+                        );
+                    }
+
+                    file << "matrix " << distribution_name(info.type) << "\n" \
+                         << info.global_rows << " " << info.global_cols << "\n" \
+                         << info.local_rows << " " << info.local_cols << "\n" \
+                         << info.row_offset << " " << info.col_offset << "\n" \
+                         << info.grid_rows << " " << info.grid_cols << "\n" \
+                         << info.grid_row << " " << info.grid_col << "\n";
+
+                    if (!file) {
+                        throw std::runtime_error(
+                            "fileio::write_dist_info(): Failed to write file: " + filename
+                        );
+                    }
+                }
+
+                void write_dist_info(
+                    const std::string& filename,
+                    const distribution::VectorDistributionInfo& info
+                ) {
+                    std::ofstream file(filename);
+                    if (!file.is_open()) {
+                        throw std::runtime_error(
+                            "fileio::write_dist_info(): Cannot open file: " + filename
+                        );
+                    }
+
+                    file << "vector " << distribution_name(info.type) << "\n" \
+                         << info.global_size << " " << info.local_size << " " \
+                         << info.offset << "\n";
+
+                    if (!file) {
+                        throw std::runtime_error(
+                            "fileio::write_dist_info(): Failed to write file: " + filename
+                        );
+                    }
+                }
+
+                void read_dist_info(
+                    const std::string& filename,
+                    distribution::MatrixDistributionInfo& info
+                ) {
+                    std::ifstream file(filename);
+                    if (!file.is_open()) {
+                        throw std::runtime_error(
+                            "fileio::read_dist_info(): Cannot open file: " + filename
+                        );
+                    }
+
+                    std::string kind;
+                    std::string type;
+
+                    file >> kind >> type \
+                         >> info.global_rows >> info.global_cols \
+                         >> info.local_rows >> info.local_cols \
+                         >> info.row_offset >> info.col_offset \
+                         >> info.grid_rows >> info.grid_cols \
+                         >> info.grid_row >> info.grid_col;
+
+                    if (!file || kind != "matrix") {
+                        throw std::runtime_error(
+                            "fileio::read_dist_info(): Malformed distribution file: " + filename
+                        );
+                    }
+
+                    info.type = matrix_distribution_type(type);
+                }
+
+                void read_dist_info(
+                    const std::string& filename,
+                    distribution::VectorDistributionInfo& info
+                ) {
+                    std::ifstream file(filename);
+                    if (!file.is_open()) {
+                        throw std::runtime_error(
+                            "fileio::read_dist_info(): Cannot open file: " + filename
+                        );
+                    }
+
+                    std::string kind;
+                    std::string type;
+
+                    file >> kind >> type \
+                         >> info.global_size >> info.local_size >> info.offset;
+
+                    if (!file || kind != "vector") {
+                        throw std::runtime_error(
+                            "fileio::read_dist_info(): Malformed distribution file: " + filename
+                        );
+                    }
+
+                    info.type = vector_distribution_type(type);
+                }
+
+                template <typename T>
+                void checkpoint_object(
+                    const std::string& directory,
+                    size_t index,
+                    const containers::MatrixMPI<T>& matrix,
+                    std::ostream& entries
+                ) {
+                    const auto& comm = matrix.communicator();
+
+                    write_dist_info(
+                        checkpoint_filename(
+                            directory, index, "." + std::to_string(comm.rank()) + ".dist"
+                        ),
+                        matrix.distribution_info()
+                    );
+
+                    write_matrix_sharded(
+                        checkpoint_filename(directory, index, ".manifest"),
+                        matrix, 0, comm
+                    );
+
+                    entries << "matrix " \
+                            << io::formats::data_type_name(io::formats::data_type<T>()) << "\n";
+                }
+
+                template <typename T>
+                void checkpoint_object(
+                    const std::string& directory,
+                    size_t index,
+                    const containers::VectorMPI<T>& vector,
+                    std::ostream& entries
+                ) {
+                    const auto& comm = vector.communicator();
+
+                    write_dist_info(
+                        checkpoint_filename(
+                            directory, index, "." + std::to_string(comm.rank()) + ".dist"
+                        ),
+                        vector.distribution_info()
+                    );
+
+                    write_vector_sharded(
+                        checkpoint_filename(directory, index, ".manifest"),
+                        vector, 0, comm
+                    );
+
+                    entries << "vector " \
+                            << io::formats::data_type_name(io::formats::data_type<T>()) << "\n";
+                }
+
+                template <typename T>
+                void check_dtype(size_t index, const std::string& dtype) {
+                    std::string expected = io::formats::data_type_name(
+                        io::formats::data_type<T>()
+                    );
+
+                    if (dtype != expected) {
+                        throw std::runtime_error(
+                            "fileio::restore(): Object " + std::to_string(index) + \
+                            " holds " + dtype + ", not " + expected
+                        );
+                    }
+                }
+
+                inline void check_restored(
+                    int failed,
+                    const std::string& error,
+                    size_t index,
+                    const communication::Communicator& comm
+                ) {
+                    if (comm.allreduce(failed, MPI_MAX) != 0) {
+                        throw std::runtime_error(
+                            "fileio::restore(): Failed to restore object " + \
+                            std::to_string(index) + \
+                            (error.empty() ? std::string() : ": " + error)
+                        );
+                    }
+                }
+
+                template <typename T>
+                void restore_object(
+                    const std::string& directory,
+                    size_t index,
+                    const std::string& kind,
+                    const std::string& dtype,
+                    int saved_ranks,
+                    containers::MatrixMPI<T>& matrix
+                ) {
+                    if (kind != "matrix") {
+                        throw std::runtime_error(
+                            "fileio::restore(): Object " + std::to_string(index) + \
+                            " is a " + kind + ", not a matrix"
+                        );
+                    }
+
+                    check_dtype<T>(index, dtype);
+
+                    const auto& comm = matrix.communicator();
+
+                    std::string manifest = checkpoint_filename(directory, index, ".manifest");
+
+                    if (saved_ranks != comm.size()) {
+                        // Different rank count: every rank pulls its new block
+                        // out of the overlapping old shards
+
+                        Manifest header = read_manifest(manifest, 0, comm);
+
+                        matrix = read_matrix_sharded<T>(
+                            manifest, matrix_distribution_type(header.distribution), 0, comm
+                        );
+
+                        return;
+                    }
+
+                    // Same rank count: the saved block and layout are reused
+                    // as they are, without any communication
+
+                    std::string rank = "." + std::to_string(comm.rank());
+
+                    distribution::MatrixDistributionInfo info;
+                    vmafu::core::Matrix<T> local;
+
+                    int failed = 0;
+                    std::string error;
+
+                    try {
+                        read_dist_info(checkpoint_filename(directory, index, rank + ".dist"), info);
+
+                        local = vmafu::io::load_matrix<T>(shard_filename(manifest, comm.rank()));
+
+                        if (local.rows() != info.local_rows || local.cols() != info.local_cols) {
+                            throw std::runtime_error(
+                                "Shard does not match its distribution: " + \
+                                shard_filename(manifest, comm.rank())
+                            );
+                        }
+                    } catch (const std::exception& e) {
+                        failed = 1;
+                        error = e.what();
+                    }
+
+                    check_restored(failed, error, index, comm);
+
+                    matrix.set_local_matrix(std::move(local));
+                    matrix.set_dist_info(info);
+                }
+
+                template <typename T>
+                void restore_object(
+                    const std::string& directory,
+                    size_t index,
+                    const std::string& kind,
+                    const std::string& dtype,
+                    int saved_ranks,
+                    containers::VectorMPI<T>& vector
+                ) {
+                    if (kind != "vector") {
+                        throw std::runtime_error(
+                            "fileio::restore(): Object " + std::to_string(index) + \
+                            " is a " + kind + ", not a vector"
+                        );
+                    }
+
+                    check_dtype<T>(index, dtype);
+
+                    const auto& comm = vector.communicator();
+
+                    std::string manifest = checkpoint_filename(directory, index, ".manifest");
+
+                    if (saved_ranks != comm.size()) {
+                        Manifest header = read_manifest(manifest, 0, comm);
+
+                        vector = read_vector_sharded<T>(
+                            manifest, vector_distribution_type(header.distribution), 0, comm
+                        );
+
+                        return;
+                    }
+
+                    std::string rank = "." + std::to_string(comm.rank());
+
+                    distribution::VectorDistributionInfo info;
+                    vmafu::core::Vector<T> local;
+
+                    int failed = 0;
+                    std::string error;
+
+                    try {
+                        read_dist_info(checkpoint_filename(directory, index, rank + ".dist"), info);
+
+                        local = vmafu::io::load_vector<T>(shard_filename(manifest, comm.rank()));
+
+                        if (local.size() != info.local_size) {
+                            throw std::runtime_error(
+                                "Shard does not match its distribution: " + \
+                                shard_filename(manifest, comm.rank())
+                            );
+                        }
+                    } catch (const std::exception& e) {
+                        failed = 1;
+                        error = e.what();
+                    }
+
+                    check_restored(failed, error, index, comm);
+
+                    vector.set_local_vector(std::move(local));
+                    vector.set_dist_info(info);
+                }
+
+                // Checkpoint / restart methods
+
+                template <typename... Objects>
+                void checkpoint(
+                    const std::string& directory,
+                    const Objects&... objects
+                ) {
+                    static_assert(
+                        sizeof...(Objects) > 0,
+                        "fileio::checkpoint(): At least one object is required"
+                    );
+
+                    const auto& comm = std::get<0>(std::tie(objects...)).communicator();
+
+                    std::string index_file = directory + "/checkpoint";
+
+                    // The index is dropped first and written last, so a run
+                    // that dies mid-checkpoint never leaves a readable one
+
+                    int created = 1;
+
+                    if (comm.rank() == 0) {
+                        std::error_code error;
+
+                        std::filesystem::create_directories(directory, error);
+                        std::filesystem::remove(index_file, error);
+
+                        created = std::filesystem::is_directory(directory) ? 1 : 0;
+                    }
+
+                    comm.broadcast(&created, 1, 0);
+
+                    if (!created) {
+                        throw std::runtime_error(
+                            "fileio::checkpoint(): Cannot create directory: " + directory
+                        );
+                    }
+
+                    std::ostringstream entries;
+
+                    size_t index = 0;
+
+                    (checkpoint_object(directory, index++, objects, entries), ...);
+
+                    if (comm.rank() == 0) {
+                        std::string temp_file = index_file + ".tmp";
+
+                        std::ofstream file(temp_file);
+
+                        file << "vmafu-checkpoint 1\n" \
+                             << "ranks " << comm.size() << "\n" \
+                             << "objects " << sizeof...(Objects) << "\n" \
+                             << entries.str();
+
+                        file.close();
+
+                        created = file && std::rename(
+                            temp_file.c_str(), index_file.c_str()
+                        ) == 0 ? 1 : 0;
+                    }
+
+                    comm.broadcast(&created, 1, 0);
+
+                    if (!created) {
+                        throw std::runtime_error(
+                            "fileio::checkpoint(): Failed to write index: " + index_file
+                        );
+                    }
+                }
+
+                template <typename... Objects>
+                void restore(
+                    const std::string& directory,
+                    Objects&... objects
+                ) {
+                    static_assert(
+                        sizeof...(Objects) > 0,
+                        "fileio::restore(): At least one object is required"
+                    );
+
+                    const auto& comm = std::get<0>(std::tie(objects...)).communicator();
+
+                    std::string index_file = directory + "/checkpoint";
+
+                    // Rank 0 reads the index and broadcasts it, so every
+                    // rank validates the same text and fails together
+
+                    std::string content;
+                    unsigned long long status[2] = {0, 0};
+
+                    if (comm.rank() == 0) {
+                        std::ifstream source(index_file);
+
+                        if (source.is_open()) {
+                            std::ostringstream oss;
+                            oss << source.rdbuf();
+
+                            content = oss.str();
+                            status[0] = 1;
+                        }
+
+                        status[1] = content.size();
+                    }
+
+                    comm.broadcast(status, 2, 0);
+
+                    if (status[0] == 0) {
+                        throw std::runtime_error(
+                            "fileio::restore(): No checkpoint in directory: " + directory
+                        );
+                    }
+
+                    content.resize(static_cast<size_t>(status[1]));
+
+                    if (!content.empty()) {
+                        comm.broadcast(&content[0], static_cast<int>(content.size()), 0);
+                    }
+
+                    std::istringstream file(content);
+
+                    std::string key;
+                    int version = 0;
+                    int saved_ranks = 0;
+                    size_t object_count = 0;
+
+                    file >> key >> version;
+                    if (key != "vmafu-checkpoint" || version != 1) {
+                        throw std::runtime_error(
+                            "fileio::restore(): Not a vmafu checkpoint: " + index_file
+                        );
+                    }
+
+                    file >> key >> saved_ranks >> key >> object_count;
+
+                    std::vector<std::string> kinds(object_count);
+                    std::vector<std::string> dtypes(object_count);
+
+                    for (size_t i = 0; i < object_count; i++) {
+                        file >> kinds[i] >> dtypes[i];
+                    }
+
+                    if (!file) {
+                        throw std::runtime_error(
+                            "fileio::restore(): Malformed checkpoint index: " + index_file
+                        );
+                    }
+
+                    if (object_count != sizeof...(Objects)) {
+                        throw std::runtime_error(
+                            "fileio::restore(): Checkpoint holds " + \
+                            std::to_string(object_count) + " objects, " + \
+                            std::to_string(sizeof...(Objects)) + " requested"
+                        );
+                    }
+
+                    size_t index = 0;
+
+                    (
+                        (
+                            restore_object(
+                                directory, index, kinds[index], dtypes[index],
+                                saved_ranks, objects
+                            ),
+                            index++
+                        ),
+                        ...
+                    );
+                }
+            }
+        }
+    }
+}
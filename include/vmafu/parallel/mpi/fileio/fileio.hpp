@@ -0,0 +1,7 @@
+// parallel/mpi/fileio/fileio.hpp
+
+
+#pragma once
+
+
+#include "_fileio.hpp"
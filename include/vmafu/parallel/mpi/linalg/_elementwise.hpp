@@ -0,0 +1,167 @@
+// parallel/mpi/linalg/_elementwise.hpp
+
+
+#pragma once
+
+
+#include <string>
+#include <functional>
+#include <stdexcept>
+
+#include "../../../core/core.hpp"
+#include "../../../linalg/_operations.hpp"
+
+#include "../containers/_VectorMPI.hpp"
+#include "../containers/_MatrixMPI.hpp"
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Element-wise operations on identically distributed
+                // operands: each rank works on its local block only, no
+                // communication
+
+                // VectorMPI operations
+
+                template <typename T>
+                containers::VectorMPI<T> operator+(
+                    const containers::VectorMPI<T>& lhs,
+                    const containers::VectorMPI<T>& rhs
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> operator-(
+                    const containers::VectorMPI<T>& lhs,
+                    const containers::VectorMPI<T>& rhs
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> operator-(
+                    const containers::VectorMPI<T>& vector
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> operator*(
+                    const containers::VectorMPI<T>& vector,
+                    const typename containers::VectorMPI<T>::value_type& scalar
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> operator*(
+                    const typename containers::VectorMPI<T>::value_type& scalar,
+                    const containers::VectorMPI<T>& vector
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> operator/(
+                    const containers::VectorMPI<T>& vector,
+                    const typename containers::VectorMPI<T>::value_type& scalar
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> hadamard(
+                    const containers::VectorMPI<T>& lhs,
+                    const containers::VectorMPI<T>& rhs
+                );
+
+                // MatrixMPI operations
+
+                template <typename T>
+                containers::MatrixMPI<T> operator+(
+                    const containers::MatrixMPI<T>& lhs,
+                    const containers::MatrixMPI<T>& rhs
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> operator-(
+                    const containers::MatrixMPI<T>& lhs,
+                    const containers::MatrixMPI<T>& rhs
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> operator-(
+                    const containers::MatrixMPI<T>& matrix
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> operator*(
+                    const containers::MatrixMPI<T>& matrix,
+                    const typename containers::MatrixMPI<T>::value_type& scalar
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> operator*(
+                    const typename containers::MatrixMPI<T>::value_type& scalar,
+                    const containers::MatrixMPI<T>& matrix
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> operator/(
+                    const containers::MatrixMPI<T>& matrix,
+                    const typename containers::MatrixMPI<T>::value_type& scalar
+                );
+
+                template <typename T>
+                containers::MatrixMPI<T> hadamard(
+                    const containers::MatrixMPI<T>& lhs,
+                    const containers::MatrixMPI<T>& rhs
+                );
+
+                // In-place updates ( no allocation )
+
+                // y = alpha * x + y
+
+                template <typename T>
+                void axpy(
+                    const typename containers::VectorMPI<T>::value_type& alpha,
+                    const containers::VectorMPI<T>& x,
+                    containers::VectorMPI<T>& y
+                );
+
+                template <typename T>
+                void axpy(
+                    const typename containers::MatrixMPI<T>::value_type& alpha,
+                    const containers::MatrixMPI<T>& x,
+                    containers::MatrixMPI<T>& y
+                );
+
+                // y = alpha * x + beta * y
+
+                template <typename T>
+                void axpby(
+                    const typename containers::VectorMPI<T>::value_type& alpha,
+                    const containers::VectorMPI<T>& x,
+                    const typename containers::VectorMPI<T>::value_type& beta,
+                    containers::VectorMPI<T>& y
+                );
+
+                template <typename T>
+                void axpby(
+                    const typename containers::MatrixMPI<T>::value_type& alpha,
+                    const containers::MatrixMPI<T>& x,
+                    const typename containers::MatrixMPI<T>::value_type& beta,
+                    containers::MatrixMPI<T>& y
+                );
+
+                // x = alpha * x
+
+                template <typename T>
+                void scale(
+                    const typename containers::VectorMPI<T>::value_type& alpha,
+                    containers::VectorMPI<T>& x
+                );
+
+                template <typename T>
+                void scale(
+                    const typename containers::MatrixMPI<T>::value_type& alpha,
+                    containers::MatrixMPI<T>& x
+                );
+            }
+        }
+    }
+}
+
+
+#include "detail/_elementwise.ipp"
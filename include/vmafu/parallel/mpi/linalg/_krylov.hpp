@@ -0,0 +1,169 @@
+// parallel/mpi/linalg/_krylov.hpp
+
+
+#pragma once
+
+
+#include <mpi.h>
+#include <cmath>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../communication/_communication.hpp"
+#include "../distribution/_distribution.hpp"
+#include "../containers/_VectorMPI.hpp"
+#include "../containers/_MatrixMPI.hpp"
+#include "../containers/_SparseMatrixMPI.hpp"
+#include "../utils/_timing.hpp"
+
+#include "_operations.hpp"
+#include "_elementwise.hpp"
+#include "_reductions.hpp"
+#include "_preconditioners.hpp"
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Solver structs
+
+                struct SolverOptions {
+                    size_t max_iterations = 1000;
+
+                    // Stop once ||b - A x|| <= tolerance * ||b||
+
+                    double tolerance = 1e-8;
+
+                    // GMRES restart length
+
+                    size_t restart = 30;
+                };
+
+                // Local wall time per phase, in seconds
+
+                struct SolverTimings {
+                    double matvec = 0.0;
+                    double preconditioner = 0.0;
+                    double reduction = 0.0;
+                    double update = 0.0;
+
+                    double total = 0.0;
+                };
+
+                template <typename T>
+                struct SolverResult {
+                    bool converged = false;
+
+                    size_t iterations = 0;
+
+                    T residual_norm = T(0);
+
+                    // Residual norm before the first and after every
+                    // iteration ( GMRES: the least-squares estimate )
+
+                    std::vector<T> residual_history;
+
+                    SolverTimings timings;
+                };
+
+                // Krylov solvers for A x = b. A is a MatrixMPI, a
+                // SparseMatrixMPI, a LinearOperatorMPI or any type with
+                // apply(const VectorMPI<T>&, VectorMPI<T>&) const; b and x
+                // use the BLOCK row split of A. x holds the initial guess
+                // on entry. M is any preconditioner with the same apply().
+                // A dense MatrixMPI in BLOCK_COLS or BLOCK_2D is copied to
+                // BLOCK_ROWS once per solve ( O(N^2 / p) memory and one
+                // alltoallv ), so each matvec only allgathers x
+
+                // Conjugate gradients ( SPD ), Chronopoulos-Gear form: one
+                // fused allreduce per iteration
+
+                template <typename Operator, typename T, typename Preconditioner>
+                SolverResult<T> solve_cg(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const Preconditioner& M,
+                    const SolverOptions& options = SolverOptions()
+                );
+
+                template <typename Operator, typename T>
+                SolverResult<T> solve_cg(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const SolverOptions& options = SolverOptions()
+                );
+
+                // Pipelined conjugate gradients ( Ghysels-Vanroose ): the
+                // iteration's only allreduce is non-blocking and overlaps
+                // the preconditioner and the matvec. Needs a few more
+                // vectors and is slightly less stable than solve_cg
+
+                template <typename Operator, typename T, typename Preconditioner>
+                SolverResult<T> solve_pipelined_cg(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const Preconditioner& M,
+                    const SolverOptions& options = SolverOptions()
+                );
+
+                template <typename Operator, typename T>
+                SolverResult<T> solve_pipelined_cg(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const SolverOptions& options = SolverOptions()
+                );
+
+                // BiCGStab ( right preconditioned ), two fused allreduces
+                // per iteration
+
+                template <typename Operator, typename T, typename Preconditioner>
+                SolverResult<T> solve_bicgstab(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const Preconditioner& M,
+                    const SolverOptions& options = SolverOptions()
+                );
+
+                template <typename Operator, typename T>
+                SolverResult<T> solve_bicgstab(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const SolverOptions& options = SolverOptions()
+                );
+
+                // Restarted GMRES(options.restart) ( right preconditioned ),
+                // classical Gram-Schmidt with one reorthogonalization: two
+                // fused allreduces per Arnoldi step
+
+                template <typename Operator, typename T, typename Preconditioner>
+                SolverResult<T> solve_gmres(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const Preconditioner& M,
+                    const SolverOptions& options = SolverOptions()
+                );
+
+                template <typename Operator, typename T>
+                SolverResult<T> solve_gmres(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const SolverOptions& options = SolverOptions()
+                );
+            }
+        }
+    }
+}
+
+
+#include "detail/_krylov.ipp"
@@ -0,0 +1,132 @@
+// parallel/mpi/linalg/_linear_operator.hpp
+
+
+#pragma once
+
+
+#include <mpi.h>
+#include <memory>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+
+#include "../../../core/_Vector.hpp"
+#include "../../../utils/_parallel_for.hpp"
+#include "../../../linalg/_linear_operator.hpp"
+
+#include "../communication/_communication.hpp"
+#include "../distribution/_distribution.hpp"
+#include "../containers/_VectorMPI.hpp"
+#include "../containers/_MatrixMPI.hpp"
+#include "../containers/_SparseMatrixMPI.hpp"
+
+#include "_operations.hpp"
+#include "_elementwise.hpp"
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Distributed matrix-free operator, y = A x ( and optionally
+                // y = A^T x ). Outputs use the operator's row ( column )
+                // distribution, BLOCK unless the wrapped matrix says
+                // otherwise, and are sized before the callable runs. The
+                // adapters keep a reference to the wrapped matrix, which
+                // must outlive the operator
+
+                template <typename T>
+                class LinearOperatorMPI {
+                    private:
+                        size_t _rows;
+                        size_t _cols;
+
+                        distribution::VectorDistributionInfo _row_info;
+                        distribution::VectorDistributionInfo _col_info;
+
+                        communication::Communicator _comm;
+
+                        std::function<void(const containers::VectorMPI<T>&, containers::VectorMPI<T>&)> _apply;
+                        std::function<void(const containers::VectorMPI<T>&, containers::VectorMPI<T>&)> _apply_transpose;
+
+                        // Helper method
+
+                        void _prepare_output(
+                            const distribution::VectorDistributionInfo& info,
+                            containers::VectorMPI<T>& y
+                        ) const;
+
+                    public:
+                        // Types
+
+                        using value_type = T;
+
+                        // Constructors
+
+                        LinearOperatorMPI();
+
+                        LinearOperatorMPI(
+                            size_t rows,
+                            size_t cols,
+                            std::function<void(const containers::VectorMPI<T>&, containers::VectorMPI<T>&)> apply,
+                            std::function<void(const containers::VectorMPI<T>&, containers::VectorMPI<T>&)> apply_transpose = nullptr,
+                            const communication::Communicator& comm = communication::world()
+                        );
+
+                        // Getters
+
+                        size_t rows() const noexcept;
+                        size_t cols() const noexcept;
+
+                        const distribution::VectorDistributionInfo& row_info() const noexcept;
+                        const distribution::VectorDistributionInfo& column_info() const noexcept;
+                        const communication::Communicator& communicator() const noexcept;
+
+                        bool has_transpose() const noexcept;
+
+                        // Apply methods
+
+                        void apply(
+                            const containers::VectorMPI<T>& x,
+                            containers::VectorMPI<T>& y
+                        ) const;
+
+                        containers::VectorMPI<T> apply(const containers::VectorMPI<T>& x) const;
+
+                        void apply_transpose(
+                            const containers::VectorMPI<T>& x,
+                            containers::VectorMPI<T>& y
+                        ) const;
+
+                        containers::VectorMPI<T> apply_transpose(const containers::VectorMPI<T>& x) const;
+
+                        // Operator with apply and apply_transpose swapped
+
+                        LinearOperatorMPI transpose() const;
+
+                        // Static methods ( adapters )
+
+                        static LinearOperatorMPI from_matrix(const containers::MatrixMPI<T>& matrix);
+                        static LinearOperatorMPI from_sparse(const containers::SparseMatrixMPI<T>& matrix);
+
+                        // A(i, j) = entry(i, j) computed on every product for
+                        // the owned rows; x is allgathered, so memory per
+                        // rank is O(rows + cols). One thread per rank by
+                        // default, like the other local kernels under MPI
+
+                        template <typename Entry>
+                        static LinearOperatorMPI from_entries(
+                            size_t rows,
+                            size_t cols,
+                            const Entry& entry,
+                            const communication::Communicator& comm = communication::world(),
+                            size_t threads = 1
+                        );
+                };
+            }
+        }
+    }
+}
+
+
+#include "detail/_linear_operator.ipp"
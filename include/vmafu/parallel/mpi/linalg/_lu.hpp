@@ -0,0 +1,91 @@
+// parallel/mpi/linalg/_lu.hpp
+
+
+#pragma once
+
+
+#include <mpi.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "../../../core/_Vector.hpp"
+#include "../../../core/_Matrix.hpp"
+#include "../../../linalg/_blas.hpp"
+
+#include "../communication/_communication.hpp"
+#include "../distribution/_distribution.hpp"
+#include "../containers/_VectorMPI.hpp"
+#include "../containers/_MatrixMPI.hpp"
+
+#include "_elementwise.hpp"
+#include "_linear_operator.hpp"
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Distributed P A = L U, packed in factors with the
+                // distribution of the input. pivots is replicated on every
+                // rank: step i exchanged global rows i and pivots[i]
+
+                template <typename T>
+                struct LUDecompositionMPI {
+                    containers::MatrixMPI<T> factors;
+
+                    std::vector<size_t> pivots;
+
+                    bool singular = false;
+
+                    // det(P) = +-1
+
+                    int permutation_sign() const noexcept;
+                };
+
+                // Right-looking blocked LU with partial pivoting on the
+                // process grid of a BLOCK_ROWS, BLOCK_COLS or BLOCK_2D
+                // matrix. A panel never crosses a process row or column
+                // boundary: the owning process column factors it ( one
+                // pivot search per column over the process column ), the
+                // L panel is broadcast along process rows, U12 along
+                // process columns, and each rank applies one local GEMM to
+                // its part of the trailing matrix
+
+                template <typename T>
+                LUDecompositionMPI<T> lu(
+                    const containers::MatrixMPI<T>& matrix,
+                    size_t block_size = 64
+                );
+
+                // Solve methods; x is assembled on every rank during the
+                // substitutions ( O(n) memory ) and returned in the
+                // distribution of rhs
+
+                template <typename T>
+                containers::VectorMPI<T> solve(
+                    const LUDecompositionMPI<T>& decomposition,
+                    const containers::VectorMPI<T>& rhs
+                );
+
+                template <typename T>
+                containers::VectorMPI<T> solve(
+                    const containers::MatrixMPI<T>& matrix,
+                    const containers::VectorMPI<T>& rhs
+                );
+
+                // Determinant methods
+
+                template <typename T>
+                T det(const LUDecompositionMPI<T>& decomposition);
+
+                template <typename T>
+                T det(const containers::MatrixMPI<T>& matrix);
+            }
+        }
+    }
+}
+
+
+#include "detail/_lu.ipp"
@@ -6,13 +6,14 @@
 
 #include <cmath>
 
-#include "../../../core/_Vector.hpp"
-#include "../../../core/_Matrix.hpp"
+#include "../../../core/core.hpp"
+#include "../../../linalg/_operations.hpp"
 
 #include "../communication/_communication.hpp"
 #include "../distribution/_distribution.hpp"
 #include "../containers/_VectorMPI.hpp"
 #include "../containers/_MatrixMPI.hpp"
+#include "../containers/_SparseMatrixMPI.hpp"
 
 
 namespace vmafu {
@@ -42,6 +43,14 @@ namespace vmafu {
                     int root = 0,
                     const communication::Communicator& comm = communication::world()
                 );
+
+                // Sparse product with halo exchange ( no root involvement )
+
+                template <typename T>
+                containers::VectorMPI<T> multiply(
+                    const containers::SparseMatrixMPI<T>& A,
+                    const containers::VectorMPI<T>& x
+                );
             }
         }
     }
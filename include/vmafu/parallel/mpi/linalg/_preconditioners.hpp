@@ -0,0 +1,135 @@
+// parallel/mpi/linalg/_preconditioners.hpp
+
+
+#pragma once
+
+
+#include <mpi.h>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+
+#include "../../../core/_Vector.hpp"
+#include "../../../core/_Matrix.hpp"
+
+#include "../communication/_communication.hpp"
+#include "../distribution/_distribution.hpp"
+#include "../containers/_VectorMPI.hpp"
+#include "../containers/_MatrixMPI.hpp"
+#include "../containers/_SparseMatrixMPI.hpp"
+
+#include "_elementwise.hpp"
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Preconditioners for the Krylov solvers. Each one works on
+                // the rows a rank owns ( BLOCK distribution of the square
+                // operator ), so apply() never communicates
+
+                template <typename T>
+                class IdentityPreconditioner {
+                    public:
+                        // Apply method ( z = r )
+
+                        void apply(
+                            const containers::VectorMPI<T>& r,
+                            containers::VectorMPI<T>& z
+                        ) const;
+                };
+
+                template <typename T>
+                class JacobiPreconditioner {
+                    private:
+                        vmafu::core::Vector<T> _inverse_diagonal;
+
+                        // Helper method
+
+                        void _invert(
+                            const vmafu::core::Vector<T>& diagonal,
+                            const communication::Communicator& comm
+                        );
+
+                    public:
+                        // Constructors
+
+                        JacobiPreconditioner();
+
+                        explicit JacobiPreconditioner(const containers::MatrixMPI<T>& A);
+                        explicit JacobiPreconditioner(const containers::SparseMatrixMPI<T>& A);
+                        explicit JacobiPreconditioner(const containers::VectorMPI<T>& diagonal);
+
+                        // Getter
+
+                        const vmafu::core::Vector<T>& inverse_diagonal() const noexcept;
+
+                        // Apply method ( z = D^-1 r )
+
+                        void apply(
+                            const containers::VectorMPI<T>& r,
+                            containers::VectorMPI<T>& z
+                        ) const;
+                };
+
+                // Dense LU ( partial pivoting ) of consecutive diagonal
+                // blocks of block_size owned rows; block_size = 0 takes the
+                // whole local diagonal block of each rank
+
+                template <typename T>
+                class BlockJacobiPreconditioner {
+                    private:
+                        size_t _block_size;
+                        size_t _local_size;
+
+                        std::vector<T> _factors;
+                        std::vector<size_t> _pivots;
+
+                        // Helper methods
+
+                        size_t _block_rows(size_t block) const noexcept;
+
+                        void _factorize(const communication::Communicator& comm);
+
+                    public:
+                        // Constants
+
+                        static constexpr size_t DEFAULT_BLOCK_SIZE = 64;
+
+                        // Constructors
+
+                        BlockJacobiPreconditioner();
+
+                        explicit BlockJacobiPreconditioner(
+                            const containers::MatrixMPI<T>& A,
+                            size_t block_size = DEFAULT_BLOCK_SIZE
+                        );
+
+                        explicit BlockJacobiPreconditioner(
+                            const containers::SparseMatrixMPI<T>& A,
+                            size_t block_size = DEFAULT_BLOCK_SIZE
+                        );
+
+                        // Getters
+
+                        size_t block_size() const noexcept;
+                        size_t block_count() const noexcept;
+
+                        // Apply method ( z = blockdiag(A)^-1 r )
+
+                        void apply(
+                            const containers::VectorMPI<T>& r,
+                            containers::VectorMPI<T>& z
+                        ) const;
+                };
+            }
+        }
+    }
+}
+
+
+#include "detail/_preconditioners.ipp"
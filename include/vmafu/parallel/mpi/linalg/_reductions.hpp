@@ -0,0 +1,159 @@
+// parallel/mpi/linalg/_reductions.hpp
+
+
+#pragma once
+
+
+#include <mpi.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+#include "../communication/_communication.hpp"
+#include "../containers/_VectorMPI.hpp"
+#include "../containers/_MatrixMPI.hpp"
+
+#include "_elementwise.hpp"
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Global reductions: one local pass, then a single
+                // allreduce of one scalar
+
+                // VectorMPI reductions
+
+                template <typename T>
+                T dot(
+                    const containers::VectorMPI<T>& x,
+                    const containers::VectorMPI<T>& y
+                );
+
+                template <typename T>
+                T sum(const containers::VectorMPI<T>& x);
+
+                template <typename T>
+                T max(const containers::VectorMPI<T>& x);
+
+                template <typename T>
+                T norm1(const containers::VectorMPI<T>& x);
+
+                template <typename T>
+                T norm2(const containers::VectorMPI<T>& x);
+
+                template <typename T>
+                T norm_inf(const containers::VectorMPI<T>& x);
+
+                // MatrixMPI reductions ( dot is the Frobenius inner product )
+
+                template <typename T>
+                T dot(
+                    const containers::MatrixMPI<T>& A,
+                    const containers::MatrixMPI<T>& B
+                );
+
+                template <typename T>
+                T sum(const containers::MatrixMPI<T>& A);
+
+                template <typename T>
+                T max(const containers::MatrixMPI<T>& A);
+
+                template <typename T>
+                T norm_frobenius(const containers::MatrixMPI<T>& A);
+
+                // Fused reductions: queue several sum-type partials, then
+                // reduce them all in one collective, e.g. the k dot products
+                // of a Gram-Schmidt step
+
+                template <typename T>
+                class FusedReduction {
+                    private:
+                        communication::Communicator _comm;
+
+                        std::vector<T> _local;
+                        std::vector<T> _global;
+
+                        MPI_Request _request;
+
+                        bool _computed;
+
+                        // Helper method
+
+                        size_t _push(const T& value);
+
+                    public:
+                        // Constructors / Destructor
+
+                        FusedReduction(
+                            const communication::Communicator& comm = communication::world()
+                        );
+
+                        // Completes a reduction still in flight: MPI writes
+                        // into the buffers until the request is waited on
+
+                        ~FusedReduction();
+
+                        // Copy / Move operators ( a move takes over the
+                        // request and leaves the source empty )
+
+                        FusedReduction(const FusedReduction&) = delete;
+                        FusedReduction& operator=(const FusedReduction&) = delete;
+
+                        FusedReduction(FusedReduction&& other) noexcept;
+                        FusedReduction& operator=(FusedReduction&& other) noexcept;
+
+                        // Queue methods ( local work only, return a slot )
+
+                        size_t dot(
+                            const containers::VectorMPI<T>& x,
+                            const containers::VectorMPI<T>& y
+                        );
+
+                        size_t sum(const containers::VectorMPI<T>& x);
+                        size_t norm1(const containers::VectorMPI<T>& x);
+                        size_t squared_norm2(const containers::VectorMPI<T>& x);
+
+                        // Caller-computed local partial
+
+                        size_t add(const T& local_value);
+
+                        // Reduction methods
+
+                        void compute();
+
+                        // Non-blocking form of compute(): queued partials
+                        // are reduced while the caller keeps working, the
+                        // slots are readable after wait()
+
+                        void start();
+                        void wait();
+
+                        void clear();
+
+                        // Getters
+
+                        T operator[](size_t slot) const;
+
+                        size_t size() const noexcept;
+                        bool computed() const noexcept;
+                };
+
+                // Dot products of y against every basis vector in one
+                // collective
+
+                template <typename T>
+                std::vector<T> dots(
+                    const std::vector<containers::VectorMPI<T>>& basis,
+                    const containers::VectorMPI<T>& y
+                );
+            }
+        }
+    }
+}
+
+
+#include "detail/_reductions.ipp"
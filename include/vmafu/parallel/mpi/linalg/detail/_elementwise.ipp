@@ -0,0 +1,392 @@
+// parallel/mpi/linalg/detail/_elementwise.ipp
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Helper methods
+
+                namespace internal {
+                    template <typename T>
+                    bool same_distribution(
+                        const containers::VectorMPI<T>& lhs,
+                        const containers::VectorMPI<T>& rhs
+                    ) noexcept {
+                        const distribution::VectorDistributionInfo& l = lhs.distribution_info();
+                        const distribution::VectorDistributionInfo& r = rhs.distribution_info();
+
+                        return l.global_size == r.global_size && \
+                            l.offset == r.offset && \
+                            lhs.local_size() == rhs.local_size();
+                    }
+
+                    template <typename T>
+                    bool same_distribution(
+                        const containers::MatrixMPI<T>& lhs,
+                        const containers::MatrixMPI<T>& rhs
+                    ) noexcept {
+                        const distribution::MatrixDistributionInfo& l = lhs.distribution_info();
+                        const distribution::MatrixDistributionInfo& r = rhs.distribution_info();
+
+                        return l.global_rows == r.global_rows && \
+                            l.global_cols == r.global_cols && \
+                            l.row_offset == r.row_offset && \
+                            l.col_offset == r.col_offset && \
+                            lhs.local_rows() == rhs.local_rows() && \
+                            lhs.local_cols() == rhs.local_cols();
+                    }
+
+                    template <typename Container>
+                    void check_distribution(
+                        const Container& lhs,
+                        const Container& rhs,
+                        const char* caller
+                    ) {
+                        if (!same_distribution(lhs, rhs)) {
+                            throw std::invalid_argument(
+                                std::string(caller) + ": Operands must be identically distributed"
+                            );
+                        }
+                    }
+
+                    // Local storage as one contiguous array
+
+                    template <typename T>
+                    T* local_data(containers::VectorMPI<T>& vector) noexcept {
+                        return vector.local_vector().data();
+                    }
+
+                    template <typename T>
+                    const T* local_data(const containers::VectorMPI<T>& vector) noexcept {
+                        return vector.local_vector().data();
+                    }
+
+                    template <typename T>
+                    size_t local_count(const containers::VectorMPI<T>& vector) noexcept {
+                        return vector.local_vector().size();
+                    }
+
+                    template <typename T>
+                    T* local_data(containers::MatrixMPI<T>& matrix) noexcept {
+                        return matrix.local_matrix().data();
+                    }
+
+                    template <typename T>
+                    const T* local_data(const containers::MatrixMPI<T>& matrix) noexcept {
+                        return matrix.local_matrix().data();
+                    }
+
+                    template <typename T>
+                    size_t local_count(const containers::MatrixMPI<T>& matrix) noexcept {
+                        return matrix.local_matrix().storage_size();
+                    }
+
+                    // Same distribution, uninitialized local block
+
+                    template <typename T>
+                    containers::VectorMPI<T> empty_like(
+                        const containers::VectorMPI<T>& vector
+                    ) {
+                        containers::VectorMPI<T> result(vector.communicator());
+
+                        result.set_dist_info(vector.distribution_info());
+                        result.set_local_vector(vmafu::core::Vector<T>(
+                            vector.local_size(), vmafu::core::uninitialized
+                        ));
+
+                        return result;
+                    }
+
+                    template <typename T>
+                    containers::MatrixMPI<T> empty_like(
+                        const containers::MatrixMPI<T>& matrix
+                    ) {
+                        containers::MatrixMPI<T> result(matrix.communicator());
+
+                        result.set_dist_info(matrix.distribution_info());
+                        result.set_local_matrix(vmafu::core::Matrix<T>(
+                            matrix.local_rows(), matrix.local_cols(),
+                            vmafu::core::uninitialized
+                        ));
+
+                        return result;
+                    }
+
+                    // Single pass over the local blocks; plain contiguous
+                    // loops, so the compiler vectorizes them
+
+                    template <typename Container, typename Operation>
+                    Container transform(
+                        const Container& lhs,
+                        const Container& rhs,
+                        Operation operation,
+                        const char* name
+                    ) {
+                        check_distribution(lhs, rhs, name);
+
+                        Container result = empty_like(lhs);
+
+                        const auto* l = local_data(lhs);
+                        const auto* r = local_data(rhs);
+                        auto* output = local_data(result);
+
+                        size_t count = local_count(lhs);
+
+                        for (size_t i = 0; i < count; i++) {
+                            output[i] = operation(l[i], r[i]);
+                        }
+
+                        return result;
+                    }
+
+                    template <typename Container, typename Operation>
+                    Container transform(
+                        const Container& source,
+                        Operation operation
+                    ) {
+                        Container result = empty_like(source);
+
+                        const auto* input = local_data(source);
+                        auto* output = local_data(result);
+
+                        size_t count = local_count(source);
+
+                        for (size_t i = 0; i < count; i++) {
+                            output[i] = operation(input[i]);
+                        }
+
+                        return result;
+                    }
+
+                    template <typename Container, typename T>
+                    void update(
+                        const T& alpha,
+                        const Container& x,
+                        const T& beta,
+                        Container& y,
+                        const char* name
+                    ) {
+                        check_distribution(x, y, name);
+
+                        const T* input = local_data(x);
+                        T* output = local_data(y);
+
+                        size_t count = local_count(y);
+
+                        if (beta == T(1)) {
+                            for (size_t i = 0; i < count; i++) {
+                                output[i] += alpha * input[i];
+                            }
+                        } else if (beta == T(0)) {
+                            for (size_t i = 0; i < count; i++) {
+                                output[i] = alpha * input[i];
+                            }
+                        } else {
+                            for (size_t i = 0; i < count; i++) {
+                                output[i] = alpha * input[i] + beta * output[i];
+                            }
+                        }
+                    }
+
+                    template <typename Container, typename T>
+                    void scale(const T& alpha, Container& x) {
+                        T* data = local_data(x);
+
+                        size_t count = local_count(x);
+
+                        for (size_t i = 0; i < count; i++) {
+                            data[i] *= alpha;
+                        }
+                    }
+                }
+
+                // VectorMPI operations
+
+                template <typename T>
+                containers::VectorMPI<T> operator+(
+                    const containers::VectorMPI<T>& lhs,
+                    const containers::VectorMPI<T>& rhs
+                ) {
+                    return internal::transform(lhs, rhs, std::plus<T>(), "linalg::operator+()");
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> operator-(
+                    const containers::VectorMPI<T>& lhs,
+                    const containers::VectorMPI<T>& rhs
+                ) {
+                    return internal::transform(lhs, rhs, std::minus<T>(), "linalg::operator-()");
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> operator-(
+                    const containers::VectorMPI<T>& vector
+                ) {
+                    return internal::transform(vector, std::negate<T>());
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> operator*(
+                    const containers::VectorMPI<T>& vector,
+                    const typename containers::VectorMPI<T>::value_type& scalar
+                ) {
+                    return internal::transform(
+                        vector, [scalar](const T& value) { return value * scalar; }
+                    );
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> operator*(
+                    const typename containers::VectorMPI<T>::value_type& scalar,
+                    const containers::VectorMPI<T>& vector
+                ) {
+                    return internal::transform(
+                        vector, [scalar](const T& value) { return scalar * value; }
+                    );
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> operator/(
+                    const containers::VectorMPI<T>& vector,
+                    const typename containers::VectorMPI<T>::value_type& scalar
+                ) {
+                    vmafu::linalg::internal::check_divisor(scalar);
+
+                    return internal::transform(
+                        vector, [scalar](const T& value) { return value / scalar; }
+                    );
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> hadamard(
+                    const containers::VectorMPI<T>& lhs,
+                    const containers::VectorMPI<T>& rhs
+                ) {
+                    return internal::transform(lhs, rhs, std::multiplies<T>(), "linalg::hadamard()");
+                }
+
+                // MatrixMPI operations
+
+                template <typename T>
+                containers::MatrixMPI<T> operator+(
+                    const containers::MatrixMPI<T>& lhs,
+                    const containers::MatrixMPI<T>& rhs
+                ) {
+                    return internal::transform(lhs, rhs, std::plus<T>(), "linalg::operator+()");
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> operator-(
+                    const containers::MatrixMPI<T>& lhs,
+                    const containers::MatrixMPI<T>& rhs
+                ) {
+                    return internal::transform(lhs, rhs, std::minus<T>(), "linalg::operator-()");
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> operator-(
+                    const containers::MatrixMPI<T>& matrix
+                ) {
+                    return internal::transform(matrix, std::negate<T>());
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> operator*(
+                    const containers::MatrixMPI<T>& matrix,
+                    const typename containers::MatrixMPI<T>::value_type& scalar
+                ) {
+                    return internal::transform(
+                        matrix, [scalar](const T& value) { return value * scalar; }
+                    );
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> operator*(
+                    const typename containers::MatrixMPI<T>::value_type& scalar,
+                    const containers::MatrixMPI<T>& matrix
+                ) {
+                    return internal::transform(
+                        matrix, [scalar](const T& value) { return scalar * value; }
+                    );
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> operator/(
+                    const containers::MatrixMPI<T>& matrix,
+                    const typename containers::MatrixMPI<T>::value_type& scalar
+                ) {
+                    vmafu::linalg::internal::check_divisor(scalar);
+
+                    return internal::transform(
+                        matrix, [scalar](const T& value) { return value / scalar; }
+                    );
+                }
+
+                template <typename T>
+                containers::MatrixMPI<T> hadamard(
+                    const containers::MatrixMPI<T>& lhs,
+                    const containers::MatrixMPI<T>& rhs
+                ) {
+                    return internal::transform(lhs, rhs, std::multiplies<T>(), "linalg::hadamard()");
+                }
+
+                // In-place updates
+
+                template <typename T>
+                void axpy(
+                    const typename containers::VectorMPI<T>::value_type& alpha,
+                    const containers::VectorMPI<T>& x,
+                    containers::VectorMPI<T>& y
+                ) {
+                    internal::update(alpha, x, T(1), y, "linalg::axpy()");
+                }
+
+                template <typename T>
+                void axpy(
+                    const typename containers::MatrixMPI<T>::value_type& alpha,
+                    const containers::MatrixMPI<T>& x,
+                    containers::MatrixMPI<T>& y
+                ) {
+                    internal::update(alpha, x, T(1), y, "linalg::axpy()");
+                }
+
+                template <typename T>
+                void axpby(
+                    const typename containers::VectorMPI<T>::value_type& alpha,
+                    const containers::VectorMPI<T>& x,
+                    const typename containers::VectorMPI<T>::value_type& beta,
+                    containers::VectorMPI<T>& y
+                ) {
+                    internal::update(alpha, x, beta, y, "linalg::axpby()");
+                }
+
+                template <typename T>
+                void axpby(
+                    const typename containers::MatrixMPI<T>::value_type& alpha,
+                    const containers::MatrixMPI<T>& x,
+                    const typename containers::MatrixMPI<T>::value_type& beta,
+                    containers::MatrixMPI<T>& y
+                ) {
+                    internal::update(alpha, x, beta, y, "linalg::axpby()");
+                }
+
+                template <typename T>
+                void scale(
+                    const typename containers::VectorMPI<T>::value_type& alpha,
+                    containers::VectorMPI<T>& x
+                ) {
+                    internal::scale(alpha, x);
+                }
+
+                template <typename T>
+                void scale(
+                    const typename containers::MatrixMPI<T>::value_type& alpha,
+                    containers::MatrixMPI<T>& x
+                ) {
+                    internal::scale(alpha, x);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,928 @@
+// parallel/mpi/linalg/detail/_krylov.ipp
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Helper methods
+
+                namespace internal {
+                    // Dense operators are applied in BLOCK_ROWS, where a
+                    // matvec only allgathers x; the solvers redistribute any
+                    // other layout once, before iterating
+
+                    template <typename T>
+                    containers::MatrixMPI<T> block_rows(
+                        const containers::MatrixMPI<T>& A
+                    ) {
+                        distribution::MatrixDistributionInfo target = distribution::matrix_distribution_info(
+                            distribution::MatrixDistributionType::BLOCK_ROWS,
+                            A.global_rows(), A.global_cols(), A.communicator()
+                        );
+
+                        vmafu::core::Matrix<T> local(target.local_rows, target.local_cols);
+
+                        distribution::redistribute(
+                            A.distribution_info(), A.local_matrix(),
+                            target, local, A.communicator()
+                        );
+
+                        containers::MatrixMPI<T> result(A.communicator());
+
+                        result.set_local_matrix(std::move(local));
+                        result.set_dist_info(target);
+
+                        return result;
+                    }
+
+                    template <typename T>
+                    bool needs_block_rows(const containers::MatrixMPI<T>& A) {
+                        return A.distribution_info().type != \
+                            distribution::MatrixDistributionType::BLOCK_ROWS;
+                    }
+
+                    // Operator application, y = A x
+
+                    template <typename T>
+                    void apply_operator(
+                        const containers::MatrixMPI<T>& A,
+                        const containers::VectorMPI<T>& x,
+                        containers::VectorMPI<T>& y
+                    ) {
+                        y = multiply(A, x, 0, A.communicator());
+                    }
+
+                    template <typename T>
+                    void apply_operator(
+                        const containers::SparseMatrixMPI<T>& A,
+                        const containers::VectorMPI<T>& x,
+                        containers::VectorMPI<T>& y
+                    ) {
+                        A.multiply(x, y);
+                    }
+
+                    template <typename Operator, typename T>
+                    void apply_operator(
+                        const Operator& A,
+                        const containers::VectorMPI<T>& x,
+                        containers::VectorMPI<T>& y
+                    ) {
+                        A.apply(x, y);
+                    }
+
+                    // Adds the time spent in its scope to one phase
+
+                    class PhaseTimer {
+                        private:
+                            double& _total;
+                            double _start;
+
+                        public:
+                            explicit PhaseTimer(double& total)
+                                : _total(total), _start(timing::Timer::now()) {}
+
+                            ~PhaseTimer() {
+                                _total += timing::Timer::now() - _start;
+                            }
+                    };
+
+                    template <typename T>
+                    containers::VectorMPI<T> zeros_like(
+                        const containers::VectorMPI<T>& vector
+                    ) {
+                        containers::VectorMPI<T> result = empty_like(vector);
+
+                        std::fill(
+                            local_data(result), local_data(result) + local_count(result), T(0)
+                        );
+
+                        return result;
+                    }
+
+                    // r = b - A x
+
+                    template <typename Operator, typename T>
+                    void residual(
+                        const Operator& A,
+                        const containers::VectorMPI<T>& b,
+                        const containers::VectorMPI<T>& x,
+                        containers::VectorMPI<T>& r,
+                        SolverTimings& timings
+                    ) {
+                        {
+                            PhaseTimer timer(timings.matvec);
+
+                            apply_operator(A, x, r);
+                        }
+
+                        PhaseTimer timer(timings.update);
+
+                        axpby(T(1), b, T(-1), r);
+                    }
+
+                    template <typename T>
+                    void check_system(
+                        const containers::VectorMPI<T>& b,
+                        const containers::VectorMPI<T>& x,
+                        const char* name
+                    ) {
+                        check_distribution(b, x, name);
+                    }
+
+                    template <typename T>
+                    SolverResult<T>& finish(
+                        SolverResult<T>& result,
+                        double start_time
+                    ) {
+                        result.timings.total = timing::Timer::now() - start_time;
+
+                        return result;
+                    }
+
+                    // A zero right-hand side has the exact solution x = 0
+
+                    template <typename T>
+                    bool solve_trivial(
+                        const T& b_norm,
+                        containers::VectorMPI<T>& x,
+                        SolverResult<T>& result
+                    ) {
+                        if (b_norm != T(0)) {
+                            return false;
+                        }
+
+                        std::fill(local_data(x), local_data(x) + local_count(x), T(0));
+
+                        result.converged = true;
+                        result.residual_norm = T(0);
+                        result.residual_history.push_back(T(0));
+
+                        return true;
+                    }
+                }
+
+                // Conjugate gradients
+
+                template <typename Operator, typename T, typename Preconditioner>
+                SolverResult<T> solve_cg(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const Preconditioner& M,
+                    const SolverOptions& options
+                ) {
+                    if constexpr (std::is_same_v<Operator, containers::MatrixMPI<T>>) {
+                        if (internal::needs_block_rows(A)) {
+                            return solve_cg(internal::block_rows(A), b, x, M, options);
+                        }
+                    }
+
+                    internal::check_system(b, x, "linalg::solve_cg()");
+
+                    SolverResult<T> result;
+                    double start_time = timing::Timer::now();
+
+                    containers::VectorMPI<T> r = internal::empty_like(b);
+                    containers::VectorMPI<T> u = internal::empty_like(b);
+                    containers::VectorMPI<T> w = internal::empty_like(b);
+                    containers::VectorMPI<T> p = internal::empty_like(b);
+                    containers::VectorMPI<T> s = internal::empty_like(b);
+
+                    internal::residual(A, b, x, r, result.timings);
+
+                    FusedReduction<T> reduction(b.communicator());
+
+                    size_t b_slot = reduction.squared_norm2(b);
+
+                    T alpha = T(0);
+                    T gamma = T(0);
+                    T threshold = T(0);
+
+                    while (true) {
+                        {
+                            internal::PhaseTimer timer(result.timings.preconditioner);
+
+                            M.apply(r, u);
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.matvec);
+
+                            internal::apply_operator(A, u, w);
+                        }
+
+                        T gamma_old = gamma;
+                        T delta = T(0);
+
+                        {
+                            internal::PhaseTimer timer(result.timings.reduction);
+
+                            size_t gamma_slot = reduction.dot(r, u);
+                            size_t delta_slot = reduction.dot(w, u);
+                            size_t r_slot = reduction.squared_norm2(r);
+
+                            reduction.compute();
+
+                            if (result.iterations == 0) {
+                                T b_norm = std::sqrt(reduction[b_slot]);
+
+                                if (internal::solve_trivial(b_norm, x, result)) {
+                                    return internal::finish(result, start_time);
+                                }
+
+                                threshold = static_cast<T>(options.tolerance) * b_norm;
+                            }
+
+                            gamma = reduction[gamma_slot];
+                            delta = reduction[delta_slot];
+
+                            result.residual_norm = std::sqrt(reduction[r_slot]);
+                            result.residual_history.push_back(result.residual_norm);
+
+                            reduction.clear();
+                        }
+
+                        if (result.residual_norm <= threshold) {
+                            result.converged = true;
+                            break;
+                        }
+
+                        if (result.iterations >= options.max_iterations) {
+                            break;
+                        }
+
+                        // Chronopoulos-Gear: alpha from gamma and delta only,
+                        // so both come from the same reduction
+
+                        T beta = T(0);
+                        T denominator = delta;
+
+                        if (result.iterations > 0) {
+                            beta = gamma / gamma_old;
+                            denominator = delta - beta * gamma / alpha;
+                        }
+
+                        if (denominator == T(0) || !std::isfinite(denominator)) {
+                            break;
+                        }
+
+                        alpha = gamma / denominator;
+
+                        {
+                            internal::PhaseTimer timer(result.timings.update);
+
+                            axpby(T(1), u, beta, p);
+                            axpby(T(1), w, beta, s);
+
+                            axpy(alpha, p, x);
+                            axpy(-alpha, s, r);
+                        }
+
+                        result.iterations++;
+                    }
+
+                    return internal::finish(result, start_time);
+                }
+
+                template <typename Operator, typename T>
+                SolverResult<T> solve_cg(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const SolverOptions& options
+                ) {
+                    return solve_cg(A, b, x, IdentityPreconditioner<T>(), options);
+                }
+
+                // Pipelined conjugate gradients
+
+                template <typename Operator, typename T, typename Preconditioner>
+                SolverResult<T> solve_pipelined_cg(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const Preconditioner& M,
+                    const SolverOptions& options
+                ) {
+                    if constexpr (std::is_same_v<Operator, containers::MatrixMPI<T>>) {
+                        if (internal::needs_block_rows(A)) {
+                            return solve_pipelined_cg(internal::block_rows(A), b, x, M, options);
+                        }
+                    }
+
+                    internal::check_system(b, x, "linalg::solve_pipelined_cg()");
+
+                    SolverResult<T> result;
+                    double start_time = timing::Timer::now();
+
+                    containers::VectorMPI<T> r = internal::empty_like(b);
+                    containers::VectorMPI<T> u = internal::empty_like(b);
+                    containers::VectorMPI<T> w = internal::empty_like(b);
+                    containers::VectorMPI<T> m = internal::empty_like(b);
+                    containers::VectorMPI<T> n = internal::empty_like(b);
+
+                    containers::VectorMPI<T> p = internal::empty_like(b);
+                    containers::VectorMPI<T> s = internal::empty_like(b);
+                    containers::VectorMPI<T> q = internal::empty_like(b);
+                    containers::VectorMPI<T> z = internal::empty_like(b);
+
+                    internal::residual(A, b, x, r, result.timings);
+
+                    {
+                        internal::PhaseTimer timer(result.timings.preconditioner);
+
+                        M.apply(r, u);
+                    }
+
+                    {
+                        internal::PhaseTimer timer(result.timings.matvec);
+
+                        internal::apply_operator(A, u, w);
+                    }
+
+                    FusedReduction<T> reduction(b.communicator());
+
+                    size_t b_slot = reduction.squared_norm2(b);
+
+                    T alpha = T(0);
+                    T gamma = T(0);
+                    T threshold = T(0);
+
+                    while (true) {
+                        size_t gamma_slot = 0;
+                        size_t delta_slot = 0;
+                        size_t r_slot = 0;
+
+                        {
+                            internal::PhaseTimer timer(result.timings.reduction);
+
+                            gamma_slot = reduction.dot(r, u);
+                            delta_slot = reduction.dot(w, u);
+                            r_slot = reduction.squared_norm2(r);
+
+                            reduction.start();
+                        }
+
+                        // Overlapped with the reduction in flight
+
+                        {
+                            internal::PhaseTimer timer(result.timings.preconditioner);
+
+                            M.apply(w, m);
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.matvec);
+
+                            internal::apply_operator(A, m, n);
+                        }
+
+                        T gamma_old = gamma;
+                        T delta = T(0);
+
+                        {
+                            internal::PhaseTimer timer(result.timings.reduction);
+
+                            reduction.wait();
+
+                            if (result.iterations == 0) {
+                                T b_norm = std::sqrt(reduction[b_slot]);
+
+                                if (internal::solve_trivial(b_norm, x, result)) {
+                                    return internal::finish(result, start_time);
+                                }
+
+                                threshold = static_cast<T>(options.tolerance) * b_norm;
+                            }
+
+                            gamma = reduction[gamma_slot];
+                            delta = reduction[delta_slot];
+
+                            result.residual_norm = std::sqrt(reduction[r_slot]);
+                            result.residual_history.push_back(result.residual_norm);
+
+                            reduction.clear();
+                        }
+
+                        if (result.residual_norm <= threshold) {
+                            result.converged = true;
+                            break;
+                        }
+
+                        if (result.iterations >= options.max_iterations) {
+                            break;
+                        }
+
+                        T beta = T(0);
+                        T denominator = delta;
+
+                        if (result.iterations > 0) {
+                            beta = gamma / gamma_old;
+                            denominator = delta - beta * gamma / alpha;
+                        }
+
+                        if (denominator == T(0) || !std::isfinite(denominator)) {
+                            break;
+                        }
+
+                        alpha = gamma / denominator;
+
+                        {
+                            internal::PhaseTimer timer(result.timings.update);
+
+                            axpby(T(1), n, beta, z);
+                            axpby(T(1), m, beta, q);
+                            axpby(T(1), w, beta, s);
+                            axpby(T(1), u, beta, p);
+
+                            axpy(alpha, p, x);
+                            axpy(-alpha, s, r);
+                            axpy(-alpha, q, u);
+                            axpy(-alpha, z, w);
+                        }
+
+                        result.iterations++;
+                    }
+
+                    return internal::finish(result, start_time);
+                }
+
+                template <typename Operator, typename T>
+                SolverResult<T> solve_pipelined_cg(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const SolverOptions& options
+                ) {
+                    return solve_pipelined_cg(A, b, x, IdentityPreconditioner<T>(), options);
+                }
+
+                // BiCGStab
+
+                template <typename Operator, typename T, typename Preconditioner>
+                SolverResult<T> solve_bicgstab(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const Preconditioner& M,
+                    const SolverOptions& options
+                ) {
+                    if constexpr (std::is_same_v<Operator, containers::MatrixMPI<T>>) {
+                        if (internal::needs_block_rows(A)) {
+                            return solve_bicgstab(internal::block_rows(A), b, x, M, options);
+                        }
+                    }
+
+                    internal::check_system(b, x, "linalg::solve_bicgstab()");
+
+                    SolverResult<T> result;
+                    double start_time = timing::Timer::now();
+
+                    containers::VectorMPI<T> r = internal::empty_like(b);
+                    containers::VectorMPI<T> p = internal::empty_like(b);
+                    containers::VectorMPI<T> v = internal::zeros_like(b);
+                    containers::VectorMPI<T> s = internal::empty_like(b);
+                    containers::VectorMPI<T> t = internal::empty_like(b);
+                    containers::VectorMPI<T> p_hat = internal::empty_like(b);
+                    containers::VectorMPI<T> s_hat = internal::empty_like(b);
+
+                    internal::residual(A, b, x, r, result.timings);
+
+                    containers::VectorMPI<T> r_hat = r;
+
+                    FusedReduction<T> reduction(b.communicator());
+
+                    T rho = T(0);
+                    T threshold = T(0);
+
+                    {
+                        internal::PhaseTimer timer(result.timings.reduction);
+
+                        size_t b_slot = reduction.squared_norm2(b);
+                        size_t r_slot = reduction.squared_norm2(r);
+
+                        reduction.compute();
+
+                        T b_norm = std::sqrt(reduction[b_slot]);
+
+                        if (internal::solve_trivial(b_norm, x, result)) {
+                            return internal::finish(result, start_time);
+                        }
+
+                        threshold = static_cast<T>(options.tolerance) * b_norm;
+
+                        rho = reduction[r_slot];
+
+                        result.residual_norm = std::sqrt(rho);
+                        result.residual_history.push_back(result.residual_norm);
+
+                        reduction.clear();
+                    }
+
+                    T alpha = T(1);
+                    T omega = T(1);
+                    T rho_old = T(1);
+
+                    while (true) {
+                        if (result.residual_norm <= threshold) {
+                            // The recurrence for ||r|| can drift below the
+                            // true residual; confirm with one extra reduction
+
+                            T true_norm = norm2(r);
+
+                            if (true_norm <= threshold) {
+                                result.residual_norm = true_norm;
+                                result.converged = true;
+                                break;
+                            }
+
+                            result.residual_norm = true_norm;
+                        }
+
+                        if (result.iterations >= options.max_iterations || rho == T(0)) {
+                            break;
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.update);
+
+                            if (result.iterations == 0) {
+                                axpby(T(1), r, T(0), p);
+                            } else {
+                                T beta = (rho / rho_old) * (alpha / omega);
+
+                                axpy(-omega, v, p);
+                                axpby(T(1), r, beta, p);
+                            }
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.preconditioner);
+
+                            M.apply(p, p_hat);
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.matvec);
+
+                            internal::apply_operator(A, p_hat, v);
+                        }
+
+                        T r_hat_v = T(0);
+
+                        {
+                            internal::PhaseTimer timer(result.timings.reduction);
+
+                            r_hat_v = dot(r_hat, v);
+                        }
+
+                        if (r_hat_v == T(0)) {
+                            break;
+                        }
+
+                        alpha = rho / r_hat_v;
+
+                        {
+                            internal::PhaseTimer timer(result.timings.update);
+
+                            axpby(T(1), r, T(0), s);
+                            axpy(-alpha, v, s);
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.preconditioner);
+
+                            M.apply(s, s_hat);
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.matvec);
+
+                            internal::apply_operator(A, s_hat, t);
+                        }
+
+                        // Everything the rest of the iteration needs, incl.
+                        // the next rho and ||r||, in one reduction
+
+                        T ts = T(0), tt = T(0), ss = T(0), rs = T(0), rt = T(0);
+
+                        {
+                            internal::PhaseTimer timer(result.timings.reduction);
+
+                            size_t ts_slot = reduction.dot(t, s);
+                            size_t tt_slot = reduction.squared_norm2(t);
+                            size_t ss_slot = reduction.squared_norm2(s);
+                            size_t rs_slot = reduction.dot(r_hat, s);
+                            size_t rt_slot = reduction.dot(r_hat, t);
+
+                            reduction.compute();
+
+                            ts = reduction[ts_slot];
+                            tt = reduction[tt_slot];
+                            ss = reduction[ss_slot];
+                            rs = reduction[rs_slot];
+                            rt = reduction[rt_slot];
+
+                            reduction.clear();
+                        }
+
+                        result.iterations++;
+
+                        if (std::sqrt(ss) <= threshold || tt == T(0)) {
+                            internal::PhaseTimer timer(result.timings.update);
+
+                            axpy(alpha, p_hat, x);
+                            axpby(T(1), s, T(0), r);
+
+                            result.residual_norm = std::sqrt(ss);
+                            result.residual_history.push_back(result.residual_norm);
+
+                            result.converged = result.residual_norm <= threshold;
+                            break;
+                        }
+
+                        omega = ts / tt;
+
+                        {
+                            internal::PhaseTimer timer(result.timings.update);
+
+                            axpy(alpha, p_hat, x);
+                            axpy(omega, s_hat, x);
+
+                            axpby(T(1), s, T(0), r);
+                            axpy(-omega, t, r);
+                        }
+
+                        rho_old = rho;
+                        rho = rs - omega * rt;
+
+                        T rr = ss - T(2) * omega * ts + omega * omega * tt;
+
+                        result.residual_norm = std::sqrt(rr > T(0) ? rr : T(0));
+                        result.residual_history.push_back(result.residual_norm);
+
+                        if (omega == T(0)) {
+                            break;
+                        }
+                    }
+
+                    return internal::finish(result, start_time);
+                }
+
+                template <typename Operator, typename T>
+                SolverResult<T> solve_bicgstab(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const SolverOptions& options
+                ) {
+                    return solve_bicgstab(A, b, x, IdentityPreconditioner<T>(), options);
+                }
+
+                // GMRES
+
+                template <typename Operator, typename T, typename Preconditioner>
+                SolverResult<T> solve_gmres(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const Preconditioner& M,
+                    const SolverOptions& options
+                ) {
+                    if constexpr (std::is_same_v<Operator, containers::MatrixMPI<T>>) {
+                        if (internal::needs_block_rows(A)) {
+                            return solve_gmres(internal::block_rows(A), b, x, M, options);
+                        }
+                    }
+
+                    internal::check_system(b, x, "linalg::solve_gmres()");
+
+                    if (options.restart == 0) {
+                        throw std::invalid_argument(
+                            "solve_gmres: Restart length must be positive"
+                        );
+                    }
+
+                    SolverResult<T> result;
+                    double start_time = timing::Timer::now();
+
+                    size_t m = options.restart;
+
+                    containers::VectorMPI<T> r = internal::empty_like(b);
+                    containers::VectorMPI<T> w = internal::empty_like(b);
+                    containers::VectorMPI<T> z = internal::empty_like(b);
+
+                    std::vector<containers::VectorMPI<T>> V;
+                    V.reserve(m + 1);
+
+                    // Hessenberg matrix reduced to triangular form by
+                    // Givens rotations as the Arnoldi process runs
+
+                    vmafu::core::Matrix<T> H(m + 1, m, T(0));
+
+                    std::vector<T> cs(m), sn(m), g(m + 1), y(m);
+
+                    FusedReduction<T> reduction(b.communicator());
+
+                    T threshold = T(0);
+
+                    while (true) {
+                        internal::residual(A, b, x, r, result.timings);
+
+                        T beta = T(0);
+
+                        {
+                            internal::PhaseTimer timer(result.timings.reduction);
+
+                            size_t r_slot = reduction.squared_norm2(r);
+                            size_t b_slot = reduction.squared_norm2(b);
+
+                            reduction.compute();
+
+                            beta = std::sqrt(reduction[r_slot]);
+
+                            if (result.residual_history.empty()) {
+                                T b_norm = std::sqrt(reduction[b_slot]);
+
+                                if (internal::solve_trivial(b_norm, x, result)) {
+                                    return internal::finish(result, start_time);
+                                }
+
+                                threshold = static_cast<T>(options.tolerance) * b_norm;
+
+                                result.residual_history.push_back(beta);
+                            }
+
+                            reduction.clear();
+                        }
+
+                        result.residual_norm = beta;
+
+                        if (beta <= threshold) {
+                            result.converged = true;
+                            break;
+                        }
+
+                        if (result.iterations >= options.max_iterations) {
+                            break;
+                        }
+
+                        V.clear();
+                        V.push_back(r / beta);
+
+                        std::fill(g.begin(), g.end(), T(0));
+                        g[0] = beta;
+
+                        size_t k = 0;
+
+                        while (k < m && result.iterations < options.max_iterations) {
+                            {
+                                internal::PhaseTimer timer(result.timings.preconditioner);
+
+                                M.apply(V[k], z);
+                            }
+
+                            {
+                                internal::PhaseTimer timer(result.timings.matvec);
+
+                                internal::apply_operator(A, z, w);
+                            }
+
+                            // Classical Gram-Schmidt, twice: each pass is one
+                            // fused reduction against the whole basis
+
+                            T norm_squared = T(0);
+
+                            for (size_t pass = 0; pass < 2; pass++) {
+                                size_t w_slot = 0;
+
+                                {
+                                    internal::PhaseTimer timer(result.timings.reduction);
+
+                                    for (size_t i = 0; i <= k; i++) {
+                                        reduction.dot(V[i], w);
+                                    }
+
+                                    if (pass == 1) {
+                                        w_slot = reduction.squared_norm2(w);
+                                    }
+
+                                    reduction.compute();
+                                }
+
+                                internal::PhaseTimer timer(result.timings.update);
+
+                                T projection = T(0);
+
+                                for (size_t i = 0; i <= k; i++) {
+                                    T h = reduction[i];
+
+                                    H(i, k) += h;
+                                    projection += h * h;
+
+                                    axpy(-h, V[i], w);
+                                }
+
+                                if (pass == 1) {
+                                    // ||w - V h|| = sqrt(||w||^2 - ||h||^2)
+
+                                    norm_squared = reduction[w_slot] - projection;
+                                }
+
+                                reduction.clear();
+                            }
+
+                            T h_next = std::sqrt(norm_squared > T(0) ? norm_squared : T(0));
+
+                            H(k + 1, k) = h_next;
+
+                            for (size_t i = 0; i < k; i++) {
+                                T temp = cs[i] * H(i, k) + sn[i] * H(i + 1, k);
+
+                                H(i + 1, k) = -sn[i] * H(i, k) + cs[i] * H(i + 1, k);
+                                H(i, k) = temp;
+                            }
+
+                            T denominator = std::hypot(H(k, k), H(k + 1, k));
+
+                            cs[k] = denominator == T(0) ? T(1) : H(k, k) / denominator;
+                            sn[k] = denominator == T(0) ? T(0) : H(k + 1, k) / denominator;
+
+                            H(k, k) = denominator;
+                            H(k + 1, k) = T(0);
+
+                            g[k + 1] = -sn[k] * g[k];
+                            g[k] = cs[k] * g[k];
+
+                            k++;
+
+                            result.iterations++;
+                            result.residual_norm = std::abs(g[k]);
+                            result.residual_history.push_back(result.residual_norm);
+
+                            if (result.residual_norm <= threshold || h_next == T(0)) {
+                                break;
+                            }
+
+                            V.push_back(w / h_next);
+                        }
+
+                        // Back substitution on the k x k triangle, then
+                        // x += M^-1 V y
+
+                        for (size_t i = k; i-- > 0;) {
+                            T value = g[i];
+
+                            for (size_t j = i + 1; j < k; j++) {
+                                value -= H(i, j) * y[j];
+                            }
+
+                            y[i] = H(i, i) == T(0) ? T(0) : value / H(i, i);
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.update);
+
+                            axpby(y[0], V[0], T(0), w);
+
+                            for (size_t i = 1; i < k; i++) {
+                                axpy(y[i], V[i], w);
+                            }
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.preconditioner);
+
+                            M.apply(w, z);
+                        }
+
+                        {
+                            internal::PhaseTimer timer(result.timings.update);
+
+                            axpy(T(1), z, x);
+                        }
+
+                        for (size_t i = 0; i <= m; i++) {
+                            for (size_t j = 0; j < m; j++) {
+                                H(i, j) = T(0);
+                            }
+                        }
+                    }
+
+                    return internal::finish(result, start_time);
+                }
+
+                template <typename Operator, typename T>
+                SolverResult<T> solve_gmres(
+                    const Operator& A,
+                    const containers::VectorMPI<T>& b,
+                    containers::VectorMPI<T>& x,
+                    const SolverOptions& options
+                ) {
+                    return solve_gmres(A, b, x, IdentityPreconditioner<T>(), options);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,331 @@
+// parallel/mpi/linalg/detail/_linear_operator.ipp
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Helper methods
+
+                namespace internal {
+                    // Whole vector on every rank, for any distribution of x
+
+                    template <typename T>
+                    void allgather_vector(
+                        const containers::VectorMPI<T>& x,
+                        std::vector<T>& global
+                    ) {
+                        const communication::Communicator& comm = x.communicator();
+
+                        int comm_size = comm.size();
+
+                        int local_size = static_cast<int>(x.local_size());
+                        int offset = static_cast<int>(x.distribution_info().offset);
+
+                        std::vector<int> counts(comm_size);
+                        std::vector<int> displs(comm_size);
+
+                        comm.allgather(&local_size, counts.data(), 1);
+                        comm.allgather(&offset, displs.data(), 1);
+
+                        global.resize(x.global_size());
+
+                        comm.allgatherv(
+                            x.local_vector().data(), local_size,
+                            global.data(), counts.data(), displs.data()
+                        );
+                    }
+                }
+
+                // Constructors
+
+                template <typename T>
+                LinearOperatorMPI<T>::LinearOperatorMPI()
+                    : _rows(0), _cols(0), _row_info(), _col_info() {}
+
+                template <typename T>
+                LinearOperatorMPI<T>::LinearOperatorMPI(
+                    size_t rows,
+                    size_t cols,
+                    std::function<void(const containers::VectorMPI<T>&, containers::VectorMPI<T>&)> apply,
+                    std::function<void(const containers::VectorMPI<T>&, containers::VectorMPI<T>&)> apply_transpose,
+                    const communication::Communicator& comm
+                ) : _rows(rows),
+                    _cols(cols),
+                    _comm(comm),
+                    _apply(std::move(apply)),
+                    _apply_transpose(std::move(apply_transpose)) {
+                    _row_info = distribution::vector_distribution_info(
+                        distribution::VectorDistributionType::BLOCK, rows, comm
+                    );
+                    _col_info = distribution::vector_distribution_info(
+                        distribution::VectorDistributionType::BLOCK, cols, comm
+                    );
+                }
+
+                // Helper method
+
+                template <typename T>
+                void LinearOperatorMPI<T>::_prepare_output(
+                    const distribution::VectorDistributionInfo& info,
+                    containers::VectorMPI<T>& y
+                ) const {
+                    if (
+                        y.global_size() != info.global_size || \
+                        y.local_size() != info.local_size || \
+                        y.distribution_info().offset != info.offset
+                    ) {
+                        y.set_comm(_comm);
+                        y.set_dist_info(info);
+                        y.set_local_vector(vmafu::core::Vector<T>(
+                            info.local_size, vmafu::core::uninitialized
+                        ));
+                    }
+                }
+
+                // Getters
+
+                template <typename T>
+                size_t LinearOperatorMPI<T>::rows() const noexcept {
+                    return _rows;
+                }
+
+                template <typename T>
+                size_t LinearOperatorMPI<T>::cols() const noexcept {
+                    return _cols;
+                }
+
+                template <typename T>
+                const distribution::VectorDistributionInfo& LinearOperatorMPI<T>::row_info() const noexcept {
+                    return _row_info;
+                }
+
+                template <typename T>
+                const distribution::VectorDistributionInfo& LinearOperatorMPI<T>::column_info() const noexcept {
+                    return _col_info;
+                }
+
+                template <typename T>
+                const communication::Communicator& LinearOperatorMPI<T>::communicator() const noexcept {
+                    return _comm;
+                }
+
+                template <typename T>
+                bool LinearOperatorMPI<T>::has_transpose() const noexcept {
+                    return static_cast<bool>(_apply_transpose);
+                }
+
+                // Apply methods
+
+                template <typename T>
+                void LinearOperatorMPI<T>::apply(
+                    const containers::VectorMPI<T>& x,
+                    containers::VectorMPI<T>& y
+                ) const {
+                    if (!_apply) {
+                        throw std::logic_error(
+                            "LinearOperatorMPI::apply(): Operator is not initialized"
+                        );
+                    }
+
+                    if (x.global_size() != _cols) {
+                        throw std::invalid_argument(
+                            "LinearOperatorMPI::apply(): Vector size must equal operator columns"
+                        );
+                    }
+
+                    if (&x == &y) {
+                        throw std::invalid_argument(
+                            "LinearOperatorMPI::apply(): Output must not alias the input"
+                        );
+                    }
+
+                    _prepare_output(_row_info, y);
+
+                    _apply(x, y);
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> LinearOperatorMPI<T>::apply(
+                    const containers::VectorMPI<T>& x
+                ) const {
+                    containers::VectorMPI<T> result(_comm);
+
+                    apply(x, result);
+
+                    return result;
+                }
+
+                template <typename T>
+                void LinearOperatorMPI<T>::apply_transpose(
+                    const containers::VectorMPI<T>& x,
+                    containers::VectorMPI<T>& y
+                ) const {
+                    if (!_apply_transpose) {
+                        throw std::logic_error(
+                            "LinearOperatorMPI::apply_transpose(): Operator has no transpose"
+                        );
+                    }
+
+                    if (x.global_size() != _rows) {
+                        throw std::invalid_argument(
+                            "LinearOperatorMPI::apply_transpose(): Vector size must equal operator rows"
+                        );
+                    }
+
+                    if (&x == &y) {
+                        throw std::invalid_argument(
+                            "LinearOperatorMPI::apply_transpose(): Output must not alias the input"
+                        );
+                    }
+
+                    _prepare_output(_col_info, y);
+
+                    _apply_transpose(x, y);
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> LinearOperatorMPI<T>::apply_transpose(
+                    const containers::VectorMPI<T>& x
+                ) const {
+                    containers::VectorMPI<T> result(_comm);
+
+                    apply_transpose(x, result);
+
+                    return result;
+                }
+
+                template <typename T>
+                LinearOperatorMPI<T> LinearOperatorMPI<T>::transpose() const {
+                    LinearOperatorMPI result;
+
+                    result._rows = _cols;
+                    result._cols = _rows;
+                    result._row_info = _col_info;
+                    result._col_info = _row_info;
+                    result._comm = _comm;
+                    result._apply = _apply_transpose;
+                    result._apply_transpose = _apply;
+
+                    return result;
+                }
+
+                // Static methods
+
+                template <typename T>
+                LinearOperatorMPI<T> LinearOperatorMPI<T>::from_matrix(
+                    const containers::MatrixMPI<T>& matrix
+                ) {
+                    const containers::MatrixMPI<T>* A = &matrix;
+
+                    return LinearOperatorMPI(
+                        matrix.global_rows(), matrix.global_cols(),
+                        [A](const containers::VectorMPI<T>& x, containers::VectorMPI<T>& y) {
+                            y = multiply(*A, x, 0, A->communicator());
+                        },
+                        [A](const containers::VectorMPI<T>& x, containers::VectorMPI<T>& y) {
+                            y = multiply(x, *A, 0, A->communicator());
+                        },
+                        matrix.communicator()
+                    );
+                }
+
+                template <typename T>
+                LinearOperatorMPI<T> LinearOperatorMPI<T>::from_sparse(
+                    const containers::SparseMatrixMPI<T>& matrix
+                ) {
+                    const containers::SparseMatrixMPI<T>* A = &matrix;
+
+                    LinearOperatorMPI result(
+                        matrix.global_rows(), matrix.global_cols(),
+                        [A](const containers::VectorMPI<T>& x, containers::VectorMPI<T>& y) {
+                            A->multiply(x, y);
+                        },
+                        [A](const containers::VectorMPI<T>& x, containers::VectorMPI<T>& y) {
+                            A->multiply_transpose(x, y);
+                        },
+                        matrix.communicator()
+                    );
+
+                    result._row_info = matrix.distribution_info();
+                    result._col_info = matrix.column_info();
+
+                    return result;
+                }
+
+                template <typename T>
+                template <typename Entry>
+                LinearOperatorMPI<T> LinearOperatorMPI<T>::from_entries(
+                    size_t rows,
+                    size_t cols,
+                    const Entry& entry,
+                    const communication::Communicator& comm,
+                    size_t threads
+                ) {
+                    // Gather buffer shared by the copies of the operator
+
+                    std::shared_ptr<std::vector<T>> buffer = std::make_shared<std::vector<T>>();
+
+                    return LinearOperatorMPI(
+                        rows, cols,
+                        [entry, cols, threads, buffer](
+                            const containers::VectorMPI<T>& x,
+                            containers::VectorMPI<T>& y
+                        ) {
+                            internal::allgather_vector(x, *buffer);
+
+                            const T* x_global = buffer->data();
+                            T* y_local = y.local_vector().data();
+
+                            size_t offset = y.distribution_info().offset;
+
+                            vmafu::utils::parallel_for(
+                                0, y.local_size(),
+                                [&](size_t first, size_t last) {
+                                    for (size_t i = first; i < last; i++) {
+                                        T sum = T(0);
+
+                                        for (size_t j = 0; j < cols; j++) {
+                                            sum += static_cast<T>(entry(offset + i, j)) * x_global[j];
+                                        }
+
+                                        y_local[i] = sum;
+                                    }
+                                },
+                                threads, vmafu::linalg::internal::OPERATOR_GRAIN
+                            );
+                        },
+                        [entry, rows, threads, buffer](
+                            const containers::VectorMPI<T>& x,
+                            containers::VectorMPI<T>& y
+                        ) {
+                            internal::allgather_vector(x, *buffer);
+
+                            const T* x_global = buffer->data();
+                            T* y_local = y.local_vector().data();
+
+                            size_t offset = y.distribution_info().offset;
+
+                            vmafu::utils::parallel_for(
+                                0, y.local_size(),
+                                [&](size_t first, size_t last) {
+                                    for (size_t j = first; j < last; j++) {
+                                        T sum = T(0);
+
+                                        for (size_t i = 0; i < rows; i++) {
+                                            sum += static_cast<T>(entry(i, offset + j)) * x_global[i];
+                                        }
+
+                                        y_local[j] = sum;
+                                    }
+                                },
+                                threads, vmafu::linalg::internal::OPERATOR_GRAIN
+                            );
+                        },
+                        comm
+                    );
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,609 @@
+// parallel/mpi/linalg/detail/_lu.ipp
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Helper methods
+
+                namespace internal {
+                    constexpr int LU_SWAP_TAG = 50;
+
+                    // Process grid of a distributed matrix: one
+                    // communicator per process row ( ranked by grid_col )
+                    // and per process column ( ranked by grid_row ), and
+                    // the first global row / column of every process row /
+                    // column, closed by the global size
+
+                    struct ProcessGrid {
+                        communication::Communicator row_comm;
+                        communication::Communicator col_comm;
+
+                        std::vector<size_t> row_starts;
+                        std::vector<size_t> col_starts;
+
+                        int grid_row;
+                        int grid_col;
+                        int grid_cols;
+
+                        int owner_row(size_t i) const {
+                            return static_cast<int>(
+                                std::upper_bound(row_starts.begin(), row_starts.end() - 1, i) - \
+                                row_starts.begin()
+                            ) - 1;
+                        }
+
+                        int owner_col(size_t j) const {
+                            return static_cast<int>(
+                                std::upper_bound(col_starts.begin(), col_starts.end() - 1, j) - \
+                                col_starts.begin()
+                            ) - 1;
+                        }
+                    };
+
+                    inline ProcessGrid process_grid(
+                        const distribution::MatrixDistributionInfo& info,
+                        const communication::Communicator& comm
+                    ) {
+                        if (
+                            info.type != distribution::MatrixDistributionType::BLOCK_ROWS && \
+                            info.type != distribution::MatrixDistributionType::BLOCK_COLS && \
+                            info.type != distribution::MatrixDistributionType::BLOCK_2D
+                        ) {
+                            throw std::invalid_argument(
+                                "lu::lu: Unsupported distribution type"
+                            );
+                        }
+
+                        ProcessGrid grid;
+
+                        grid.row_comm = communication::Communicator::split(
+                            comm, info.grid_row, info.grid_col
+                        );
+                        grid.col_comm = communication::Communicator::split(
+                            comm, info.grid_col, info.grid_row
+                        );
+
+                        grid.row_starts.resize(info.grid_rows + 1);
+                        grid.col_starts.resize(info.grid_cols + 1);
+
+                        grid.col_comm.allgather(&info.row_offset, grid.row_starts.data(), 1);
+                        grid.row_comm.allgather(&info.col_offset, grid.col_starts.data(), 1);
+
+                        grid.row_starts[info.grid_rows] = info.global_rows;
+                        grid.col_starts[info.grid_cols] = info.global_cols;
+
+                        grid.grid_row = info.grid_row;
+                        grid.grid_col = info.grid_col;
+                        grid.grid_cols = info.grid_cols;
+
+                        return grid;
+                    }
+
+                    // Local index of the first owned global index >= global
+
+                    inline size_t local_begin(
+                        size_t global,
+                        size_t offset,
+                        size_t count
+                    ) {
+                        return global <= offset ? 0 : std::min(global - offset, count);
+                    }
+
+                    // Exchanges global rows r1 and r2 over the local
+                    // columns [first, first + count), across the process
+                    // column when they live on different process rows
+
+                    template <typename T>
+                    void swap_rows(
+                        vmafu::core::Matrix<T>& local,
+                        size_t row_offset,
+                        size_t first,
+                        size_t count,
+                        size_t r1,
+                        size_t r2,
+                        const ProcessGrid& grid,
+                        std::vector<T>& buffer
+                    ) {
+                        if (count == 0) {
+                            return;
+                        }
+
+                        int p1 = grid.owner_row(r1);
+                        int p2 = grid.owner_row(r2);
+
+                        if (grid.grid_row != p1 && grid.grid_row != p2) {
+                            return;
+                        }
+
+                        T* a = local.data();
+                        size_t lc = local.cols();
+
+                        if (p1 == p2) {
+                            std::swap_ranges(
+                                a + (r1 - row_offset) * lc + first,
+                                a + (r1 - row_offset) * lc + first + count,
+                                a + (r2 - row_offset) * lc + first
+                            );
+
+                            return;
+                        }
+
+                        size_t mine = grid.grid_row == p1 ? r1 : r2;
+                        int other = grid.grid_row == p1 ? p2 : p1;
+
+                        T* row = a + (mine - row_offset) * lc + first;
+
+                        buffer.assign(row, row + count);
+
+                        std::vector<MPI_Request> requests;
+
+                        requests.push_back(grid.col_comm.isend(
+                            buffer.data(), static_cast<int>(count), other, LU_SWAP_TAG
+                        ));
+                        requests.push_back(grid.col_comm.irecv(
+                            row, static_cast<int>(count), other, LU_SWAP_TAG
+                        ));
+
+                        communication::Communicator::wait_all(requests);
+                    }
+
+                    // Unblocked LU of global columns [k, k + kb) ( local
+                    // columns from col ) over the process column. Pivot
+                    // rows are exchanged within the panel only; the
+                    // caller swaps the rest
+
+                    template <typename T>
+                    void factor_panel(
+                        vmafu::core::Matrix<T>& local,
+                        size_t row_offset,
+                        size_t col,
+                        size_t k,
+                        size_t kb,
+                        const ProcessGrid& grid,
+                        std::vector<size_t>& pivots,
+                        bool& singular
+                    ) {
+                        size_t lr = local.rows();
+                        size_t lc = local.cols();
+
+                        int grid_rows = grid.col_comm.size();
+
+                        std::vector<T> values(grid_rows);
+                        std::vector<size_t> rows(grid_rows);
+
+                        std::vector<T> pivot_row(kb);
+                        std::vector<T> buffer;
+
+                        for (size_t j = k; j < k + kb; j++) {
+                            T* a = local.data();
+
+                            size_t jl = col + (j - k);
+                            size_t first = local_begin(j, row_offset, lr);
+
+                            T largest = T(0);
+                            size_t pivot = j;
+
+                            for (size_t i = first; i < lr; i++) {
+                                T value = std::abs(a[i * lc + jl]);
+
+                                if (value > largest) {
+                                    largest = value;
+                                    pivot = row_offset + i;
+                                }
+                            }
+
+                            grid.col_comm.allgather(&largest, values.data(), 1);
+                            grid.col_comm.allgather(&pivot, rows.data(), 1);
+
+                            // Process rows are in row order, so the first
+                            // strict maximum is also the smallest row
+
+                            largest = T(0);
+                            pivot = j;
+
+                            for (int p = 0; p < grid_rows; p++) {
+                                if (values[p] > largest) {
+                                    largest = values[p];
+                                    pivot = rows[p];
+                                }
+                            }
+
+                            pivots[j - k] = pivot;
+
+                            if (largest == T(0)) {
+                                singular = true;
+                                continue;
+                            }
+
+                            if (pivot != j) {
+                                swap_rows(local, row_offset, col, kb, j, pivot, grid, buffer);
+                            }
+
+                            int owner = grid.owner_row(j);
+                            size_t width = k + kb - j;
+
+                            if (grid.grid_row == owner) {
+                                const T* source = a + (j - row_offset) * lc + jl;
+
+                                std::copy(source, source + width, pivot_row.begin());
+                            }
+
+                            grid.col_comm.broadcast(pivot_row.data(), static_cast<int>(width), owner);
+
+                            T inverse = T(1) / pivot_row[0];
+
+                            for (size_t i = local_begin(j + 1, row_offset, lr); i < lr; i++) {
+                                T* row = a + i * lc + jl;
+
+                                T factor = row[0] * inverse;
+                                row[0] = factor;
+
+                                for (size_t c = 1; c < width; c++) {
+                                    row[c] -= factor * pivot_row[c];
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // LUDecompositionMPI methods
+
+                template <typename T>
+                int LUDecompositionMPI<T>::permutation_sign() const noexcept {
+                    int sign = 1;
+
+                    for (size_t i = 0; i < pivots.size(); i++) {
+                        if (pivots[i] != i) {
+                            sign = -sign;
+                        }
+                    }
+
+                    return sign;
+                }
+
+                // Factorization
+
+                template <typename T>
+                LUDecompositionMPI<T> lu(
+                    const containers::MatrixMPI<T>& matrix,
+                    size_t block_size
+                ) {
+                    if (matrix.global_rows() != matrix.global_cols()) {
+                        throw std::invalid_argument("lu::lu: Matrix must be square");
+                    }
+
+                    const distribution::MatrixDistributionInfo& info = matrix.distribution_info();
+
+                    internal::ProcessGrid grid = internal::process_grid(
+                        info, matrix.communicator()
+                    );
+
+                    size_t n = matrix.global_rows();
+                    size_t nb = block_size == 0 ? n : block_size;
+
+                    LUDecompositionMPI<T> result;
+
+                    result.factors = matrix;
+                    result.pivots.assign(n, 0);
+
+                    vmafu::core::Matrix<T>& local = result.factors.local_matrix();
+
+                    size_t lr = local.rows();
+                    size_t lc = local.cols();
+
+                    std::vector<size_t> step(nb + 1);
+                    std::vector<T> buffer;
+
+                    for (size_t k = 0; k < n;) {
+                        int pr = grid.owner_row(k);
+                        int pc = grid.owner_col(k);
+
+                        size_t kb = std::min({
+                            nb, n - k, grid.row_starts[pr + 1] - k, grid.col_starts[pc + 1] - k
+                        });
+
+                        bool panel_column = grid.grid_col == pc;
+                        size_t col = panel_column ? k - info.col_offset : 0;
+
+                        // Panel pivots and singular flag, from the process
+                        // column that factored it to every process row
+
+                        if (panel_column) {
+                            bool singular = false;
+
+                            internal::factor_panel(
+                                local, info.row_offset, col, k, kb, grid, step, singular
+                            );
+
+                            step[kb] = singular ? 1 : 0;
+                        }
+
+                        grid.row_comm.broadcast(step.data(), static_cast<int>(kb + 1), pc);
+
+                        std::copy(step.begin(), step.begin() + kb, result.pivots.begin() + k);
+                        result.singular = result.singular || step[kb] != 0;
+
+                        // Swap the rest of each pivot row
+
+                        for (size_t j = k; j < k + kb; j++) {
+                            size_t pivot = result.pivots[j];
+
+                            if (pivot == j) {
+                                continue;
+                            }
+
+                            if (panel_column) {
+                                internal::swap_rows(
+                                    local, info.row_offset, 0, col, j, pivot, grid, buffer
+                                );
+                                internal::swap_rows(
+                                    local, info.row_offset, col + kb, lc - col - kb, j, pivot, grid, buffer
+                                );
+                            } else {
+                                internal::swap_rows(
+                                    local, info.row_offset, 0, lc, j, pivot, grid, buffer
+                                );
+                            }
+                        }
+
+                        if (k + kb == n) {
+                            break;
+                        }
+
+                        // L11 / L21 along the process rows
+
+                        size_t first_row = internal::local_begin(k, info.row_offset, lr);
+                        size_t first_col = internal::local_begin(k + kb, info.col_offset, lc);
+
+                        size_t panel_rows = lr - first_row;
+                        size_t rest_cols = lc - first_col;
+
+                        vmafu::core::Matrix<T> panel(panel_rows, kb, vmafu::core::uninitialized);
+
+                        if (panel_column) {
+                            for (size_t i = 0; i < panel_rows; i++) {
+                                for (size_t c = 0; c < kb; c++) {
+                                    panel(i, c) = local(first_row + i, col + c);
+                                }
+                            }
+                        }
+
+                        grid.row_comm.broadcast(
+                            panel.data(), static_cast<int>(panel_rows * kb), pc
+                        );
+
+                        // U12 := L11^-1 A12 on the process row of the
+                        // diagonal block, then along the process columns
+
+                        vmafu::core::Matrix<T> upper(kb, rest_cols, vmafu::core::uninitialized);
+
+                        if (grid.grid_row == pr) {
+                            T* a = local.data();
+
+                            for (size_t i = 1; i < kb; i++) {
+                                T* row = a + (first_row + i) * lc;
+
+                                for (size_t m = 0; m < i; m++) {
+                                    T factor = panel(i, m);
+                                    const T* source = a + (first_row + m) * lc;
+
+                                    for (size_t c = first_col; c < lc; c++) {
+                                        row[c] -= factor * source[c];
+                                    }
+                                }
+                            }
+
+                            for (size_t i = 0; i < kb; i++) {
+                                for (size_t c = 0; c < rest_cols; c++) {
+                                    upper(i, c) = local(first_row + i, first_col + c);
+                                }
+                            }
+                        }
+
+                        grid.col_comm.broadcast(
+                            upper.data(), static_cast<int>(kb * rest_cols), pr
+                        );
+
+                        // A22 -= L21 * U12 on the local part
+
+                        size_t trailing_row = internal::local_begin(k + kb, info.row_offset, lr);
+                        size_t rest_rows = lr - trailing_row;
+
+                        if (rest_rows > 0 && rest_cols > 0) {
+                            vmafu::linalg::gemm(
+                                T(-1),
+                                panel.block(trailing_row - first_row, 0, rest_rows, kb),
+                                upper.block(0, 0, kb, rest_cols),
+                                T(1),
+                                local.block(trailing_row, first_col, rest_rows, rest_cols)
+                            );
+                        }
+
+                        k += kb;
+                    }
+
+                    return result;
+                }
+
+                // Solve methods
+
+                template <typename T>
+                containers::VectorMPI<T> solve(
+                    const LUDecompositionMPI<T>& decomposition,
+                    const containers::VectorMPI<T>& rhs
+                ) {
+                    if (decomposition.singular) {
+                        throw std::runtime_error("lu::solve: Matrix is singular");
+                    }
+
+                    size_t n = decomposition.factors.global_rows();
+
+                    if (rhs.global_size() != n) {
+                        throw std::invalid_argument(
+                            "lu::solve: Right-hand side size must equal matrix size"
+                        );
+                    }
+
+                    const distribution::MatrixDistributionInfo& info = decomposition.factors.distribution_info();
+                    const communication::Communicator& comm = decomposition.factors.communicator();
+
+                    internal::ProcessGrid grid = internal::process_grid(info, comm);
+
+                    const vmafu::core::Matrix<T>& local = decomposition.factors.local_matrix();
+
+                    size_t lc = local.cols();
+
+                    std::vector<T> x;
+
+                    internal::allgather_vector(rhs, x);
+
+                    for (size_t i = 0; i < n; i++) {
+                        if (decomposition.pivots[i] != i) {
+                            std::swap(x[i], x[decomposition.pivots[i]]);
+                        }
+                    }
+
+                    // Segments on which both the process row and the
+                    // process column are fixed
+
+                    std::vector<size_t> bounds(grid.row_starts);
+
+                    bounds.insert(bounds.end(), grid.col_starts.begin(), grid.col_starts.end());
+
+                    std::sort(bounds.begin(), bounds.end());
+                    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+                    std::vector<T> partial;
+                    std::vector<T> sums;
+
+                    // Each segment: the process row sums what it owns left
+                    // ( right ) of the segment onto the diagonal rank, which
+                    // finishes the substitution and broadcasts the result
+
+                    auto substitute = [&](size_t s, size_t e, bool forward) {
+                        int pr = grid.owner_row(s);
+                        int pc = grid.owner_col(s);
+
+                        size_t length = e - s;
+
+                        if (grid.grid_row == pr) {
+                            size_t first = forward ? 0 : internal::local_begin(e, info.col_offset, lc);
+                            size_t last = forward ? internal::local_begin(s, info.col_offset, lc) : lc;
+
+                            partial.assign(length, T(0));
+                            sums.resize(length);
+
+                            for (size_t i = 0; i < length; i++) {
+                                const T* row = local.data() + (s - info.row_offset + i) * lc;
+
+                                T sum = T(0);
+
+                                for (size_t c = first; c < last; c++) {
+                                    sum += row[c] * x[info.col_offset + c];
+                                }
+
+                                partial[i] = sum;
+                            }
+
+                            grid.row_comm.reduce(
+                                partial.data(), sums.data(), static_cast<int>(length), MPI_SUM, pc
+                            );
+
+                            if (grid.grid_col == pc) {
+                                auto element = [&](size_t i, size_t j) {
+                                    return local(i - info.row_offset, j - info.col_offset);
+                                };
+
+                                if (forward) {
+                                    for (size_t i = s; i < e; i++) {
+                                        T value = x[i] - sums[i - s];
+
+                                        for (size_t j = s; j < i; j++) {
+                                            value -= element(i, j) * x[j];
+                                        }
+
+                                        x[i] = value;
+                                    }
+                                } else {
+                                    for (size_t i = e; i-- > s;) {
+                                        T value = x[i] - sums[i - s];
+
+                                        for (size_t j = i + 1; j < e; j++) {
+                                            value -= element(i, j) * x[j];
+                                        }
+
+                                        x[i] = value / element(i, i);
+                                    }
+                                }
+                            }
+                        }
+
+                        comm.broadcast(
+                            x.data() + s, static_cast<int>(length), pr * grid.grid_cols + pc
+                        );
+                    };
+
+                    for (size_t b = 0; b + 1 < bounds.size(); b++) {
+                        substitute(bounds[b], bounds[b + 1], true);
+                    }
+
+                    for (size_t b = bounds.size() - 1; b > 0; b--) {
+                        substitute(bounds[b - 1], bounds[b], false);
+                    }
+
+                    containers::VectorMPI<T> result = internal::empty_like(rhs);
+
+                    std::copy(
+                        x.begin() + rhs.distribution_info().offset,
+                        x.begin() + rhs.distribution_info().offset + rhs.local_size(),
+                        internal::local_data(result)
+                    );
+
+                    return result;
+                }
+
+                template <typename T>
+                containers::VectorMPI<T> solve(
+                    const containers::MatrixMPI<T>& matrix,
+                    const containers::VectorMPI<T>& rhs
+                ) {
+                    return solve(lu(matrix), rhs);
+                }
+
+                // Determinant methods
+
+                template <typename T>
+                T det(const LUDecompositionMPI<T>& decomposition) {
+                    if (decomposition.singular) {
+                        return T(0);
+                    }
+
+                    const distribution::MatrixDistributionInfo& info = decomposition.factors.distribution_info();
+                    const vmafu::core::Matrix<T>& local = decomposition.factors.local_matrix();
+
+                    size_t first = std::max(info.row_offset, info.col_offset);
+                    size_t last = std::min(
+                        info.row_offset + info.local_rows, info.col_offset + info.local_cols
+                    );
+
+                    T product = T(1);
+
+                    for (size_t i = first; i < last; i++) {
+                        product *= local(i - info.row_offset, i - info.col_offset);
+                    }
+
+                    product = decomposition.factors.communicator().allreduce(product, MPI_PROD);
+
+                    return decomposition.permutation_sign() < 0 ? -product : product;
+                }
+
+                template <typename T>
+                T det(const containers::MatrixMPI<T>& matrix) {
+                    return det(lu(matrix));
+                }
+            }
+        }
+    }
+}
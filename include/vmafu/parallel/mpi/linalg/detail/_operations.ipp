@@ -50,7 +50,9 @@ namespace vmafu {
                             counts.data(), disps.data()
                         );
 
-                        vmafu::core::Matrix<T> global(rows, cols);
+                        vmafu::core::Matrix<T> global(
+                            rows, cols, vmafu::core::uninitialized
+                        );
 
                         if (
                             info.type == distribution::MatrixDistributionType::BLOCK_ROWS
@@ -91,7 +93,9 @@ namespace vmafu {
                                 total_size += recvcounts[i];
                             }
 
-                            vmafu::core::Vector<T> recv_buf(total_size);
+                            vmafu::core::Vector<T> recv_buf(
+                                total_size, vmafu::core::uninitialized
+                            );
 
                             comm.allgatherv(
                                 matrix.local_matrix().data(),
@@ -102,26 +106,16 @@ namespace vmafu {
                             );
 
                             for (int p = 0; p < comm_size; p++) {
-                                size_t col_start = all_col_offsets[p];
-                                size_t local_cols = all_local_cols[p];
-
-                                for (size_t i = 0; i < rows; i++) {
-                                    for (size_t j = 0; j < local_cols; j++) {
-                                        global(i, col_start + j) = recv_buf[recvdisps[p] + i * local_cols + j];
-                                    }
-                                }
+                                global.block(
+                                    0, all_col_offsets[p], rows, all_local_cols[p]
+                                ).copy_from(
+                                    vmafu::core::ConstMatrixView<T>(
+                                        recv_buf.data() + recvdisps[p],
+                                        rows, all_local_cols[p]
+                                    )
+                                );
                             }
                         } else {
-                            const auto& local_mat = matrix.local_matrix();
-
-                            vmafu::core::Vector<T> send_buf(info.local_rows * info.local_cols);
-
-                            for (size_t i = 0; i < info.local_rows; i++) {
-                                for (size_t j = 0; j < info.local_cols; j++) {
-                                    send_buf[i * info.local_cols + j] = local_mat(i, j);
-                                }
-                            }
-
                             vmafu::core::Vector<int> recvcounts_2d(comm_size);
                             vmafu::core::Vector<int> recvdisps_2d(comm_size);
 
@@ -136,10 +130,12 @@ namespace vmafu {
                                 total_size += recvcounts_2d[i];
                             }
 
-                            vmafu::core::Vector<T> recv_buf(total_size);
+                            vmafu::core::Vector<T> recv_buf(
+                                total_size, vmafu::core::uninitialized
+                            );
 
                             comm.allgatherv(
-                                send_buf.data(),
+                                matrix.local_matrix().data(),
                                 static_cast<int>(info.local_rows * info.local_cols),
                                 recv_buf.data(),
                                 recvcounts_2d.data(),
@@ -147,16 +143,15 @@ namespace vmafu {
                             );
 
                             for (int p = 0; p < comm_size; p++) {
-                                size_t row_off = all_row_offsets[p];
-                                size_t col_off = all_col_offsets[p];
-                                size_t lrows = all_local_rows[p];
-                                size_t lcols = all_local_cols[p];
-
-                                for (size_t i = 0; i < lrows; i++) {
-                                    for (size_t j = 0; j < lcols; j++) {
-                                        global(row_off + i, col_off + j) = recv_buf[recvdisps_2d[p] + i * lcols + j];
-                                    }
-                                }
+                                global.block(
+                                    all_row_offsets[p], all_col_offsets[p],
+                                    all_local_rows[p], all_local_cols[p]
+                                ).copy_from(
+                                    vmafu::core::ConstMatrixView<T>(
+                                        recv_buf.data() + recvdisps_2d[p],
+                                        all_local_rows[p], all_local_cols[p]
+                                    )
+                                );
                             }
                         }
 
@@ -186,43 +181,30 @@ namespace vmafu {
                         B, comm
                     );
 
-                    vmafu::core::Matrix<T> local_A_rows;
+                    vmafu::core::Matrix<T> global_A;
+                    vmafu::core::ConstMatrixView<T> local_A_rows;
 
                     if (A.distribution_info().type == distribution::MatrixDistributionType::BLOCK_ROWS) {
-                        local_A_rows = A.local_matrix();
+                        local_A_rows = A.local_matrix().view();
                     } else {
-                        vmafu::core::Matrix<T> global_A = internal::allgather_matrix(
-                            A, comm
-                        );
+                        global_A = internal::allgather_matrix(A, comm);
 
                         auto dist_rows = distribution::matrix_distribution_info(
                             distribution::MatrixDistributionType::BLOCK_ROWS, N, M, comm
                         );
 
-                        local_A_rows = vmafu::core::Matrix<T>(
-                            dist_rows.local_rows, M
+                        local_A_rows = global_A.block(
+                            dist_rows.row_offset, 0, dist_rows.local_rows, M
                         );
-
-                        for (size_t i = 0; i < dist_rows.local_rows; i++) {
-                            for (size_t j = 0; j < M; j++) {
-                                local_A_rows(i, j) = global_A(dist_rows.row_offset + i, j);
-                            }
-                        }
                     }
 
-                    vmafu::core::Matrix<T> local_C(local_A_rows.rows(), P);
-
-                    for (size_t i = 0; i < local_A_rows.rows(); i++) {
-                        for (size_t j = 0; j < P; j++) {
-                            T sum = T(0);
-
-                            for (size_t k = 0; k < M; k++) {
-                                sum += local_A_rows(i, k) * global_B(k, j);
-                            }
+                    vmafu::core::Matrix<T> local_C(
+                        local_A_rows.rows(), P, vmafu::core::uninitialized
+                    );
 
-                            local_C(i, j) = sum;
-                        }
-                    }
+                    vmafu::linalg::multiply(
+                        local_A_rows, global_B.view(), local_C.view()
+                    );
 
                     auto dist_result = distribution::matrix_distribution_info(
                         distribution::MatrixDistributionType::BLOCK_ROWS, N, P, comm
@@ -230,7 +212,7 @@ namespace vmafu {
 
                     containers::MatrixMPI<T> result(comm);
 
-                    result.set_local_matrix(local_C);
+                    result.set_local_matrix(std::move(local_C));
                     result.set_dist_info(dist_result);
 
                     return result;
@@ -300,17 +282,13 @@ namespace vmafu {
                     if (
                         A_info.type == distribution::MatrixDistributionType::BLOCK_ROWS
                     ) {
-                        local_y = vmafu::core::Vector<T>(A_info.local_rows);
-
-                        for (size_t i = 0; i < A_info.local_rows; i++) {
-                            T sum = T(0);
-
-                            for (size_t j = 0; j < M; j++) {
-                                sum += local_A(i, j) * global_x[j];
-                            }
+                        local_y = vmafu::core::Vector<T>(
+                            A_info.local_rows, vmafu::core::uninitialized
+                        );
 
-                            local_y[i] = sum;
-                        }
+                        vmafu::linalg::multiply(
+                            local_A.view(), global_x.view(), local_y.view()
+                        );
                     } else if (
                         A_info.type == distribution::MatrixDistributionType::BLOCK_COLS
                     ) {
@@ -335,11 +313,9 @@ namespace vmafu {
                             distribution::VectorDistributionType::BLOCK, N, comm
                         );
                         
-                        local_y = vmafu::core::Vector<T>(dist_result.local_size);
-
-                        for (size_t i = 0; i < dist_result.local_size; i++) {
-                            local_y[i] = global_y[dist_result.offset + i];
-                        }
+                        local_y = vmafu::core::Vector<T>(
+                            global_y.segment(dist_result.offset, dist_result.local_size)
+                        );
 
                         containers::VectorMPI<T> result(comm);
 
@@ -354,17 +330,15 @@ namespace vmafu {
                             distribution::MatrixDistributionType::BLOCK_ROWS, N, M, comm
                         );
                         
-                        local_y = vmafu::core::Vector<T>(dist_rows.local_rows);
-
-                        for (size_t i = 0; i < dist_rows.local_rows; i++) {
-                            T sum = T(0);
-
-                            for (size_t j = 0; j < M; j++) {
-                                sum += global_A(dist_rows.row_offset + i, j) * global_x[j];
-                            }
+                        local_y = vmafu::core::Vector<T>(
+                            dist_rows.local_rows, vmafu::core::uninitialized
+                        );
 
-                            local_y[i] = sum;
-                        }
+                        vmafu::linalg::multiply(
+                            global_A.block(dist_rows.row_offset, 0, dist_rows.local_rows, M),
+                            global_x.view(),
+                            local_y.view()
+                        );
                     }
 
                     auto dist_result = distribution::vector_distribution_info(
@@ -518,16 +492,23 @@ namespace vmafu {
 
                     containers::VectorMPI<T> result(comm);
 
-                    vmafu::core::Vector<T> local_part(dist_result.local_size);
-                    for (size_t i = 0; i < dist_result.local_size; i++) {
-                        local_part[i] = global_result[dist_result.offset + i];
-                    }
+                    vmafu::core::Vector<T> local_part(
+                        global_result.segment(dist_result.offset, dist_result.local_size)
+                    );
 
-                    result.set_local_vector(local_part);
+                    result.set_local_vector(std::move(local_part));
                     result.set_dist_info(dist_result);
 
                     return result;
                 }
+
+                template <typename T>
+                containers::VectorMPI<T> multiply(
+                    const containers::SparseMatrixMPI<T>& A,
+                    const containers::VectorMPI<T>& x
+                ) {
+                    return A.multiply(x);
+                }
             }
         }
     }
@@ -0,0 +1,522 @@
+// parallel/mpi/linalg/detail/_preconditioners.ipp
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Helper methods
+
+                namespace internal {
+                    // Diagonal blocks of block_size consecutive rows ( 0: all
+                    // of them ) of the rows each rank owns under BLOCK_ROWS,
+                    // the split the solvers' vectors use. Blocks are packed
+                    // one after another, row-major, m * m values for a block
+                    // of m rows. Every rank reads the entries it stores out
+                    // of its local block and sends them to the row owner, so
+                    // only the blocks themselves are moved
+
+                    template <typename T>
+                    std::vector<T> diagonal_blocks(
+                        const containers::MatrixMPI<T>& A,
+                        size_t block_size,
+                        size_t& local_size,
+                        const char* caller
+                    ) {
+                        if (A.global_rows() != A.global_cols()) {
+                            throw std::invalid_argument(
+                                std::string(caller) + ": Matrix must be square"
+                            );
+                        }
+
+                        const communication::Communicator& comm = A.communicator();
+                        const distribution::MatrixDistributionInfo& info = A.distribution_info();
+
+                        int comm_size = comm.size();
+                        size_t n = A.global_rows();
+
+                        distribution::MatrixDistributionInfo target = distribution::matrix_distribution_info(
+                            distribution::MatrixDistributionType::BLOCK_ROWS, n, n, comm
+                        );
+
+                        std::vector<size_t> offsets(comm_size);
+
+                        comm.allgather(&target.row_offset, offsets.data(), 1);
+
+                        auto owned = [&](int r) {
+                            return (r + 1 < comm_size ? offsets[r + 1] : n) - offsets[r];
+                        };
+
+                        auto width = [&](size_t rows) {
+                            return (block_size == 0 || block_size > rows) ? rows : block_size;
+                        };
+
+                        // Calls visit(owner, position, value) for every stored
+                        // entry that falls in a diagonal block
+
+                        const vmafu::core::Matrix<T>& local = A.local_matrix();
+
+                        auto for_each_entry = [&](auto&& visit) {
+                            for (size_t i = 0; i < info.local_rows; i++) {
+                                size_t row = info.row_offset + i;
+
+                                int owner = static_cast<int>(
+                                    std::upper_bound(offsets.begin(), offsets.end(), row) - \
+                                    offsets.begin()
+                                ) - 1;
+
+                                size_t rows = owned(owner);
+                                size_t bs = width(rows);
+                                size_t b = (row - offsets[owner]) / bs;
+                                size_t first = offsets[owner] + b * bs;
+                                size_t m = std::min(bs, rows - b * bs);
+
+                                size_t begin = std::max(first, info.col_offset);
+                                size_t end = std::min(first + m, info.col_offset + info.local_cols);
+
+                                for (size_t col = begin; col < end; col++) {
+                                    visit(
+                                        owner,
+                                        b * bs * bs + (row - first) * m + (col - first),
+                                        local(i, col - info.col_offset)
+                                    );
+                                }
+                            }
+                        };
+
+                        std::vector<size_t> counts(comm_size, 0);
+
+                        for_each_entry([&](int owner, size_t, const T&) {
+                            counts[owner]++;
+                        });
+
+                        std::vector<int> send_counts(comm_size);
+                        std::vector<int> recv_counts(comm_size);
+
+                        size_t send_total = 0;
+
+                        for (int r = 0; r < comm_size; r++) {
+                            if (send_total + counts[r] > INT_MAX) {
+                                throw std::invalid_argument(
+                                    std::string(caller) + ": Diagonal blocks exceed MPI count limits"
+                                );
+                            }
+
+                            send_counts[r] = static_cast<int>(counts[r]);
+                            send_total += counts[r];
+                        }
+
+                        comm.alltoall(send_counts.data(), recv_counts.data(), 1);
+
+                        std::vector<int> send_displs(comm_size, 0);
+                        std::vector<int> recv_displs(comm_size, 0);
+
+                        for (int r = 1; r < comm_size; r++) {
+                            send_displs[r] = send_displs[r - 1] + send_counts[r - 1];
+                            recv_displs[r] = recv_displs[r - 1] + recv_counts[r - 1];
+                        }
+
+                        size_t received = static_cast<size_t>(
+                            recv_displs[comm_size - 1] + recv_counts[comm_size - 1]
+                        );
+
+                        std::vector<size_t> send_positions(send_total);
+                        std::vector<T> send_values(send_total);
+
+                        std::vector<int> next(send_displs);
+
+                        for_each_entry([&](int owner, size_t position, const T& value) {
+                            int k = next[owner]++;
+
+                            send_positions[k] = position;
+                            send_values[k] = value;
+                        });
+
+                        std::vector<size_t> recv_positions(received);
+                        std::vector<T> recv_values(received);
+
+                        comm.alltoallv(
+                            send_positions.data(), send_counts.data(), send_displs.data(),
+                            recv_positions.data(), recv_counts.data(), recv_displs.data()
+                        );
+                        comm.alltoallv(
+                            send_values.data(), send_counts.data(), send_displs.data(),
+                            recv_values.data(), recv_counts.data(), recv_displs.data()
+                        );
+
+                        local_size = target.local_rows;
+
+                        size_t bs = width(local_size);
+                        size_t last = local_size == 0 ? 0 : local_size - (local_size - 1) / bs * bs;
+
+                        std::vector<T> blocks(
+                            local_size == 0 ? 0 : \
+                                (local_size - last) * bs + last * last,
+                            T(0)
+                        );
+
+                        for (size_t k = 0; k < received; k++) {
+                            blocks[recv_positions[k]] = recv_values[k];
+                        }
+
+                        return blocks;
+                    }
+
+                    // Throws on every rank when any rank failed, so no rank
+                    // is left waiting in a later collective
+
+                    inline void check_collective(
+                        bool failed,
+                        const communication::Communicator& comm,
+                        const char* message
+                    ) {
+                        if (comm.allreduce(failed ? 1 : 0, MPI_MAX) != 0) {
+                            throw std::invalid_argument(message);
+                        }
+                    }
+
+                    template <typename T>
+                    void prepare_output(
+                        const containers::VectorMPI<T>& r,
+                        containers::VectorMPI<T>& z
+                    ) {
+                        if (!same_distribution(r, z)) {
+                            z = empty_like(r);
+                        }
+                    }
+                }
+
+                // IdentityPreconditioner apply method
+
+                template <typename T>
+                void IdentityPreconditioner<T>::apply(
+                    const containers::VectorMPI<T>& r,
+                    containers::VectorMPI<T>& z
+                ) const {
+                    internal::prepare_output(r, z);
+
+                    std::copy(
+                        internal::local_data(r),
+                        internal::local_data(r) + internal::local_count(r),
+                        internal::local_data(z)
+                    );
+                }
+
+                // JacobiPreconditioner constructors
+
+                template <typename T>
+                JacobiPreconditioner<T>::JacobiPreconditioner() {}
+
+                template <typename T>
+                JacobiPreconditioner<T>::JacobiPreconditioner(
+                    const containers::MatrixMPI<T>& A
+                ) {
+                    size_t local_size = 0;
+
+                    std::vector<T> blocks = internal::diagonal_blocks(
+                        A, 1, local_size, "JacobiPreconditioner::JacobiPreconditioner()"
+                    );
+
+                    vmafu::core::Vector<T> diagonal(local_size, vmafu::core::uninitialized);
+
+                    std::copy(blocks.begin(), blocks.end(), diagonal.data());
+
+                    _invert(diagonal, A.communicator());
+                }
+
+                template <typename T>
+                JacobiPreconditioner<T>::JacobiPreconditioner(
+                    const containers::SparseMatrixMPI<T>& A
+                ) {
+                    const vmafu::core::SparseMatrix<T>& local = A.local_matrix();
+
+                    const std::vector<size_t>& row_ptr = local.row_ptr();
+                    const std::vector<size_t>& col_indices = local.col_indices();
+                    const std::vector<T>& values = local.values();
+
+                    size_t row_offset = A.distribution_info().offset;
+
+                    vmafu::core::Vector<T> diagonal(local.rows(), T(0));
+
+                    for (size_t i = 0; i < local.rows(); i++) {
+                        for (size_t k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+                            if (col_indices[k] == row_offset + i) {
+                                diagonal[i] += values[k];
+                            }
+                        }
+                    }
+
+                    _invert(diagonal, A.communicator());
+                }
+
+                template <typename T>
+                JacobiPreconditioner<T>::JacobiPreconditioner(
+                    const containers::VectorMPI<T>& diagonal
+                ) {
+                    _invert(diagonal.local_vector(), diagonal.communicator());
+                }
+
+                // JacobiPreconditioner helper method
+
+                template <typename T>
+                void JacobiPreconditioner<T>::_invert(
+                    const vmafu::core::Vector<T>& diagonal,
+                    const communication::Communicator& comm
+                ) {
+                    _inverse_diagonal = vmafu::core::Vector<T>(
+                        diagonal.size(), vmafu::core::uninitialized
+                    );
+
+                    bool singular = false;
+
+                    for (size_t i = 0; i < diagonal.size(); i++) {
+                        if (diagonal[i] == T(0)) {
+                            singular = true;
+                            _inverse_diagonal[i] = T(0);
+                        } else {
+                            _inverse_diagonal[i] = T(1) / diagonal[i];
+                        }
+                    }
+
+                    internal::check_collective(
+                        singular, comm,
+                        "JacobiPreconditioner::JacobiPreconditioner(): Zero on the diagonal"
+                    );
+                }
+
+                // JacobiPreconditioner getter
+
+                template <typename T>
+                const vmafu::core::Vector<T>& JacobiPreconditioner<T>::inverse_diagonal() const noexcept {
+                    return _inverse_diagonal;
+                }
+
+                // JacobiPreconditioner apply method
+
+                template <typename T>
+                void JacobiPreconditioner<T>::apply(
+                    const containers::VectorMPI<T>& r,
+                    containers::VectorMPI<T>& z
+                ) const {
+                    if (r.local_size() != _inverse_diagonal.size()) {
+                        throw std::invalid_argument(
+                            "JacobiPreconditioner::apply(): Vector distribution does not match"
+                        );
+                    }
+
+                    internal::prepare_output(r, z);
+
+                    const T* input = internal::local_data(r);
+                    const T* inverse = _inverse_diagonal.data();
+                    T* output = internal::local_data(z);
+
+                    for (size_t i = 0; i < _inverse_diagonal.size(); i++) {
+                        output[i] = inverse[i] * input[i];
+                    }
+                }
+
+                // BlockJacobiPreconditioner constructors
+
+                template <typename T>
+                BlockJacobiPreconditioner<T>::BlockJacobiPreconditioner()
+                    : _block_size(0), _local_size(0) {}
+
+                template <typename T>
+                BlockJacobiPreconditioner<T>::BlockJacobiPreconditioner(
+                    const containers::MatrixMPI<T>& A,
+                    size_t block_size
+                ) {
+                    _factors = internal::diagonal_blocks(
+                        A, block_size, _local_size,
+                        "BlockJacobiPreconditioner::BlockJacobiPreconditioner()"
+                    );
+
+                    _block_size = (block_size == 0 || block_size > _local_size) ? \
+                        _local_size : block_size;
+
+                    _factorize(A.communicator());
+                }
+
+                template <typename T>
+                BlockJacobiPreconditioner<T>::BlockJacobiPreconditioner(
+                    const containers::SparseMatrixMPI<T>& A,
+                    size_t block_size
+                ) {
+                    const vmafu::core::SparseMatrix<T>& local = A.local_matrix();
+
+                    const std::vector<size_t>& row_ptr = local.row_ptr();
+                    const std::vector<size_t>& col_indices = local.col_indices();
+                    const std::vector<T>& values = local.values();
+
+                    size_t row_offset = A.distribution_info().offset;
+
+                    _local_size = local.rows();
+                    _block_size = (block_size == 0 || block_size > _local_size) ? \
+                        _local_size : block_size;
+
+                    _factors.assign(
+                        _local_size == 0 ? 0 : \
+                            (block_count() - 1) * _block_size * _block_size + \
+                            _block_rows(block_count() - 1) * _block_rows(block_count() - 1),
+                        T(0)
+                    );
+
+                    for (size_t i = 0; i < _local_size; i++) {
+                        size_t b = i / _block_size;
+                        size_t first = b * _block_size;
+                        size_t m = _block_rows(b);
+
+                        T* block = _factors.data() + b * _block_size * _block_size;
+
+                        for (size_t k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+                            size_t column = col_indices[k];
+
+                            if (
+                                column >= row_offset + first && \
+                                column < row_offset + first + m
+                            ) {
+                                block[(i - first) * m + (column - row_offset - first)] += values[k];
+                            }
+                        }
+                    }
+
+                    _factorize(A.communicator());
+                }
+
+                // BlockJacobiPreconditioner helper methods
+
+                template <typename T>
+                size_t BlockJacobiPreconditioner<T>::_block_rows(size_t block) const noexcept {
+                    return std::min(_block_size, _local_size - block * _block_size);
+                }
+
+                template <typename T>
+                void BlockJacobiPreconditioner<T>::_factorize(
+                    const communication::Communicator& comm
+                ) {
+                    _pivots.assign(_local_size, 0);
+
+                    bool singular = false;
+
+                    for (size_t b = 0; b < block_count() && !singular; b++) {
+                        size_t m = _block_rows(b);
+
+                        T* block = _factors.data() + b * _block_size * _block_size;
+                        size_t* pivots = _pivots.data() + b * _block_size;
+
+                        for (size_t k = 0; k < m; k++) {
+                            size_t pivot = k;
+
+                            for (size_t i = k + 1; i < m; i++) {
+                                if (std::abs(block[i * m + k]) > std::abs(block[pivot * m + k])) {
+                                    pivot = i;
+                                }
+                            }
+
+                            pivots[k] = pivot;
+
+                            if (block[pivot * m + k] == T(0)) {
+                                singular = true;
+                                break;
+                            }
+
+                            if (pivot != k) {
+                                std::swap_ranges(
+                                    block + k * m, block + (k + 1) * m, block + pivot * m
+                                );
+                            }
+
+                            T inverse = T(1) / block[k * m + k];
+
+                            for (size_t i = k + 1; i < m; i++) {
+                                T factor = block[i * m + k] * inverse;
+
+                                block[i * m + k] = factor;
+
+                                for (size_t j = k + 1; j < m; j++) {
+                                    block[i * m + j] -= factor * block[k * m + j];
+                                }
+                            }
+                        }
+                    }
+
+                    internal::check_collective(
+                        singular, comm,
+                        "BlockJacobiPreconditioner::BlockJacobiPreconditioner(): Singular diagonal block"
+                    );
+                }
+
+                // BlockJacobiPreconditioner getters
+
+                template <typename T>
+                size_t BlockJacobiPreconditioner<T>::block_size() const noexcept {
+                    return _block_size;
+                }
+
+                template <typename T>
+                size_t BlockJacobiPreconditioner<T>::block_count() const noexcept {
+                    return _block_size == 0 ? 0 : \
+                        (_local_size + _block_size - 1) / _block_size;
+                }
+
+                // BlockJacobiPreconditioner apply method
+
+                template <typename T>
+                void BlockJacobiPreconditioner<T>::apply(
+                    const containers::VectorMPI<T>& r,
+                    containers::VectorMPI<T>& z
+                ) const {
+                    if (r.local_size() != _local_size) {
+                        throw std::invalid_argument(
+                            "BlockJacobiPreconditioner::apply(): Vector distribution does not match"
+                        );
+                    }
+
+                    internal::prepare_output(r, z);
+
+                    const T* input = internal::local_data(r);
+                    T* output = internal::local_data(z);
+
+                    std::copy(input, input + _local_size, output);
+
+                    for (size_t b = 0; b < block_count(); b++) {
+                        size_t m = _block_rows(b);
+
+                        const T* block = _factors.data() + b * _block_size * _block_size;
+                        const size_t* pivots = _pivots.data() + b * _block_size;
+
+                        T* x = output + b * _block_size;
+
+                        // P b, then L y = P b ( unit diagonal ), then U x = y
+
+                        for (size_t k = 0; k < m; k++) {
+                            if (pivots[k] != k) {
+                                std::swap(x[k], x[pivots[k]]);
+                            }
+                        }
+
+                        for (size_t i = 1; i < m; i++) {
+                            T value = x[i];
+
+                            for (size_t j = 0; j < i; j++) {
+                                value -= block[i * m + j] * x[j];
+                            }
+
+                            x[i] = value;
+                        }
+
+                        for (size_t i = m; i-- > 0;) {
+                            T value = x[i];
+
+                            for (size_t j = i + 1; j < m; j++) {
+                                value -= block[i * m + j] * x[j];
+                            }
+
+                            x[i] = value / block[i * m + i];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,467 @@
+// parallel/mpi/linalg/detail/_reductions.ipp
+
+
+namespace vmafu {
+    namespace parallel {
+        namespace mpi {
+            namespace linalg {
+                // Local kernels
+
+                namespace internal {
+                    // Four independent accumulators break the add dependency
+                    // chain, so the loop pipelines and vectorizes
+
+                    template <typename T>
+                    T local_dot(const T* x, const T* y, size_t count) noexcept {
+                        T s0 = T(0), s1 = T(0), s2 = T(0), s3 = T(0);
+
+                        size_t i = 0;
+
+                        for (; i + 4 <= count; i += 4) {
+                            s0 += x[i] * y[i];
+                            s1 += x[i + 1] * y[i + 1];
+                            s2 += x[i + 2] * y[i + 2];
+                            s3 += x[i + 3] * y[i + 3];
+                        }
+
+                        for (; i < count; i++) {
+                            s0 += x[i] * y[i];
+                        }
+
+                        return (s0 + s1) + (s2 + s3);
+                    }
+
+                    template <typename T, typename Operation>
+                    T local_sum(const T* x, size_t count, Operation operation) noexcept {
+                        T s0 = T(0), s1 = T(0), s2 = T(0), s3 = T(0);
+
+                        size_t i = 0;
+
+                        for (; i + 4 <= count; i += 4) {
+                            s0 += operation(x[i]);
+                            s1 += operation(x[i + 1]);
+                            s2 += operation(x[i + 2]);
+                            s3 += operation(x[i + 3]);
+                        }
+
+                        for (; i < count; i++) {
+                            s0 += operation(x[i]);
+                        }
+
+                        return (s0 + s1) + (s2 + s3);
+                    }
+
+                    template <typename T, typename Operation>
+                    T local_max(const T* x, size_t count, Operation operation) noexcept {
+                        T result = std::numeric_limits<T>::lowest();
+
+                        for (size_t i = 0; i < count; i++) {
+                            T value = operation(x[i]);
+
+                            if (value > result) {
+                                result = value;
+                            }
+                        }
+
+                        return result;
+                    }
+
+                    template <typename T>
+                    struct identity {
+                        T operator()(const T& value) const noexcept {
+                            return value;
+                        }
+                    };
+
+                    template <typename T>
+                    struct absolute {
+                        T operator()(const T& value) const noexcept {
+                            return value < T(0) ? -value : value;
+                        }
+                    };
+
+                    template <typename T>
+                    struct square {
+                        T operator()(const T& value) const noexcept {
+                            return value * value;
+                        }
+                    };
+
+                    template <typename T, template <typename> class Container>
+                    T global_dot(
+                        const Container<T>& x,
+                        const Container<T>& y,
+                        const char* name
+                    ) {
+                        check_distribution(x, y, name);
+
+                        return x.communicator().allreduce(
+                            local_dot(local_data(x), local_data(y), local_count(x)),
+                            MPI_SUM
+                        );
+                    }
+                }
+
+                // VectorMPI reductions
+
+                template <typename T>
+                T dot(
+                    const containers::VectorMPI<T>& x,
+                    const containers::VectorMPI<T>& y
+                ) {
+                    return internal::global_dot(x, y, "linalg::dot()");
+                }
+
+                template <typename T>
+                T sum(const containers::VectorMPI<T>& x) {
+                    return x.communicator().allreduce(
+                        internal::local_sum(
+                            internal::local_data(x), internal::local_count(x),
+                            internal::identity<T>()
+                        ),
+                        MPI_SUM
+                    );
+                }
+
+                template <typename T>
+                T max(const containers::VectorMPI<T>& x) {
+                    if (x.global_size() == 0) {
+                        throw std::invalid_argument(
+                            "linalg::max(): Empty vector"
+                        );
+                    }
+
+                    return x.communicator().allreduce(
+                        internal::local_max(
+                            internal::local_data(x), internal::local_count(x),
+                            internal::identity<T>()
+                        ),
+                        MPI_MAX
+                    );
+                }
+
+                template <typename T>
+                T norm1(const containers::VectorMPI<T>& x) {
+                    return x.communicator().allreduce(
+                        internal::local_sum(
+                            internal::local_data(x), internal::local_count(x),
+                            internal::absolute<T>()
+                        ),
+                        MPI_SUM
+                    );
+                }
+
+                template <typename T>
+                T norm2(const containers::VectorMPI<T>& x) {
+                    return std::sqrt(
+                        x.communicator().allreduce(
+                            internal::local_sum(
+                                internal::local_data(x), internal::local_count(x),
+                                internal::square<T>()
+                            ),
+                            MPI_SUM
+                        )
+                    );
+                }
+
+                template <typename T>
+                T norm_inf(const containers::VectorMPI<T>& x) {
+                    // |x| >= 0, so 0 is a valid identity for empty blocks
+
+                    T local = T(0);
+
+                    const T* data = internal::local_data(x);
+
+                    size_t count = internal::local_count(x);
+
+                    for (size_t i = 0; i < count; i++) {
+                        T value = data[i] < T(0) ? -data[i] : data[i];
+
+                        if (value > local) {
+                            local = value;
+                        }
+                    }
+
+                    return x.communicator().allreduce(local, MPI_MAX);
+                }
+
+                // MatrixMPI reductions
+
+                template <typename T>
+                T dot(
+                    const containers::MatrixMPI<T>& A,
+                    const containers::MatrixMPI<T>& B
+                ) {
+                    return internal::global_dot(A, B, "linalg::dot()");
+                }
+
+                template <typename T>
+                T sum(const containers::MatrixMPI<T>& A) {
+                    return A.communicator().allreduce(
+                        internal::local_sum(
+                            internal::local_data(A), internal::local_count(A),
+                            internal::identity<T>()
+                        ),
+                        MPI_SUM
+                    );
+                }
+
+                template <typename T>
+                T max(const containers::MatrixMPI<T>& A) {
+                    if (A.global_rows() == 0 || A.global_cols() == 0) {
+                        throw std::invalid_argument(
+                            "linalg::max(): Empty matrix"
+                        );
+                    }
+
+                    return A.communicator().allreduce(
+                        internal::local_max(
+                            internal::local_data(A), internal::local_count(A),
+                            internal::identity<T>()
+                        ),
+                        MPI_MAX
+                    );
+                }
+
+                template <typename T>
+                T norm_frobenius(const containers::MatrixMPI<T>& A) {
+                    return std::sqrt(
+                        A.communicator().allreduce(
+                            internal::local_sum(
+                                internal::local_data(A), internal::local_count(A),
+                                internal::square<T>()
+                            ),
+                            MPI_SUM
+                        )
+                    );
+                }
+
+                // FusedReduction constructors
+
+                template <typename T>
+                FusedReduction<T>::FusedReduction(
+                    const communication::Communicator& comm
+                ) : _comm(comm), _request(MPI_REQUEST_NULL), _computed(false) {}
+
+                template <typename T>
+                FusedReduction<T>::~FusedReduction() {
+                    communication::Communicator::wait(_request);
+                }
+
+                // FusedReduction copy / move operators
+
+                template <typename T>
+                FusedReduction<T>::FusedReduction(FusedReduction&& other) noexcept
+                : _comm(std::move(other._comm)),
+                  _local(std::move(other._local)),
+                  _global(std::move(other._global)),
+                  _request(other._request),
+                  _computed(other._computed) {
+                    // Moved vectors keep their storage, so the pointers
+                    // handed to MPI stay valid
+
+                    other._local.clear();
+                    other._global.clear();
+
+                    other._request = MPI_REQUEST_NULL;
+                    other._computed = false;
+                }
+
+                template <typename T>
+                FusedReduction<T>& FusedReduction<T>::operator=(
+                    FusedReduction&& other
+                ) noexcept {
+                    if (this != &other) {
+                        communication::Communicator::wait(_request);
+
+                        _comm = std::move(other._comm);
+                        _local = std::move(other._local);
+                        _global = std::move(other._global);
+                        _request = other._request;
+                        _computed = other._computed;
+
+                        other._local.clear();
+                        other._global.clear();
+
+                        other._request = MPI_REQUEST_NULL;
+                        other._computed = false;
+                    }
+
+                    return *this;
+                }
+
+                // FusedReduction helper method
+
+                template <typename T>
+                size_t FusedReduction<T>::_push(const T& value) {
+                    if (_computed || _request != MPI_REQUEST_NULL) {
+                        throw std::logic_error(
+                            "FusedReduction::add(): Already reduced, call clear() first"
+                        );
+                    }
+
+                    _local.push_back(value);
+
+                    return _local.size() - 1;
+                }
+
+                // FusedReduction queue methods
+
+                template <typename T>
+                size_t FusedReduction<T>::dot(
+                    const containers::VectorMPI<T>& x,
+                    const containers::VectorMPI<T>& y
+                ) {
+                    internal::check_distribution(x, y, "FusedReduction::dot()");
+
+                    return _push(
+                        internal::local_dot(
+                            internal::local_data(x), internal::local_data(y),
+                            internal::local_count(x)
+                        )
+                    );
+                }
+
+                template <typename T>
+                size_t FusedReduction<T>::sum(const containers::VectorMPI<T>& x) {
+                    return _push(
+                        internal::local_sum(
+                            internal::local_data(x), internal::local_count(x),
+                            internal::identity<T>()
+                        )
+                    );
+                }
+
+                template <typename T>
+                size_t FusedReduction<T>::norm1(const containers::VectorMPI<T>& x) {
+                    return _push(
+                        internal::local_sum(
+                            internal::local_data(x), internal::local_count(x),
+                            internal::absolute<T>()
+                        )
+                    );
+                }
+
+                template <typename T>
+                size_t FusedReduction<T>::squared_norm2(const containers::VectorMPI<T>& x) {
+                    return _push(
+                        internal::local_sum(
+                            internal::local_data(x), internal::local_count(x),
+                            internal::square<T>()
+                        )
+                    );
+                }
+
+                template <typename T>
+                size_t FusedReduction<T>::add(const T& local_value) {
+                    return _push(local_value);
+                }
+
+                // FusedReduction reduction methods
+
+                template <typename T>
+                void FusedReduction<T>::compute() {
+                    start();
+                    wait();
+                }
+
+                template <typename T>
+                void FusedReduction<T>::start() {
+                    if (_computed || _request != MPI_REQUEST_NULL) {
+                        return;
+                    }
+
+                    _global.assign(_local.begin(), _local.end());
+
+                    if (!_local.empty()) {
+                        _request = _comm.iallreduce(
+                            _local.data(), _global.data(),
+                            static_cast<int>(_local.size()), MPI_SUM
+                        );
+                    }
+                }
+
+                template <typename T>
+                void FusedReduction<T>::wait() {
+                    if (_computed) {
+                        return;
+                    }
+
+                    start();
+
+                    communication::Communicator::wait(_request);
+
+                    _request = MPI_REQUEST_NULL;
+                    _computed = true;
+                }
+
+                template <typename T>
+                void FusedReduction<T>::clear() {
+                    // Completes a reduction still in flight, no-op otherwise
+
+                    communication::Communicator::wait(_request);
+
+                    _request = MPI_REQUEST_NULL;
+
+                    _local.clear();
+                    _global.clear();
+
+                    _computed = false;
+                }
+
+                // FusedReduction getters
+
+                template <typename T>
+                T FusedReduction<T>::operator[](size_t slot) const {
+                    if (!_computed) {
+                        throw std::logic_error(
+                            "FusedReduction::operator[]: compute() has not been called"
+                        );
+                    }
+
+                    if (slot >= _global.size()) {
+                        throw std::out_of_range(
+                            "FusedReduction::operator[]: Slot out of range"
+                        );
+                    }
+
+                    return _global[slot];
+                }
+
+                template <typename T>
+                size_t FusedReduction<T>::size() const noexcept {
+                    return _local.size();
+                }
+
+                template <typename T>
+                bool FusedReduction<T>::computed() const noexcept {
+                    return _computed;
+                }
+
+                // Batched dot products
+
+                template <typename T>
+                std::vector<T> dots(
+                    const std::vector<containers::VectorMPI<T>>& basis,
+                    const containers::VectorMPI<T>& y
+                ) {
+                    FusedReduction<T> reduction(y.communicator());
+
+                    for (const containers::VectorMPI<T>& v : basis) {
+                        reduction.dot(v, y);
+                    }
+
+                    reduction.compute();
+
+                    std::vector<T> result(basis.size());
+
+                    for (size_t i = 0; i < basis.size(); i++) {
+                        result[i] = reduction[i];
+                    }
+
+                    return result;
+                }
+            }
+        }
+    }
+}
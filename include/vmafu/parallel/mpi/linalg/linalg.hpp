@@ -5,3 +5,9 @@
 
 
 #include "_operations.hpp"
+#include "_elementwise.hpp"
+#include "_reductions.hpp"
+#include "_preconditioners.hpp"
+#include "_linear_operator.hpp"
+#include "_krylov.hpp"
+#include "_lu.hpp"
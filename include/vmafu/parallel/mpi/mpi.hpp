@@ -8,6 +8,7 @@
 #include "communication/communication.hpp"
 #include "distribution/distribution.hpp"
 #include "containers/containers.hpp"
+#include "fileio/fileio.hpp"
 #include "linalg/linalg.hpp"
 #include "utils/utils.hpp"
 
@@ -51,16 +52,74 @@ namespace vmafu {
 
             using distribution::scatter;
             using distribution::gather;
+            using distribution::redistribute;
 
             // Containers
 
             using containers::VectorMPI;
             using containers::MatrixMPI;
+            using containers::SparseMatrixMPI;
+
+            // File IO
+
+            using fileio::read_matrix;
+            using fileio::read_vector;
+            using fileio::read_matrix_csv;
+            using fileio::stream_matrix;
+            using fileio::read_vector_indexed;
+            using fileio::read_sparse_rows;
+            using fileio::read_matrix_market;
+
+            using fileio::write_matrix;
+            using fileio::write_vector;
+
+            using fileio::read_matrix_sharded;
+            using fileio::read_vector_sharded;
+            using fileio::write_matrix_sharded;
+            using fileio::write_vector_sharded;
+
+            using fileio::checkpoint;
+            using fileio::restore;
 
             // Linalg
 
             // using linalg::multiply;
 
+            using linalg::hadamard;
+            using linalg::axpy;
+            using linalg::axpby;
+            using linalg::scale;
+
+            using linalg::dot;
+            using linalg::sum;
+            using linalg::norm1;
+            using linalg::norm2;
+            using linalg::norm_inf;
+            using linalg::norm_frobenius;
+
+            using linalg::FusedReduction;
+            using linalg::dots;
+
+            using linalg::IdentityPreconditioner;
+            using linalg::JacobiPreconditioner;
+            using linalg::BlockJacobiPreconditioner;
+
+            using linalg::LinearOperatorMPI;
+
+            using linalg::SolverOptions;
+            using linalg::SolverTimings;
+            using linalg::SolverResult;
+
+            using linalg::solve_cg;
+            using linalg::solve_pipelined_cg;
+            using linalg::solve_bicgstab;
+            using linalg::solve_gmres;
+
+            using linalg::LUDecompositionMPI;
+            using linalg::lu;
+            using linalg::solve;
+            using linalg::det;
+
             // _mpi.hpp
 
             using mpi::load_vector;
@@ -76,3 +135,10 @@ namespace vmafu {
 // _mpi.hpp
 
 using vmafu::parallel::mpi::operator<<;
+
+// Linalg
+
+using vmafu::parallel::mpi::linalg::operator+;
+using vmafu::parallel::mpi::linalg::operator-;
+using vmafu::parallel::mpi::linalg::operator*;
+using vmafu::parallel::mpi::linalg::operator/;
@@ -4,7 +4,9 @@
 #pragma once
 
 
-// detect C++ version
+// detect C++ version ( the library itself is built as C++17, see
+// CMakeLists.txt; the language macros below are deprecated and kept only
+// for code written against them )
 
 #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
     #define VMAFU_CPP17 1
@@ -20,6 +22,14 @@
     #define VMAFU_IF_CONSTEXPR if
 #endif
 
+// memory mapped files
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define VMAFU_HAS_MMAP 1
+#else
+    #define VMAFU_HAS_MMAP 0
+#endif
+
 // constexpr
 
 #if VMAFU_CPP17
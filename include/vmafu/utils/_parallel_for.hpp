@@ -0,0 +1,43 @@
+// utils/_parallel_for.hpp
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <exception>
+
+
+namespace vmafu {
+    namespace utils {
+        // Splits [begin, end) into contiguous chunks of at least grain
+        // indices and calls func(first, last) for each chunk on its own
+        // thread. threads == 0 uses std::thread::hardware_concurrency().
+        // The first chunk runs on the calling thread, as does any chunk
+        // whose thread fails to start; the first exception thrown by any
+        // chunk is rethrown after all started threads are joined
+
+        template <typename Func>
+        void parallel_for(
+            size_t begin,
+            size_t end,
+            Func&& func,
+            size_t threads = 0,
+            size_t grain = 1
+        );
+
+        // Helper methods
+
+        inline size_t thread_count(
+            size_t work,
+            size_t threads = 0,
+            size_t grain = 1
+        ) noexcept;
+    }
+}
+
+
+#include "detail/_parallel_for.ipp"
@@ -0,0 +1,75 @@
+// utils/_random.hpp
+
+
+#pragma once
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "_compat.hpp"
+
+
+namespace vmafu {
+    namespace utils {
+        // Counter-based Philox4x32-10 generator ( Salmon et al., SC'11 ).
+        // Output is a pure function of ( key, counter ), so element i of a
+        // random stream can be generated anywhere, in any order, with the
+        // same bits: distributed fills do not depend on the rank count
+
+        class Philox4x32 {
+            private:
+                std::array<std::uint32_t, 2> _key;
+
+                // Helper methods
+
+                static void _round(
+                    std::array<std::uint32_t, 4>& counter,
+                    const std::array<std::uint32_t, 2>& key
+                ) noexcept;
+
+            public:
+                // Types
+
+                using counter_type = std::array<std::uint32_t, 4>;
+                using key_type = std::array<std::uint32_t, 2>;
+
+                // Constants
+
+                static constexpr unsigned ROUNDS = 10;
+
+                static constexpr std::uint32_t MULTIPLIER_0 = 0xD2511F53u;
+                static constexpr std::uint32_t MULTIPLIER_1 = 0xCD9E8D57u;
+
+                static constexpr std::uint32_t WEYL_0 = 0x9E3779B9u;
+                static constexpr std::uint32_t WEYL_1 = 0xBB67AE85u;
+
+                // Constructor
+
+                explicit Philox4x32(std::uint64_t seed = 0) noexcept;
+
+                // Getter
+
+                const key_type& key() const noexcept;
+
+                // Generation methods
+
+                counter_type operator()(std::uint64_t index) const noexcept;
+
+                template <typename T>
+                T uniform(std::uint64_t index) const noexcept;
+
+                // Static methods
+
+                static counter_type generate(
+                    counter_type counter,
+                    key_type key
+                ) noexcept;
+        };
+    }
+}
+
+
+#include "detail/_random.ipp"
@@ -0,0 +1,25 @@
+// utils/_unroll.hpp
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <utility>
+
+
+namespace vmafu {
+    namespace utils {
+        // Calls func(0), func(1), ..., func(N - 1) as a fold expression, so
+        // the loop is unrolled at compile time
+
+        template <size_t N, typename Func>
+        constexpr void unroll(Func&& func);
+
+        template <typename Func, size_t... Indices>
+        constexpr void unroll(Func&& func, std::index_sequence<Indices...>);
+    }
+}
+
+
+#include "detail/_unroll.ipp"
@@ -0,0 +1,94 @@
+// utils/detail/_parallel_for.ipp
+
+
+namespace vmafu {
+    namespace utils {
+        template <typename Func>
+        void parallel_for(
+            size_t begin,
+            size_t end,
+            Func&& func,
+            size_t threads,
+            size_t grain
+        ) {
+            if (begin >= end) {
+                return;
+            }
+
+            size_t work = end - begin;
+            size_t count = thread_count(work, threads, grain);
+
+            if (count == 1) {
+                func(begin, end);
+
+                return;
+            }
+
+            size_t chunk = work / count;
+            size_t remainder = work % count;
+
+            std::vector<std::thread> workers;
+            std::vector<std::exception_ptr> errors(count);
+
+            workers.reserve(count - 1);
+
+            size_t head = begin + chunk + (remainder > 0 ? 1 : 0);
+            size_t first = head;
+
+            // A chunk whose thread cannot be started runs on the calling
+            // thread, together with every chunk after it
+
+            try {
+                for (size_t t = 1; t < count; t++) {
+                    size_t last = first + chunk + (t < remainder ? 1 : 0);
+
+                    workers.emplace_back([&func, &errors, t, first, last]() {
+                        try {
+                            func(first, last);
+                        } catch (...) {
+                            errors[t] = std::current_exception();
+                        }
+                    });
+
+                    first = last;
+                }
+            } catch (...) {}
+
+            try {
+                func(begin, head);
+
+                if (first < end) {
+                    func(first, end);
+                }
+            } catch (...) {
+                errors[0] = std::current_exception();
+            }
+
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+
+            for (const std::exception_ptr& error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+        // Helper methods
+
+        inline size_t thread_count(
+            size_t work,
+            size_t threads,
+            size_t grain
+        ) noexcept {
+            if (threads == 0) {
+                threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            }
+
+            size_t chunks = work / std::max<size_t>(grain, 1);
+
+            return std::max<size_t>(std::min(threads, chunks), 1);
+        }
+    }
+}
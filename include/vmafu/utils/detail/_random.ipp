@@ -0,0 +1,103 @@
+// utils/detail/_random.ipp
+
+
+namespace vmafu {
+    namespace utils {
+        // Helper methods
+
+        inline void Philox4x32::_round(
+            std::array<std::uint32_t, 4>& counter,
+            const std::array<std::uint32_t, 2>& key
+        ) noexcept {
+            std::uint64_t product_0 = static_cast<std::uint64_t>(
+                MULTIPLIER_0
+            ) * counter[0];
+            std::uint64_t product_1 = static_cast<std::uint64_t>(
+                MULTIPLIER_1
+            ) * counter[2];
+
+            std::uint32_t hi_0 = static_cast<std::uint32_t>(product_0 >> 32);
+            std::uint32_t lo_0 = static_cast<std::uint32_t>(product_0);
+            std::uint32_t hi_1 = static_cast<std::uint32_t>(product_1 >> 32);
+            std::uint32_t lo_1 = static_cast<std::uint32_t>(product_1);
+
+            counter = {
+                hi_1 ^ counter[1] ^ key[0],
+                lo_1,
+                hi_0 ^ counter[3] ^ key[1],
+                lo_0
+            };
+        }
+
+        // Constructor
+
+        inline Philox4x32::Philox4x32(std::uint64_t seed) noexcept : _key{
+            static_cast<std::uint32_t>(seed),
+            static_cast<std::uint32_t>(seed >> 32)
+        } {}
+
+        // Getter
+
+        inline const Philox4x32::key_type& Philox4x32::key() const noexcept {
+            return _key;
+        }
+
+        // Generation methods
+
+        inline Philox4x32::counter_type Philox4x32::operator()(
+            std::uint64_t index
+        ) const noexcept {
+            return generate(
+                {
+                    static_cast<std::uint32_t>(index),
+                    static_cast<std::uint32_t>(index >> 32),
+                    0u,
+                    0u
+                },
+                _key
+            );
+        }
+
+        template <typename T>
+        T Philox4x32::uniform(std::uint64_t index) const noexcept {
+            static_assert(
+                VMAFU_IS_FLOATING_POINT_V(T),
+                "Philox4x32::uniform(): T must be a floating point type"
+            );
+
+            counter_type bits = (*this)(index);
+
+            // Top mantissa-width bits scaled into [0, 1)
+
+            VMAFU_IF_CONSTEXPR (VMAFU_IS_SAME_V(T, float)) {
+                return static_cast<T>(bits[0] >> 8) * (1.0f / 16777216.0f);
+            } else {
+                std::uint64_t word = (
+                    static_cast<std::uint64_t>(bits[0]) << 32
+                ) | bits[1];
+
+                return static_cast<T>(
+                    static_cast<double>(word >> 11) * (1.0 / 9007199254740992.0)
+                );
+            }
+        }
+
+        // Static methods
+
+        inline Philox4x32::counter_type Philox4x32::generate(
+            counter_type counter,
+            key_type key
+        ) noexcept {
+            for (unsigned round = 0; round < ROUNDS; round++) {
+                if (round > 0) {
+                    key[0] += WEYL_0;
+                    key[1] += WEYL_1;
+                }
+
+                _round(counter, key);
+            }
+
+            return counter;
+        }
+    }
+}
@@ -0,0 +1,16 @@
+// utils/detail/_unroll.ipp
+
+
+namespace vmafu {
+    namespace utils {
+        template <size_t N, typename Func>
+        constexpr void unroll(Func&& func) {
+            unroll(std::forward<Func>(func), std::make_index_sequence<N>());
+        }
+
+        template <typename Func, size_t... Indices>
+        constexpr void unroll(Func&& func, std::index_sequence<Indices...>) {
+            (static_cast<void>(func(Indices)), ...);
+        }
+    }
+}
@@ -5,3 +5,6 @@
 
 
 #include "_compat.hpp"
+#include "_unroll.hpp"
+#include "_parallel_for.hpp"
+#include "_random.hpp"